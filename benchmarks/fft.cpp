@@ -0,0 +1,122 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/fft.hpp"
+#include "thunder/tensor.hpp"
+
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fill(const T &t) {
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++i) {
+    *begin = static_cast< typename T::value_type >(
+        static_cast< double >(i % 2000) / 1000 - 1);
+  }
+}
+
+// Conventional count of 5 n log2(n) floating point operations per line
+template < typename F >
+void setFlops(::benchmark::State &state, typename F::size_type n,
+              typename F::size_type lines) {
+  state.counters["flops"] = ::benchmark::Counter(
+      static_cast< double >(state.iterations() * lines * 5 * n) *
+      ::std::log2(static_cast< double >(n)), ::benchmark::Counter::kIsRate);
+}
+
+// 64 contiguous lines of length n
+template < typename F >
+void fft(::benchmark::State &state) {
+  typedef typename F::tensor_type T;
+  typename T::size_type n = state.range(0);
+  T x(64, n), y(64, n);
+  fill(x);
+  F f;
+  for (auto _ : state) {
+    f.fft(x, y, 1);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< F >(state, n, 64);
+}
+
+// 64 lines of length n along the first dimension, read and written in place
+// without a contiguous copy
+template < typename F >
+void stridedFft(::benchmark::State &state) {
+  typedef typename F::tensor_type T;
+  typename T::size_type n = state.range(0);
+  T x(n, 64), y(n, 64);
+  fill(x);
+  F f;
+  for (auto _ : state) {
+    f.fft(x, y, 0);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< F >(state, n, 64);
+}
+
+template < typename F >
+void rfft(::benchmark::State &state) {
+  typedef typename F::tensor_type T;
+  typedef typename F::real_tensor_type TR;
+  typename T::size_type n = state.range(0);
+  TR x(64, n);
+  T y(64, n / 2 + 1);
+  fill(x);
+  F f;
+  for (auto _ : state) {
+    f.rfft(x, y, 1);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< F >(state, n, 64);
+}
+
+template < typename F >
+void fft2(::benchmark::State &state) {
+  typedef typename F::tensor_type T;
+  typename T::size_type n = state.range(0);
+  T x(n, n), y(n, n);
+  fill(x);
+  F f;
+  for (auto _ : state) {
+    f.fftn(x, y);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< F >(state, n, 2 * n);
+}
+
+BENCHMARK_TEMPLATE(fft, DoubleFft)->RangeMultiplier(4)->Range(64, 16384);
+BENCHMARK_TEMPLATE(fft, FloatFft)->RangeMultiplier(4)->Range(64, 16384);
+// Mixed radices, a generic radix of 7 and Bluestein's algorithm for 1009
+BENCHMARK_TEMPLATE(fft, DoubleFft)->Arg(1000)->Arg(2401)->Arg(1009);
+BENCHMARK_TEMPLATE(stridedFft, DoubleFft)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(stridedFft, FloatFft)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(rfft, DoubleFft)->RangeMultiplier(4)->Range(64, 16384);
+BENCHMARK_TEMPLATE(rfft, FloatFft)->RangeMultiplier(4)->Range(64, 16384);
+BENCHMARK_TEMPLATE(fft2, DoubleFft)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(fft2, FloatFft)->RangeMultiplier(4)->Range(64, 1024);
+
+}  // namespace
+}  // namespace thunder
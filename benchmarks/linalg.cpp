@@ -0,0 +1,120 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/linalg.hpp"
+#include "thunder/tensor.hpp"
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fill(const T &t) {
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++i) {
+    *begin = static_cast< typename T::value_type >(i % 2000) / 1000 - 1;
+  }
+}
+
+template < typename T >
+void setFlops(::benchmark::State &state, typename T::size_type flops) {
+  state.counters["flops"] = ::benchmark::Counter(
+      static_cast< double >(state.iterations() * flops),
+      ::benchmark::Counter::kIsRate);
+}
+
+template < typename T >
+void gemm(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T a(n, n), b(n, n), c(n, n);
+  fill(a);
+  fill(b);
+  Blas< T > blas;
+  for (auto _ : state) {
+    blas.gemm(a, b, c);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * n * n * n);
+}
+
+// Batches of 64 x 64 matrices, multiplied one sub-tensor at a time
+template < typename T >
+void gemmLoop(::benchmark::State &state) {
+  typename T::size_type batch = state.range(0);
+  T a(batch, 64, 64), b(batch, 64, 64), c(batch, 64, 64);
+  fill(a);
+  fill(b);
+  Blas< T > blas;
+  for (auto _ : state) {
+    for (typename T::size_type i = 0; i < batch; ++i) {
+      blas.gemm(a[i], b[i], c[i]);
+    }
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * batch * 64 * 64 * 64);
+}
+
+template < typename T >
+void bmm(::benchmark::State &state) {
+  typename T::size_type batch = state.range(0);
+  T a(batch, 64, 64), b(batch, 64, 64), c(batch, 64, 64);
+  fill(a);
+  fill(b);
+  Blas< T > blas;
+  for (auto _ : state) {
+    blas.bmm(a, b, c);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * batch * 64 * 64 * 64);
+}
+
+// Transposed views of the same batches are multiplied without copies
+template < typename T >
+void transposedBmm(::benchmark::State &state) {
+  typename T::size_type batch = state.range(0);
+  T a(batch, 64, 64), b = T(batch, 64, 64).transpose(1, 2),
+      c(batch, 64, 64);
+  fill(a);
+  fill(b);
+  Blas< T > blas;
+  for (auto _ : state) {
+    blas.bmm(a, b, c);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * batch * 64 * 64 * 64);
+}
+
+#define THUNDER_BENCHMARK_BATCHES RangeMultiplier(8)->Range(8, 4096)
+
+#define THUNDER_BENCHMARK_LINALG(T)                                     \
+  BENCHMARK_TEMPLATE(gemm, T)->RangeMultiplier(4)->Range(64, 1024);     \
+  BENCHMARK_TEMPLATE(gemmLoop, T)->THUNDER_BENCHMARK_BATCHES;           \
+  BENCHMARK_TEMPLATE(bmm, T)->THUNDER_BENCHMARK_BATCHES;                \
+  BENCHMARK_TEMPLATE(transposedBmm, T)->THUNDER_BENCHMARK_BATCHES;
+
+THUNDER_BENCHMARK_LINALG(DoubleTensor)
+THUNDER_BENCHMARK_LINALG(FloatTensor)
+
+#undef THUNDER_BENCHMARK_LINALG
+#undef THUNDER_BENCHMARK_BATCHES
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,95 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/linalg.hpp"
+#include "thunder/nn.hpp"
+#include "thunder/tensor.hpp"
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fill(const T &t) {
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++i) {
+    *begin = static_cast< typename T::value_type >(i % 2000) / 1000 - 1;
+  }
+}
+
+template < typename T >
+void setFlops(::benchmark::State &state, typename T::size_type flops) {
+  state.counters["flops"] = ::benchmark::Counter(
+      static_cast< double >(state.iterations() * flops),
+      ::benchmark::Counter::kIsRate);
+}
+
+// Padded 3 x 3 correlation of c channels of side 56 into c channels
+template < typename T, int a >
+void correlate(::benchmark::State &state) {
+  typedef typename T::size_storage size_storage;
+  typename T::size_type c = state.range(0);
+  T x(1, c, 56, 56), w(c, c, 3, 3), y(1, c, 56, 56);
+  fill(x);
+  fill(w);
+  nn::Convolution< T > conv(
+      size_storage({1}), size_storage({1}), size_storage({1}),
+      static_cast< typename nn::Convolution< T >::Algorithm >(a));
+  for (auto _ : state) {
+    conv.correlate(x, w, y);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * c * c * 9 * 56 * 56);
+}
+
+// The same correlation through a materialized unfold and a matrix multiply
+template < typename T >
+void unfoldGemm(::benchmark::State &state) {
+  typename T::size_type c = state.range(0);
+  T x(c, 58, 58), w(c, c * 9), y(c, 56 * 56);
+  fill(x);
+  fill(w);
+  Blas< T > blas;
+  for (auto _ : state) {
+    T u = x.unfold(1, 3, 1).unfold(3, 3, 1).permute(
+        typename T::size_storage({0, 2, 4, 1, 3}));
+    u.contiguous();
+    blas.gemm(w, u.view(c * 9, 56 * 56), y);
+    ::benchmark::ClobberMemory();
+  }
+  setFlops< T >(state, 2 * c * c * 9 * 56 * 56);
+}
+
+#define THUNDER_BENCHMARK_CHANNELS RangeMultiplier(4)->Range(4, 64)
+
+#define THUNDER_BENCHMARK_NN(T)                                         \
+  BENCHMARK_TEMPLATE(correlate, T, 1)->THUNDER_BENCHMARK_CHANNELS;      \
+  BENCHMARK_TEMPLATE(correlate, T, 2)->THUNDER_BENCHMARK_CHANNELS;      \
+  BENCHMARK_TEMPLATE(unfoldGemm, T)->THUNDER_BENCHMARK_CHANNELS;
+
+THUNDER_BENCHMARK_NN(DoubleTensor)
+THUNDER_BENCHMARK_NN(FloatTensor)
+
+#undef THUNDER_BENCHMARK_NN
+#undef THUNDER_BENCHMARK_CHANNELS
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,89 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/random.hpp"
+#include "thunder/tensor.hpp"
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+template < typename T, typename R >
+void uniform(::benchmark::State &state) {
+  T x(state.range(0));
+  R r(42);
+  for (auto _ : state) {
+    r.uniform(x, -1.0, 1.0);
+    ::benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * x.length());
+}
+
+template < typename T, typename R >
+void normal(::benchmark::State &state) {
+  T x(state.range(0));
+  R r(42);
+  for (auto _ : state) {
+    r.normal(x, 0.0, 1.0);
+    ::benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * x.length());
+}
+
+// Strided tensors go through the generic element traversal
+template < typename T, typename R >
+void transposedNormal(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = T(n, n).transpose();
+  R r(42);
+  for (auto _ : state) {
+    r.normal(x, 0.0, 1.0);
+    ::benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * x.length());
+}
+
+BENCHMARK_TEMPLATE(uniform, DoubleTensor, DoubleRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(uniform, FloatTensor, FloatRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(normal, DoubleTensor, DoubleRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(normal, FloatTensor, FloatRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(transposedNormal, DoubleTensor, DoubleRandom)
+->RangeMultiplier(4)->Range(64, 2048);
+BENCHMARK_TEMPLATE(transposedNormal, FloatTensor, FloatRandom)
+->RangeMultiplier(4)->Range(64, 2048);
+
+// Counter-based generators fill chunks concurrently
+BENCHMARK_TEMPLATE(uniform, DoubleTensor, DoublePhiloxRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(normal, DoubleTensor, DoublePhiloxRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(normal, FloatTensor, FloatPhiloxRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(normal, DoubleTensor, DoubleThreefryRandom)
+->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(transposedNormal, DoubleTensor, DoublePhiloxRandom)
+->RangeMultiplier(4)->Range(64, 2048);
+
+}  // namespace
+}  // namespace thunder
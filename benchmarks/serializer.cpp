@@ -0,0 +1,84 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/serializer.hpp"
+#include "thunder/tensor.hpp"
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+T vector(typename T::size_type n) {
+  T t(n);
+  for (typename T::size_type i = 0; i < n; ++i) {
+    t(i) = static_cast< typename T::value_type >(i % 2000) / 1000 - 1;
+  }
+  return t;
+}
+
+template < typename S, typename T >
+void save(::benchmark::State &state) {
+  T x = vector< T >(state.range(0));
+  ::std::size_t bytes = 0;
+  for (auto _ : state) {
+    S s;
+    s.save(x);
+    bytes = s.protocol().stream().str().size();
+    ::benchmark::DoNotOptimize(bytes);
+  }
+  state.SetItemsProcessed(state.iterations() * x.length());
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+template < typename S, typename T >
+void load(::benchmark::State &state) {
+  T x = vector< T >(state.range(0));
+  S s;
+  s.save(x);
+  ::std::string data = s.protocol().stream().str();
+  for (auto _ : state) {
+    state.PauseTiming();
+    S t;
+    t.protocol().stream().str(data);
+    T y;
+    state.ResumeTiming();
+    t.load(&y);
+    ::benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * x.length());
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+#define THUNDER_BENCHMARK_SERIALIZE(S, T)                               \
+  BENCHMARK_TEMPLATE(save, S, T)->RangeMultiplier(16)->Range(1 << 8, 1 << 20); \
+  BENCHMARK_TEMPLATE(load, S, T)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+THUNDER_BENCHMARK_SERIALIZE(StringBinarySerializer, DoubleTensor)
+THUNDER_BENCHMARK_SERIALIZE(StringBinarySerializer, FloatTensor)
+THUNDER_BENCHMARK_SERIALIZE(StringTextSerializer, DoubleTensor)
+THUNDER_BENCHMARK_SERIALIZE(StringTextSerializer, FloatTensor)
+
+#undef THUNDER_BENCHMARK_SERIALIZE
+
+}  // namespace
+}  // namespace thunder
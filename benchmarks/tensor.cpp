@@ -0,0 +1,352 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor.hpp"
+
+#include "benchmark/benchmark.h"
+
+namespace thunder {
+namespace {
+
+// Square matrices of side n, with values in [-1, 1)
+template < typename T >
+T matrix(typename T::size_type n) {
+  T t(n, n);
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++i) {
+    *begin = static_cast< typename T::value_type >(
+        static_cast< double >(i % 2000) / 1000 - 1);
+  }
+  return t;
+}
+
+template < typename T >
+void setItems(::benchmark::State &state, typename T::size_type length) {
+  state.SetItemsProcessed(state.iterations() * length);
+  state.SetBytesProcessed(
+      state.iterations() * length * sizeof(typename T::value_type));
+}
+
+template < typename T >
+void contiguousAdd(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n), y = matrix< T >(n);
+  for (auto _ : state) {
+    x.add(y);
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, x.length());
+}
+
+// Element-wise chains are evaluated in a single pass
+template < typename T >
+void expression(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T a = matrix< T >(n), b = matrix< T >(n), c = matrix< T >(n),
+      d = matrix< T >(n), r = matrix< T >(n);
+  for (auto _ : state) {
+    r.copy(a + b + c * d);
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, a.length());
+}
+
+// Chains of in-place operations are applied in a single traversal
+template < typename T >
+void fusedChain(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    tensor::fuse(x).mul(0.5).add(2).fmax(1).sqrt().run();
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void methodChain(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    x.mul(0.5).add(2).fmax(1).sqrt();
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void transposedAdd(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n), y = matrix< T >(n).transpose();
+  for (auto _ : state) {
+    x.add(y);
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T, bool fast = false >
+void contiguousExp(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  tensor::simd::setFastMath(fast);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(T::exp(x));
+  }
+  tensor::simd::setFastMath(false);
+  setItems< T >(state, x.length());
+}
+
+template < typename T, bool fast = false >
+void contiguousTanh(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  tensor::simd::setFastMath(fast);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(T::tanh(x));
+  }
+  tensor::simd::setFastMath(false);
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void transposedExp(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n).transpose();
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(T::exp(x));
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void sumAll(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.sum());
+  }
+  setItems< T >(state, x.length());
+}
+
+// Reduction along dimension d of a contiguous matrix
+template < typename T, int d >
+void sumDim(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.sum(static_cast< typename T::dim_type >(d)));
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T, int d >
+void maxDim(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.max(static_cast< typename T::dim_type >(d)));
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void clone(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.clone());
+  }
+  setItems< T >(state, x.length());
+}
+
+// Copy-on-write clones that are only read
+template < typename T >
+void lazyClone(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  tensor::share::setCopyOnWrite(true);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.clone());
+  }
+  tensor::share::setCopyOnWrite(false);
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void transposedCopy(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x(n, n), y = matrix< T >(n).transpose();
+  for (auto _ : state) {
+    x.copy(y);
+    ::benchmark::ClobberMemory();
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void contiguous(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n).transpose();
+  for (auto _ : state) {
+    T y = x;
+    ::benchmark::DoNotOptimize(y.contiguous());
+  }
+  setItems< T >(state, x.length());
+}
+
+// Batches of c channels with side n converted to the channel-last layout
+template < typename T, int c >
+void permute(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x(8, c, n, n);
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = x.reference_begin(),
+           end = x.reference_end(); begin != end; ++begin, ++i) {
+    *begin = static_cast< typename T::value_type >(
+        static_cast< double >(i % 2000) / 1000 - 1);
+  }
+  for (auto _ : state) {
+    T y = x.permute(0, 2, 3, 1);
+    ::benchmark::DoNotOptimize(y.contiguous());
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T, int d >
+void cat(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n), y = matrix< T >(n);
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.cat(y, d));
+  }
+  setItems< T >(state, x.length() * 2);
+}
+
+template < typename T >
+void extract(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  T y(n, n);
+  typename T::size_type i = 0;
+  for (typename T::reference_iterator begin = y.reference_begin(),
+           end = y.reference_end(); begin != end; ++begin, ++i) {
+    // Extract every other element
+    *begin = static_cast< typename T::value_type >(i % 2);
+  }
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.extract(y));
+  }
+  setItems< T >(state, x.length());
+}
+
+template < typename T >
+void shuffle(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n);
+  T y(n * n, 2);
+  for (typename T::size_type i = 0; i < n * n; ++i) {
+    // Visit the elements in a column-major order
+    y(i, 0) = static_cast< typename T::value_type >(i % n);
+    y(i, 1) = static_cast< typename T::value_type >(i / n);
+  }
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(x.shuffle(y));
+  }
+  setItems< T >(state, x.length());
+}
+
+// Complex products by numbers of unit modulus, and multiply-accumulate
+template < typename T, bool fast >
+void complexMul(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n), y = T(n, n).fill(typename T::value_type(0.6, 0.8));
+  tensor::simd::setFastComplex(fast);
+  for (auto _ : state) {
+    x.mul(y);
+    ::benchmark::ClobberMemory();
+  }
+  tensor::simd::setFastComplex(false);
+  setItems< T >(state, x.length());
+}
+
+template < typename T, bool fast >
+void complexFma(::benchmark::State &state) {
+  typename T::size_type n = state.range(0);
+  T x = matrix< T >(n), y = matrix< T >(n), z = matrix< T >(n);
+  tensor::simd::setFastComplex(fast);
+  for (auto _ : state) {
+    x.fma(y, z);
+    ::benchmark::ClobberMemory();
+  }
+  tensor::simd::setFastComplex(false);
+  setItems< T >(state, x.length());
+}
+
+#define THUNDER_BENCHMARK_SIZES RangeMultiplier(4)->Range(64, 4096)
+#define THUNDER_BENCHMARK_LAYOUTS RangeMultiplier(4)->Range(16, 256)
+
+#define THUNDER_BENCHMARK_TENSOR(T)                                     \
+  BENCHMARK_TEMPLATE(contiguousAdd, T)->THUNDER_BENCHMARK_SIZES;        \
+  BENCHMARK_TEMPLATE(transposedAdd, T)->THUNDER_BENCHMARK_SIZES;        \
+  BENCHMARK_TEMPLATE(expression, T)->THUNDER_BENCHMARK_SIZES;           \
+  BENCHMARK_TEMPLATE(fusedChain, T)->THUNDER_BENCHMARK_SIZES;           \
+  BENCHMARK_TEMPLATE(methodChain, T)->THUNDER_BENCHMARK_SIZES;          \
+  BENCHMARK_TEMPLATE(contiguousExp, T)->THUNDER_BENCHMARK_SIZES;        \
+  BENCHMARK_TEMPLATE(contiguousExp, T, true)->THUNDER_BENCHMARK_SIZES;  \
+  BENCHMARK_TEMPLATE(contiguousTanh, T)->THUNDER_BENCHMARK_SIZES;       \
+  BENCHMARK_TEMPLATE(contiguousTanh, T, true)->THUNDER_BENCHMARK_SIZES; \
+  BENCHMARK_TEMPLATE(transposedExp, T)->THUNDER_BENCHMARK_SIZES;        \
+  BENCHMARK_TEMPLATE(sumAll, T)->THUNDER_BENCHMARK_SIZES;               \
+  BENCHMARK_TEMPLATE(sumDim, T, 0)->THUNDER_BENCHMARK_SIZES;            \
+  BENCHMARK_TEMPLATE(sumDim, T, 1)->THUNDER_BENCHMARK_SIZES;            \
+  BENCHMARK_TEMPLATE(maxDim, T, 0)->THUNDER_BENCHMARK_SIZES;            \
+  BENCHMARK_TEMPLATE(maxDim, T, 1)->THUNDER_BENCHMARK_SIZES;            \
+  BENCHMARK_TEMPLATE(clone, T)->THUNDER_BENCHMARK_SIZES;                \
+  BENCHMARK_TEMPLATE(lazyClone, T)->THUNDER_BENCHMARK_SIZES;            \
+  BENCHMARK_TEMPLATE(transposedCopy, T)->THUNDER_BENCHMARK_SIZES;       \
+  BENCHMARK_TEMPLATE(contiguous, T)->THUNDER_BENCHMARK_SIZES;           \
+  BENCHMARK_TEMPLATE(permute, T, 3)->THUNDER_BENCHMARK_LAYOUTS;         \
+  BENCHMARK_TEMPLATE(permute, T, 64)->THUNDER_BENCHMARK_LAYOUTS;        \
+  BENCHMARK_TEMPLATE(cat, T, 0)->THUNDER_BENCHMARK_SIZES;               \
+  BENCHMARK_TEMPLATE(cat, T, 1)->THUNDER_BENCHMARK_SIZES;               \
+  BENCHMARK_TEMPLATE(extract, T)->THUNDER_BENCHMARK_SIZES;              \
+  BENCHMARK_TEMPLATE(shuffle, T)->THUNDER_BENCHMARK_SIZES;
+
+THUNDER_BENCHMARK_TENSOR(DoubleTensor)
+THUNDER_BENCHMARK_TENSOR(FloatTensor)
+
+#define THUNDER_BENCHMARK_COMPLEX(T)                                    \
+  BENCHMARK_TEMPLATE(complexMul, T, false)->THUNDER_BENCHMARK_SIZES;    \
+  BENCHMARK_TEMPLATE(complexMul, T, true)->THUNDER_BENCHMARK_SIZES;     \
+  BENCHMARK_TEMPLATE(complexFma, T, false)->THUNDER_BENCHMARK_SIZES;    \
+  BENCHMARK_TEMPLATE(complexFma, T, true)->THUNDER_BENCHMARK_SIZES;
+
+THUNDER_BENCHMARK_COMPLEX(DoubleComplexTensor)
+THUNDER_BENCHMARK_COMPLEX(FloatComplexTensor)
+
+#undef THUNDER_BENCHMARK_COMPLEX
+
+#undef THUNDER_BENCHMARK_TENSOR
+#undef THUNDER_BENCHMARK_LAYOUTS
+#undef THUNDER_BENCHMARK_SIZES
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,53 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_HPP_
+#define THUNDER_FFT_HPP_
+
+#include "thunder/fft/fft.hpp"
+
+#include "thunder/fft/math.hpp"
+#include "thunder/fft/plan.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+
+template < typename T = DoubleComplexTensor, typename TR = DoubleTensor >
+using Fft = fft::Fft< T, TR >;
+
+typedef Fft< DoubleComplexTensor, DoubleTensor > DoubleFft;
+typedef Fft< FloatComplexTensor, FloatTensor > FloatFft;
+
+}  // namespace thunder
+
+namespace thunder {
+namespace fft {
+
+extern template class Plan< double >;
+extern template class Plan< float >;
+extern template class RealPlan< double >;
+extern template class RealPlan< float >;
+
+extern template class Fft< DoubleComplexTensor, DoubleTensor >;
+extern template class Fft< FloatComplexTensor, FloatTensor >;
+
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_HPP_
@@ -0,0 +1,186 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_FFT_INL_HPP_
+#define THUNDER_FFT_FFT_INL_HPP_
+
+#include "thunder/fft/fft.hpp"
+
+#include "thunder/fft/math.hpp"
+
+namespace thunder {
+namespace fft {
+
+template < typename T, typename TR >
+Fft< T, TR >::Fft() {}
+
+template < typename T, typename TR >
+T Fft< T, TR >::fft(const T &x, dim_type d) {
+  T y(x.size());
+  fft(x, y, d);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::fft(const T &x, const T &y, dim_type d) {
+  return math::fft< Fft >(this, x, y, d, false);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::fft(const T &x, T &y, dim_type d) {
+  return const_cast< T& >(fft(x, const_cast< const T& >(y), d));
+}
+
+template < typename T, typename TR >
+T Fft< T, TR >::ifft(const T &x, dim_type d) {
+  T y(x.size());
+  ifft(x, y, d);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::ifft(const T &x, const T &y, dim_type d) {
+  return math::fft< Fft >(this, x, y, d, true);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::ifft(const T &x, T &y, dim_type d) {
+  return const_cast< T& >(ifft(x, const_cast< const T& >(y), d));
+}
+
+template < typename T, typename TR >
+T Fft< T, TR >::fftn(const T &x, size_storage dims) {
+  T y(x.size());
+  fftn(x, y, dims);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::fftn(const T &x, const T &y, size_storage dims) {
+  return math::fftn< Fft >(this, x, y, dims, false);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::fftn(const T &x, T &y, size_storage dims) {
+  return const_cast< T& >(fftn(x, const_cast< const T& >(y), dims));
+}
+
+template < typename T, typename TR >
+T Fft< T, TR >::ifftn(const T &x, size_storage dims) {
+  T y(x.size());
+  ifftn(x, y, dims);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::ifftn(const T &x, const T &y, size_storage dims) {
+  return math::fftn< Fft >(this, x, y, dims, true);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::ifftn(const T &x, T &y, size_storage dims) {
+  return const_cast< T& >(ifftn(x, const_cast< const T& >(y), dims));
+}
+
+template < typename T, typename TR >
+T Fft< T, TR >::rfft(const TR &x, dim_type d) {
+  size_storage sz = x.size();
+  if (d < sz.size()) {
+    sz[d] = sz[d] / 2 + 1;
+  }
+  T y(sz);
+  rfft(x, y, d);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::rfft(const TR &x, const T &y, dim_type d) {
+  return math::rfft< Fft >(this, x, y, d);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::rfft(const TR &x, T &y, dim_type d) {
+  return const_cast< T& >(rfft(x, const_cast< const T& >(y), d));
+}
+
+template < typename T, typename TR >
+TR Fft< T, TR >::irfft(const T &x, size_type n, dim_type d) {
+  size_storage sz = x.size();
+  if (d < sz.size()) {
+    sz[d] = n;
+  }
+  TR y(sz);
+  irfft(x, y, d);
+  return y;
+}
+
+template < typename T, typename TR >
+const TR& Fft< T, TR >::irfft(const T &x, const TR &y, dim_type d) {
+  return math::irfft< Fft >(this, x, y, d);
+}
+
+template < typename T, typename TR >
+TR& Fft< T, TR >::irfft(const T &x, TR &y, dim_type d) {
+  return const_cast< TR& >(irfft(x, const_cast< const TR& >(y), d));
+}
+
+template < typename T, typename TR >
+T Fft< T, TR >::rfftn(const TR &x, size_storage dims) {
+  dims = math::dimensions(this, x, dims);
+  size_storage sz = x.size();
+  sz[dims[dims.size() - 1]] = sz[dims[dims.size() - 1]] / 2 + 1;
+  T y(sz);
+  rfftn(x, y, dims);
+  return y;
+}
+
+template < typename T, typename TR >
+const T& Fft< T, TR >::rfftn(const TR &x, const T &y, size_storage dims) {
+  return math::rfftn< Fft >(this, x, y, dims);
+}
+
+template < typename T, typename TR >
+T& Fft< T, TR >::rfftn(const TR &x, T &y, size_storage dims) {
+  return const_cast< T& >(rfftn(x, const_cast< const T& >(y), dims));
+}
+
+template < typename T, typename TR >
+TR Fft< T, TR >::irfftn(const T &x, size_type n, size_storage dims) {
+  dims = math::dimensions(this, x, dims);
+  size_storage sz = x.size();
+  sz[dims[dims.size() - 1]] = n;
+  TR y(sz);
+  irfftn(x, y, dims);
+  return y;
+}
+
+template < typename T, typename TR >
+const TR& Fft< T, TR >::irfftn(const T &x, const TR &y, size_storage dims) {
+  return math::irfftn< Fft >(this, x, y, dims);
+}
+
+template < typename T, typename TR >
+TR& Fft< T, TR >::irfftn(const T &x, TR &y, size_storage dims) {
+  return const_cast< TR& >(irfftn(x, const_cast< const TR& >(y), dims));
+}
+
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_FFT_INL_HPP_
@@ -0,0 +1,86 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_FFT_HPP_
+#define THUNDER_FFT_FFT_HPP_
+
+namespace thunder {
+namespace fft {
+
+// Discrete Fourier transforms of complex tensors T, and of real tensors TR
+// through their n / 2 + 1 non-redundant coefficients. Tensors can have any
+// stride, and lines along the transformed dimension are processed in parallel.
+// Inverse transforms are normalized by 1 / n.
+template < typename T, typename TR >
+class Fft {
+ public:
+  typedef T tensor_type;
+  typedef TR real_tensor_type;
+  typedef typename T::value_type value_type;
+  typedef typename TR::value_type real_type;
+  typedef typename T::size_type size_type;
+  typedef typename T::dim_type dim_type;
+  typedef typename T::size_storage size_storage;
+
+  explicit Fft();
+
+  // y[k] = sum_j x[j] * exp(-2 * pi * i * j * k / n) along dimension d
+  T fft(const T &x, dim_type d);
+  const T& fft(const T &x, const T &y, dim_type d);
+  T& fft(const T &x, T &y, dim_type d);
+
+  // y[j] = sum_k x[k] * exp(2 * pi * i * j * k / n) / n along dimension d
+  T ifft(const T &x, dim_type d);
+  const T& ifft(const T &x, const T &y, dim_type d);
+  T& ifft(const T &x, T &y, dim_type d);
+
+  // Transforms along each of dims, or along all dimensions if dims is empty
+  T fftn(const T &x, size_storage dims = size_storage());
+  const T& fftn(const T &x, const T &y, size_storage dims = size_storage());
+  T& fftn(const T &x, T &y, size_storage dims = size_storage());
+
+  T ifftn(const T &x, size_storage dims = size_storage());
+  const T& ifftn(const T &x, const T &y, size_storage dims = size_storage());
+  T& ifftn(const T &x, T &y, size_storage dims = size_storage());
+
+  // Real transforms, where dimension d of size n has size n / 2 + 1 in the
+  // spectrum. The inverse takes n since it cannot be told from the spectrum.
+  T rfft(const TR &x, dim_type d);
+  const T& rfft(const TR &x, const T &y, dim_type d);
+  T& rfft(const TR &x, T &y, dim_type d);
+
+  TR irfft(const T &x, size_type n, dim_type d);
+  const TR& irfft(const T &x, const TR &y, dim_type d);
+  TR& irfft(const T &x, TR &y, dim_type d);
+
+  // Real transforms along each of dims, the last of which is halved
+  T rfftn(const TR &x, size_storage dims = size_storage());
+  const T& rfftn(const TR &x, const T &y, size_storage dims = size_storage());
+  T& rfftn(const TR &x, T &y, size_storage dims = size_storage());
+
+  TR irfftn(const T &x, size_type n, size_storage dims = size_storage());
+  const TR& irfftn(const T &x, const TR &y,
+                   size_storage dims = size_storage());
+  TR& irfftn(const T &x, TR &y, size_storage dims = size_storage());
+};
+
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_FFT_HPP_
@@ -0,0 +1,239 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_MATH_INL_HPP_
+#define THUNDER_FFT_MATH_INL_HPP_
+
+#include "thunder/fft/math.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "thunder/exception.hpp"
+#include "thunder/fft/plan.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace fft {
+namespace math {
+
+template < typename C, typename X, typename Y, typename F >
+void forLines(const X &x, const Y &y, typename X::dim_type d,
+              ::std::size_t work, ::std::size_t cost, const F &func) {
+  typedef typename X::dim_type dim_type;
+  // Sizes and strides of the other dimensions, innermost first
+  ::std::vector< ::std::size_t > sizes;
+  ::std::vector< ::std::ptrdiff_t > x_strides, y_strides;
+  ::std::size_t lines = 1;
+  for (dim_type i = x.dimension(); i > 0; --i) {
+    if (i - 1 != d) {
+      sizes.push_back(x.size(i - 1));
+      x_strides.push_back(x.stride(i - 1));
+      y_strides.push_back(y.stride(i - 1));
+      lines = lines * x.size(i - 1);
+    }
+  }
+  if (lines == 0) {
+    return;
+  }
+  const typename X::value_type *x_data = x.data();
+  typename Y::value_type *y_data = y.data();
+  tensor::parallel::forRange(
+      lines, tensor::parallel::getGrain() / cost + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        ::std::vector< C > buffer(work);
+        for (::std::size_t line = begin; line < end; ++line) {
+          ::std::ptrdiff_t x_offset = 0, y_offset = 0;
+          ::std::size_t index = line;
+          for (::std::size_t i = 0; i < sizes.size(); ++i) {
+            ::std::ptrdiff_t position = index % sizes[i];
+            index = index / sizes[i];
+            x_offset += position * x_strides[i];
+            y_offset += position * y_strides[i];
+          }
+          func(x_data + x_offset, y_data + y_offset, buffer.data());
+        }
+      });
+}
+
+template < typename X, typename Y >
+void checkSizes(const X &x, const Y &y, typename X::dim_type d,
+                ::std::size_t n) {
+  typedef typename X::dim_type dim_type;
+  if (y.dimension() != x.dimension()) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  if (d >= x.dimension()) {
+    throw out_of_range("Dimension exceeds limit.");
+  }
+  for (dim_type i = 0; i < x.dimension(); ++i) {
+    if (y.size(i) != (i == d ? n : x.size(i))) {
+      throw out_of_range("Size mismatches.");
+    }
+  }
+}
+
+template < typename F, typename X >
+typename F::size_storage dimensions(F *, const X &x,
+                                    typename F::size_storage dims) {
+  typedef typename F::dim_type dim_type;
+  typedef typename F::size_storage size_storage;
+  if (x.dimension() == 0) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  if (dims.size() == 0) {
+    size_storage all(x.dimension());
+    for (dim_type i = 0; i < x.dimension(); ++i) {
+      all[i] = i;
+    }
+    return all;
+  }
+  size_storage used(x.dimension(), 0);
+  for (dim_type i = 0; i < dims.size(); ++i) {
+    if (dims[i] >= x.dimension()) {
+      throw out_of_range("Dimension exceeds limit.");
+    }
+    if (used[dims[i]] != 0) {
+      throw invalid_argument("Dimension is repeated.");
+    }
+    used[dims[i]] = 1;
+  }
+  return dims;
+}
+
+template < typename F >
+const typename F::tensor_type& fft(
+    F *, const typename F::tensor_type &x, const typename F::tensor_type &y,
+    typename F::dim_type d, bool inverse) {
+  typedef typename F::value_type C;
+  typedef typename F::real_type D;
+  checkSizes(x, y, d, d < x.dimension() ? x.size(d) : 0);
+  y.detach();
+  if (x.length() == 0) {
+    return y;
+  }
+  ::std::size_t n = x.size(d);
+  ::std::shared_ptr< const Plan< D > > plan = Plan< D >::get(n);
+  ::std::ptrdiff_t x_stride = x.stride(d), y_stride = y.stride(d);
+  D scale = inverse ? static_cast< D >(1) / static_cast< D >(n) : 1;
+  // Lines are transformed into the buffer before being written, which allows
+  // y to be the same as x
+  forLines< C >(
+      x, y, d, n + plan->workspace(), n,
+      [&](const C *x_line, C *y_line, C *work) {
+        plan->execute(x_line, x_stride, work, inverse, work + n);
+        for (::std::size_t k = 0; k < n; ++k, y_line += y_stride) {
+          *y_line = work[k] * scale;
+        }
+      });
+  return y;
+}
+
+template < typename F >
+const typename F::tensor_type& fftn(
+    F *f, const typename F::tensor_type &x, const typename F::tensor_type &y,
+    typename F::size_storage dims, bool inverse) {
+  dims = dimensions(f, x, dims);
+  fft(f, x, y, dims[0], inverse);
+  for (typename F::dim_type i = 1; i < dims.size(); ++i) {
+    fft(f, y, y, dims[i], inverse);
+  }
+  return y;
+}
+
+template < typename F >
+const typename F::tensor_type& rfft(
+    F *, const typename F::real_tensor_type &x,
+    const typename F::tensor_type &y, typename F::dim_type d) {
+  typedef typename F::value_type C;
+  typedef typename F::real_type D;
+  checkSizes(x, y, d, d < x.dimension() ? x.size(d) / 2 + 1 : 0);
+  y.detach();
+  if (x.length() == 0) {
+    return y;
+  }
+  ::std::size_t n = x.size(d);
+  ::std::shared_ptr< const RealPlan< D > > plan = RealPlan< D >::get(n);
+  ::std::ptrdiff_t x_stride = x.stride(d), y_stride = y.stride(d);
+  forLines< C >(
+      x, y, d, plan->workspace(), n,
+      [&](const D *x_line, C *y_line, C *work) {
+        plan->forward(x_line, x_stride, y_line, y_stride, work);
+      });
+  return y;
+}
+
+template < typename F >
+const typename F::real_tensor_type& irfft(
+    F *, const typename F::tensor_type &x,
+    const typename F::real_tensor_type &y, typename F::dim_type d) {
+  typedef typename F::value_type C;
+  typedef typename F::real_type D;
+  checkSizes(y, x, d, d < y.dimension() ? y.size(d) / 2 + 1 : 0);
+  y.detach();
+  if (y.length() == 0) {
+    return y;
+  }
+  ::std::size_t n = y.size(d);
+  ::std::shared_ptr< const RealPlan< D > > plan = RealPlan< D >::get(n);
+  ::std::ptrdiff_t x_stride = x.stride(d), y_stride = y.stride(d);
+  forLines< C >(
+      x, y, d, plan->workspace(), n,
+      [&](const C *x_line, D *y_line, C *work) {
+        plan->inverse(x_line, x_stride, y_line, y_stride, work);
+      });
+  return y;
+}
+
+template < typename F >
+const typename F::tensor_type& rfftn(
+    F *f, const typename F::real_tensor_type &x,
+    const typename F::tensor_type &y, typename F::size_storage dims) {
+  dims = dimensions(f, x, dims);
+  // The last dimension is halved by the real transform
+  rfft(f, x, y, dims[dims.size() - 1]);
+  for (typename F::dim_type i = 0; i + 1 < dims.size(); ++i) {
+    fft(f, y, y, dims[i], false);
+  }
+  return y;
+}
+
+template < typename F >
+const typename F::real_tensor_type& irfftn(
+    F *f, const typename F::tensor_type &x,
+    const typename F::real_tensor_type &y, typename F::size_storage dims) {
+  typedef typename F::tensor_type T;
+  dims = dimensions(f, x, dims);
+  if (dims.size() == 1) {
+    return irfft(f, x, y, dims[0]);
+  }
+  T t(x.size());
+  fft(f, x, t, dims[0], true);
+  for (typename F::dim_type i = 1; i + 1 < dims.size(); ++i) {
+    fft(f, t, t, dims[i], true);
+  }
+  return irfft(f, t, y, dims[dims.size() - 1]);
+}
+
+}  // namespace math
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_MATH_INL_HPP_
@@ -0,0 +1,81 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_MATH_HPP_
+#define THUNDER_FFT_MATH_HPP_
+
+#include <cstddef>
+
+namespace thunder {
+namespace fft {
+namespace math {
+
+// Call func(x_line, y_line, work) for each line of x and y along dimension d,
+// where lines are enumerated over the other dimensions and split between
+// threads. Each chunk of lines gets its own buffer of work elements of type C.
+// Cost is the number of elements along the line, used to size the chunks.
+template < typename C, typename X, typename Y, typename F >
+void forLines(const X &x, const Y &y, typename X::dim_type d,
+              ::std::size_t work, ::std::size_t cost, const F &func);
+
+// Check that x and y match except along dimension d, where y has size n
+template < typename X, typename Y >
+void checkSizes(const X &x, const Y &y, typename X::dim_type d,
+                ::std::size_t n);
+
+// Transform dimensions, checked against x. Empty dims selects all of them.
+template < typename F, typename X >
+typename F::size_storage dimensions(F *f, const X &x,
+                                    typename F::size_storage dims);
+
+template < typename F >
+const typename F::tensor_type& fft(
+    F *f, const typename F::tensor_type &x, const typename F::tensor_type &y,
+    typename F::dim_type d, bool inverse);
+
+template < typename F >
+const typename F::tensor_type& fftn(
+    F *f, const typename F::tensor_type &x, const typename F::tensor_type &y,
+    typename F::size_storage dims, bool inverse);
+
+template < typename F >
+const typename F::tensor_type& rfft(
+    F *f, const typename F::real_tensor_type &x,
+    const typename F::tensor_type &y, typename F::dim_type d);
+
+template < typename F >
+const typename F::real_tensor_type& irfft(
+    F *f, const typename F::tensor_type &x,
+    const typename F::real_tensor_type &y, typename F::dim_type d);
+
+template < typename F >
+const typename F::tensor_type& rfftn(
+    F *f, const typename F::real_tensor_type &x,
+    const typename F::tensor_type &y, typename F::size_storage dims);
+
+template < typename F >
+const typename F::real_tensor_type& irfftn(
+    F *f, const typename F::tensor_type &x,
+    const typename F::real_tensor_type &y, typename F::size_storage dims);
+
+}  // namespace math
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_MATH_HPP_
@@ -0,0 +1,413 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_PLAN_INL_HPP_
+#define THUNDER_FFT_PLAN_INL_HPP_
+
+#include "thunder/fft/plan.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "thunder/exception.hpp"
+
+namespace thunder {
+namespace fft {
+
+template < typename D >
+::std::complex< D > multiply(const ::std::complex< D > &a,
+                             const ::std::complex< D > &b) {
+  return ::std::complex< D >(a.real() * b.real() - a.imag() * b.imag(),
+                             a.real() * b.imag() + a.imag() * b.real());
+}
+
+template < typename D >
+Plan< D >::Plan(size_type n) : n_(n) {
+  if (n == 0) {
+    throw invalid_argument("Transform length evaluates to zero.");
+  }
+  // Radices of 4 first, then 2 and odd numbers in increasing order
+  size_type rest = n, p = 4;
+  bool bluestein = false;
+  do {
+    while (rest % p != 0) {
+      p = p == 4 ? 2 : (p == 2 ? 3 : p + 2);
+      if (p * p > rest) {
+        p = rest;
+      }
+    }
+    rest = rest / p;
+    factors_.push_back(p);
+    factors_.push_back(rest);
+    bluestein = bluestein || p > maxRadix;
+  } while (rest > 1);
+
+  const double pi = 3.14159265358979323846;
+  if (!bluestein) {
+    forward_.resize(n);
+    inverse_.resize(n);
+    for (size_type k = 0; k < n; ++k) {
+      ::std::complex< double > w = ::std::polar(
+          1.0, -2 * pi * static_cast< double >(k) / static_cast< double >(n));
+      forward_[k] = complex_type(w.real(), w.imag());
+      inverse_[k] = ::std::conj(forward_[k]);
+    }
+    return;
+  }
+
+  // Bluestein's algorithm writes j * k as (j^2 + k^2 - (k - j)^2) / 2, which
+  // turns the transform into a circular convolution of length m >= 2n - 1
+  factors_.clear();
+  size_type m = 1;
+  while (m < 2 * n - 1) {
+    m = m * 2;
+  }
+  convolution_ = get(m);
+  chirp_.resize(n);
+  for (size_type k = 0; k < n; ++k) {
+    // k^2 modulo 2n keeps the angle small for long transforms
+    unsigned long long k2 = static_cast< unsigned long long >(k) * k %
+        (2 * static_cast< unsigned long long >(n));
+    ::std::complex< double > w = ::std::polar(
+        1.0, -pi * static_cast< double >(k2) / static_cast< double >(n));
+    chirp_[k] = complex_type(w.real(), w.imag());
+  }
+  ::std::vector< complex_type > b(m, complex_type(0));
+  for (size_type k = 0; k < n; ++k) {
+    b[k] = ::std::conj(chirp_[k]) / static_cast< D >(m);
+    if (k > 0) {
+      b[m - k] = b[k];
+    }
+  }
+  kernel_.resize(m);
+  ::std::vector< complex_type > work(convolution_->workspace());
+  convolution_->execute(b.data(), 1, kernel_.data(), false, work.data());
+}
+
+template < typename D >
+::std::shared_ptr< const Plan< D > > Plan< D >::get(size_type n) {
+  static ::std::mutex mutex;
+  static ::std::map< size_type, ::std::shared_ptr< const Plan > > cache;
+  {
+    ::std::lock_guard< ::std::mutex > lock(mutex);
+    typename ::std::map< size_type, ::std::shared_ptr< const Plan > >::
+        const_iterator found = cache.find(n);
+    if (found != cache.end()) {
+      return found->second;
+    }
+  }
+  // Plans are built without the lock because Bluestein plans get their
+  // convolution plans from the cache. A plan built concurrently is dropped.
+  ::std::shared_ptr< const Plan > plan(new Plan(n));
+  ::std::lock_guard< ::std::mutex > lock(mutex);
+  return cache.insert(::std::make_pair(n, plan)).first->second;
+}
+
+template < typename D >
+typename Plan< D >::size_type Plan< D >::length() const {
+  return n_;
+}
+
+template < typename D >
+typename Plan< D >::size_type Plan< D >::workspace() const {
+  if (convolution_ == nullptr) {
+    return 0;
+  }
+  return 2 * kernel_.size() + convolution_->workspace();
+}
+
+template < typename D >
+void Plan< D >::execute(const complex_type *in, difference_type stride,
+                        complex_type *out, bool inverse,
+                        complex_type *work) const {
+  if (convolution_ != nullptr) {
+    bluestein(in, stride, out, inverse, work);
+    return;
+  }
+  recurse(out, in, stride, 1, factors_.data(),
+          inverse ? inverse_.data() : forward_.data(), inverse);
+}
+
+// Decimation in time: each of the p interleaved subsequences is transformed
+// into a contiguous block of length m, then the blocks are combined
+template < typename D >
+void Plan< D >::recurse(complex_type *out, const complex_type *in,
+                        difference_type stride, size_type fstride,
+                        const size_type *factors,
+                        const complex_type *twiddles, bool inverse) const {
+  size_type p = factors[0];
+  size_type m = factors[1];
+  difference_type step = static_cast< difference_type >(fstride) * stride;
+  if (m == 1) {
+    for (size_type q = 0; q < p; ++q, in += step) {
+      out[q] = *in;
+    }
+  } else {
+    for (size_type q = 0; q < p; ++q, in += step) {
+      recurse(out + q * m, in, stride, fstride * p, factors + 2, twiddles,
+              inverse);
+    }
+  }
+  switch (p) {
+    case 2:
+      butterfly2(out, fstride, m, twiddles);
+      break;
+    case 3:
+      butterfly3(out, fstride, m, twiddles);
+      break;
+    case 4:
+      butterfly4(out, fstride, m, twiddles, inverse);
+      break;
+    default:
+      butterfly(out, fstride, m, p, twiddles);
+      break;
+  }
+}
+
+template < typename D >
+void Plan< D >::butterfly2(complex_type *out, size_type fstride, size_type m,
+                           const complex_type *twiddles) const {
+  complex_type *out1 = out + m;
+  for (size_type k = 0; k < m; ++k) {
+    complex_type t = multiply(out1[k], twiddles[k * fstride]);
+    out1[k] = out[k] - t;
+    out[k] = out[k] + t;
+  }
+}
+
+template < typename D >
+void Plan< D >::butterfly3(complex_type *out, size_type fstride, size_type m,
+                           const complex_type *twiddles) const {
+  D sine = twiddles[fstride * m].imag();
+  for (size_type k = 0; k < m; ++k) {
+    complex_type s1 = multiply(out[k + m], twiddles[k * fstride]);
+    complex_type s2 = multiply(out[k + 2 * m], twiddles[2 * k * fstride]);
+    complex_type s3 = s1 + s2;
+    complex_type s0 = (s1 - s2) * sine;
+    complex_type c = out[k] - s3 * static_cast< D >(0.5);
+    out[k] = out[k] + s3;
+    out[k + m] = complex_type(c.real() - s0.imag(), c.imag() + s0.real());
+    out[k + 2 * m] = complex_type(c.real() + s0.imag(), c.imag() - s0.real());
+  }
+}
+
+template < typename D >
+void Plan< D >::butterfly4(complex_type *out, size_type fstride, size_type m,
+                           const complex_type *twiddles, bool inverse) const {
+  for (size_type k = 0; k < m; ++k) {
+    complex_type s0 = multiply(out[k + m], twiddles[k * fstride]);
+    complex_type s1 = multiply(out[k + 2 * m], twiddles[2 * k * fstride]);
+    complex_type s2 = multiply(out[k + 3 * m], twiddles[3 * k * fstride]);
+    complex_type s5 = out[k] - s1;
+    complex_type s4 = out[k] + s1;
+    complex_type s3 = s0 + s2;
+    // Rotation of s0 - s2 by -i, or by i for the inverse
+    complex_type t = s0 - s2;
+    t = inverse ? complex_type(-t.imag(), t.real()) :
+        complex_type(t.imag(), -t.real());
+    out[k] = s4 + s3;
+    out[k + m] = s5 + t;
+    out[k + 2 * m] = s4 - s3;
+    out[k + 3 * m] = s5 - t;
+  }
+}
+
+template < typename D >
+void Plan< D >::butterfly(complex_type *out, size_type fstride, size_type m,
+                          size_type p, const complex_type *twiddles) const {
+  complex_type scratch[maxRadix];
+  for (size_type k = 0; k < m; ++k) {
+    for (size_type q = 0; q < p; ++q) {
+      scratch[q] = out[k + q * m];
+    }
+    for (size_type q = 0; q < p; ++q) {
+      size_type j = k + q * m;
+      size_type index = 0;
+      complex_type sum = scratch[0];
+      for (size_type r = 1; r < p; ++r) {
+        index = index + fstride * j;
+        if (index >= n_) {
+          index = index - n_;
+        }
+        sum = sum + multiply(scratch[r], twiddles[index]);
+      }
+      out[j] = sum;
+    }
+  }
+}
+
+template < typename D >
+void Plan< D >::bluestein(const complex_type *in, difference_type stride,
+                          complex_type *out, bool inverse,
+                          complex_type *work) const {
+  // The inverse is the conjugate of the transform of the conjugate
+  size_type m = kernel_.size();
+  complex_type *a = work;
+  complex_type *b = work + m;
+  for (size_type k = 0; k < n_; ++k, in += stride) {
+    a[k] = multiply(inverse ? ::std::conj(*in) : *in, chirp_[k]);
+  }
+  for (size_type k = n_; k < m; ++k) {
+    a[k] = complex_type(0);
+  }
+  convolution_->execute(a, 1, b, false, work + 2 * m);
+  for (size_type k = 0; k < m; ++k) {
+    b[k] = multiply(b[k], kernel_[k]);
+  }
+  convolution_->execute(b, 1, a, true, work + 2 * m);
+  for (size_type k = 0; k < n_; ++k) {
+    complex_type v = multiply(a[k], chirp_[k]);
+    out[k] = inverse ? ::std::conj(v) : v;
+  }
+}
+
+template < typename D >
+RealPlan< D >::RealPlan(size_type n) : n_(n) {
+  if (n == 0) {
+    throw invalid_argument("Transform length evaluates to zero.");
+  }
+  if (n % 2 != 0) {
+    plan_ = Plan< D >::get(n);
+    return;
+  }
+  plan_ = Plan< D >::get(n / 2);
+  const double pi = 3.14159265358979323846;
+  twiddles_.resize(n / 2);
+  for (size_type k = 0; k < n / 2; ++k) {
+    ::std::complex< double > w = ::std::polar(
+        1.0, -2 * pi * static_cast< double >(k) / static_cast< double >(n));
+    twiddles_[k] = complex_type(w.real(), w.imag());
+  }
+}
+
+template < typename D >
+::std::shared_ptr< const RealPlan< D > > RealPlan< D >::get(size_type n) {
+  static ::std::mutex mutex;
+  static ::std::map< size_type, ::std::shared_ptr< const RealPlan > > cache;
+  {
+    ::std::lock_guard< ::std::mutex > lock(mutex);
+    typename ::std::map< size_type, ::std::shared_ptr< const RealPlan > >::
+        const_iterator found = cache.find(n);
+    if (found != cache.end()) {
+      return found->second;
+    }
+  }
+  ::std::shared_ptr< const RealPlan > plan(new RealPlan(n));
+  ::std::lock_guard< ::std::mutex > lock(mutex);
+  return cache.insert(::std::make_pair(n, plan)).first->second;
+}
+
+template < typename D >
+typename RealPlan< D >::size_type RealPlan< D >::length() const {
+  return n_;
+}
+
+template < typename D >
+typename RealPlan< D >::size_type RealPlan< D >::workspace() const {
+  return 2 * plan_->length() + plan_->workspace();
+}
+
+template < typename D >
+void RealPlan< D >::forward(const D *in, difference_type in_stride,
+                            complex_type *out, difference_type out_stride,
+                            complex_type *work) const {
+  // Length of the complex transform
+  size_type len = plan_->length();
+  complex_type *z = work + len;
+  if (n_ % 2 != 0) {
+    for (size_type j = 0; j < len; ++j, in += in_stride) {
+      work[j] = complex_type(*in);
+    }
+    plan_->execute(work, 1, z, false, work + 2 * len);
+    for (size_type k = 0; k <= len / 2; ++k, out += out_stride) {
+      *out = z[k];
+    }
+    return;
+  }
+
+  // Even and odd values are the real and imaginary parts of z, whose
+  // transform z[k] separates into the transforms of both halves
+  for (size_type j = 0; j < len; ++j, in += 2 * in_stride) {
+    work[j] = complex_type(in[0], in[in_stride]);
+  }
+  plan_->execute(work, 1, z, false, work + 2 * len);
+  *out = complex_type(z[0].real() + z[0].imag());
+  for (size_type k = 1; k < len; ++k) {
+    out += out_stride;
+    complex_type a = z[k];
+    complex_type b = ::std::conj(z[len - k]);
+    complex_type d = a - b;
+    complex_type o = multiply(twiddles_[k], complex_type(d.imag(), -d.real()));
+    *out = (a + b + o) * static_cast< D >(0.5);
+  }
+  out += out_stride;
+  *out = complex_type(z[0].real() - z[0].imag());
+}
+
+template < typename D >
+void RealPlan< D >::inverse(const complex_type *in, difference_type in_stride,
+                            D *out, difference_type out_stride,
+                            complex_type *work) const {
+  size_type len = plan_->length();
+  complex_type *z = work + len;
+  D scale = static_cast< D >(1) / static_cast< D >(n_);
+  if (n_ % 2 != 0) {
+    // The spectrum of real values is Hermitian
+    work[0] = complex_type(in->real());
+    for (size_type k = 1; k <= len / 2; ++k) {
+      in += in_stride;
+      work[k] = *in;
+      work[len - k] = ::std::conj(*in);
+    }
+    plan_->execute(work, 1, z, true, work + 2 * len);
+    for (size_type j = 0; j < len; ++j, out += out_stride) {
+      *out = z[j].real() * scale;
+    }
+    return;
+  }
+
+  // Spectrum values are read from both ends towards the middle
+  const complex_type *back = in + static_cast< difference_type >(len) *
+      in_stride;
+  work[0] = complex_type(in->real() + back->real(),
+                         in->real() - back->real());
+  for (size_type k = 1; k < len; ++k) {
+    in += in_stride;
+    back -= in_stride;
+    complex_type a = *in;
+    complex_type b = ::std::conj(*back);
+    complex_type o = multiply(a - b, ::std::conj(twiddles_[k]));
+    work[k] = a + b + complex_type(-o.imag(), o.real());
+  }
+  plan_->execute(work, 1, z, true, work + 2 * len);
+  for (size_type j = 0; j < len; ++j, out += 2 * out_stride) {
+    out[0] = z[j].real() * scale;
+    out[out_stride] = z[j].imag() * scale;
+  }
+}
+
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_PLAN_INL_HPP_
@@ -0,0 +1,131 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_FFT_PLAN_HPP_
+#define THUNDER_FFT_PLAN_HPP_
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace thunder {
+namespace fft {
+
+// Complex product without the recovery of infinities done by operator*
+template < typename D >
+::std::complex< D > multiply(const ::std::complex< D > &a,
+                             const ::std::complex< D > &b);
+
+// Precomputed mixed-radix transform of length n, factored into radices of 4,
+// 2 and odd primes. Lengths with a prime factor larger than maxRadix are
+// transformed with Bluestein's algorithm through a power-of-2 plan. Plans do
+// not depend on strides, so the cache is keyed on the length only.
+template < typename D >
+class Plan {
+ public:
+  typedef D value_type;
+  typedef ::std::complex< D > complex_type;
+  typedef ::std::size_t size_type;
+  typedef ::std::ptrdiff_t difference_type;
+
+  static const size_type maxRadix = 61;
+
+  explicit Plan(size_type n);
+
+  // Shared plan of length n, created on first use
+  static ::std::shared_ptr< const Plan > get(size_type n);
+
+  size_type length() const;
+
+  // Number of elements of the work buffer given to execute
+  size_type workspace() const;
+
+  // out[k] = sum_j in[j * stride] * exp(-+2 * pi * i * j * k / n), without
+  // normalization. The output is contiguous and must not overlap the input.
+  void execute(const complex_type *in, difference_type stride,
+               complex_type *out, bool inverse, complex_type *work) const;
+
+ private:
+  void recurse(complex_type *out, const complex_type *in,
+               difference_type stride, size_type fstride,
+               const size_type *factors, const complex_type *twiddles,
+               bool inverse) const;
+  void bluestein(const complex_type *in, difference_type stride,
+                 complex_type *out, bool inverse, complex_type *work) const;
+  void butterfly2(complex_type *out, size_type fstride, size_type m,
+                  const complex_type *twiddles) const;
+  void butterfly3(complex_type *out, size_type fstride, size_type m,
+                  const complex_type *twiddles) const;
+  void butterfly4(complex_type *out, size_type fstride, size_type m,
+                  const complex_type *twiddles, bool inverse) const;
+  void butterfly(complex_type *out, size_type fstride, size_type m,
+                 size_type p, const complex_type *twiddles) const;
+
+  size_type n_;
+  // Pairs of radix and remaining length, outermost first
+  ::std::vector< size_type > factors_;
+  // exp(-2 * pi * i * k / n) and its conjugate
+  ::std::vector< complex_type > forward_;
+  ::std::vector< complex_type > inverse_;
+  // Chirp exp(-pi * i * k^2 / n), transformed convolution kernel and the plan
+  // of the convolution used by Bluestein's algorithm
+  ::std::vector< complex_type > chirp_;
+  ::std::vector< complex_type > kernel_;
+  ::std::shared_ptr< const Plan > convolution_;
+};
+
+// Transform of n real values. Even lengths are transformed as n / 2 complex
+// values by a plan of half the length. Spectra hold the n / 2 + 1 coefficients
+// that are not redundant.
+template < typename D >
+class RealPlan {
+ public:
+  typedef D value_type;
+  typedef ::std::complex< D > complex_type;
+  typedef ::std::size_t size_type;
+  typedef ::std::ptrdiff_t difference_type;
+
+  explicit RealPlan(size_type n);
+
+  static ::std::shared_ptr< const RealPlan > get(size_type n);
+
+  size_type length() const;
+  size_type workspace() const;
+
+  // Forward transform without normalization
+  void forward(const D *in, difference_type in_stride, complex_type *out,
+               difference_type out_stride, complex_type *work) const;
+
+  // Inverse transform normalized by 1 / n. Imaginary parts of the first
+  // coefficient, and of the last one for even n, are ignored.
+  void inverse(const complex_type *in, difference_type in_stride, D *out,
+               difference_type out_stride, complex_type *work) const;
+
+ private:
+  size_type n_;
+  ::std::shared_ptr< const Plan< D > > plan_;
+  // exp(-2 * pi * i * k / n) for k < n / 2, used for even n
+  ::std::vector< complex_type > twiddles_;
+};
+
+}  // namespace fft
+}  // namespace thunder
+
+#endif  // THUNDER_FFT_PLAN_HPP_
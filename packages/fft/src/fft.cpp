@@ -0,0 +1,43 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/fft/fft.hpp"
+
+#include "thunder/fft/math.hpp"
+#include "thunder/fft/plan.hpp"
+#include "thunder/tensor.hpp"
+
+#include "thunder/fft/fft-inl.hpp"
+#include "thunder/fft/math-inl.hpp"
+#include "thunder/fft/plan-inl.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+
+namespace thunder {
+namespace fft {
+
+template class Plan< double >;
+template class Plan< float >;
+template class RealPlan< double >;
+template class RealPlan< float >;
+
+template class Fft< DoubleComplexTensor, DoubleTensor >;
+template class Fft< FloatComplexTensor, FloatTensor >;
+
+}  // namespace fft
+}  // namespace thunder
@@ -0,0 +1,225 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/fft.hpp"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+#include "gtest/gtest.h"
+#include "thunder/exception.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fillTensor(const T &t, int start) {
+  typedef typename T::value_type C;
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    *begin = C(static_cast< typename C::value_type >(val * 7 % 23) / 11 - 1,
+               static_cast< typename C::value_type >(val * 5 % 19) / 9 - 1);
+  }
+}
+
+template < typename TR >
+void fillRealTensor(const TR &t, int start) {
+  int val = start;
+  for (typename TR::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    *begin = static_cast< typename TR::value_type >(val * 7 % 23) / 11 - 1;
+  }
+}
+
+// Transform along dimension d computed coefficient by coefficient, for the
+// coefficients present in y
+template < typename T >
+void expectTransform(const T &x, const T &y, typename T::dim_type d,
+                     bool inverse) {
+  typedef typename T::value_type C;
+  typedef typename C::value_type D;
+  const double pi = 3.14159265358979323846;
+  typename T::size_type n = x.size(d);
+  D tolerance = ::std::numeric_limits< D >::epsilon() * 64 * n;
+  for (typename T::reference_iterator begin = y.reference_begin(),
+           end = y.reference_end(); begin != end; ++begin) {
+    typename T::size_storage pos = begin.position();
+    typename T::size_type k = pos[d];
+    ::std::complex< double > expected(0);
+    for (typename T::size_type j = 0; j < n; ++j) {
+      pos[d] = j;
+      C value = x(pos);
+      double angle = (inverse ? 2 : -2) * pi * static_cast< double >(
+          j * k % n) / static_cast< double >(n);
+      expected += ::std::complex< double >(value.real(), value.imag()) *
+          ::std::polar(1.0, angle);
+    }
+    if (inverse) {
+      expected /= static_cast< double >(n);
+    }
+    C actual = *begin;
+    EXPECT_NEAR(expected.real(), actual.real(), tolerance);
+    EXPECT_NEAR(expected.imag(), actual.imag(), tolerance);
+  }
+}
+
+template < typename T >
+void expectNear(const T &x, const T &y, typename T::value_type tolerance) {
+  ASSERT_EQ(x.dimension(), y.dimension());
+  for (typename T::dim_type d = 0; d < x.dimension(); ++d) {
+    ASSERT_EQ(x.size(d), y.size(d));
+  }
+  for (typename T::reference_iterator begin = x.reference_begin(),
+           end = x.reference_end(); begin != end; ++begin) {
+    EXPECT_NEAR(*begin, y(begin.position()), tolerance);
+  }
+}
+
+template < typename T >
+void expectComplexNear(const T &x, const T &y,
+                       typename T::value_type::value_type tolerance) {
+  ASSERT_EQ(x.dimension(), y.dimension());
+  for (typename T::dim_type d = 0; d < x.dimension(); ++d) {
+    ASSERT_EQ(x.size(d), y.size(d));
+  }
+  for (typename T::reference_iterator begin = x.reference_begin(),
+           end = x.reference_end(); begin != end; ++begin) {
+    typename T::value_type value = y(begin.position());
+    EXPECT_NEAR((*begin).real(), value.real(), tolerance);
+    EXPECT_NEAR((*begin).imag(), value.imag(), tolerance);
+  }
+}
+
+template < typename F >
+void complexTest() {
+  typedef typename F::tensor_type T;
+  typedef typename F::real_type D;
+  typedef typename T::size_storage size_storage;
+  F f;
+
+  // Radices of 2, 3, 4 and 5, generic odd radices up to 61, and Bluestein's
+  // algorithm for 67 and 97, on transposed and narrowed views
+  typename T::size_type lengths[] = {1, 2, 3, 4, 5, 6, 8, 12, 15, 16, 30, 49,
+                                     64, 67, 97, 122, 128};
+  for (typename T::size_type n : lengths) {
+    D tolerance = ::std::numeric_limits< D >::epsilon() * 64 * n;
+    T x = T(4, n + 2, 3).narrow(1, 1, n).transpose(0, 2);
+    fillTensor(x, n);
+    T y1 = f.fft(x, 1);
+    expectTransform(x, y1, 1, false);
+    T y2 = f.ifft(x, 1);
+    expectTransform(x, y2, 1, true);
+    expectComplexNear(x, f.ifft(y1, 1), tolerance);
+
+    // Outputs can be strided and the same as the input
+    T y3 = T(n, 4, 3).transpose(0, 2).transpose(1, 2);
+    f.fft(x, y3, 1);
+    expectComplexNear(y1, y3, tolerance);
+    f.ifft(y3, y3, 1);
+    expectComplexNear(x, y3, tolerance);
+    T y4 = f.fft(x, 2);
+    expectTransform(x, y4, 2, false);
+  }
+
+  // Multidimensional transforms apply one dimension after another
+  T x = T(size_storage({6, 5, 8}));
+  fillTensor(x, 3);
+  T y1 = f.fftn(x);
+  T y2 = f.fft(f.fft(f.fft(x, 0), 1), 2);
+  expectComplexNear(y2, y1, 1e-4);
+  expectComplexNear(x, f.ifftn(y1), 1e-4);
+  T y3 = f.fftn(x.transpose(0, 2), size_storage({0, 2}));
+  T y4 = f.fft(f.fft(x.transpose(0, 2), 0), 2);
+  expectComplexNear(y4, y3, 1e-4);
+
+  EXPECT_THROW(f.fft(x, 3), out_of_range);
+  EXPECT_THROW(f.fft(x, T(6, 5, 7), 2), out_of_range);
+  EXPECT_THROW(f.fft(x, T(6, 40), 1), out_of_range);
+  EXPECT_THROW(f.fftn(x, size_storage({1, 3})), out_of_range);
+  EXPECT_THROW(f.fftn(x, size_storage({1, 1})), invalid_argument);
+}
+
+template < typename F >
+void realTest() {
+  typedef typename F::tensor_type T;
+  typedef typename F::real_tensor_type TR;
+  typedef typename F::real_type D;
+  typedef typename T::size_storage size_storage;
+  F f;
+
+  // Even lengths go through complex transforms of half the length and odd
+  // lengths through complex transforms of the full length
+  typename T::size_type lengths[] = {1, 2, 3, 4, 5, 6, 7, 8, 10, 15, 16, 97,
+                                     100, 128, 194};
+  for (typename T::size_type n : lengths) {
+    D tolerance = ::std::numeric_limits< D >::epsilon() * 64 * n;
+    TR x = TR(n, 3).transpose();
+    fillRealTensor(x, n);
+    T y1 = f.rfft(x, 1);
+    EXPECT_EQ(n / 2 + 1, y1.size(1));
+    expectTransform(T(x), y1, 1, false);
+    expectNear(x, f.irfft(y1, n, 1), tolerance);
+
+    T y2 = T(n / 2 + 1, 3).transpose();
+    f.rfft(x, y2, 1);
+    expectComplexNear(y1, y2, tolerance);
+    TR x2 = TR(n, 3).transpose();
+    f.irfft(y2, x2, 1);
+    expectNear(x, x2, tolerance);
+  }
+
+  // Multidimensional real transforms hold the coefficients of the complex
+  // transform up to the middle of the last dimension
+  TR x = TR(size_storage({4, 6, 9}));
+  fillRealTensor(x, 5);
+  T y1 = f.rfftn(x, size_storage({2, 0}));
+  EXPECT_EQ(3, y1.size(0));
+  T y2 = f.fftn(T(x), size_storage({0, 2})).narrow(0, 0, 3);
+  expectComplexNear(y2, y1, 1e-4);
+  expectNear(x, f.irfftn(y1, 4, size_storage({2, 0})), 1e-4);
+  T y3 = f.rfftn(x);
+  EXPECT_EQ(5, y3.size(2));
+  expectNear(x, f.irfftn(y3, 9), 1e-4);
+
+  EXPECT_THROW(f.rfft(x, T(4, 6, 4), 2), out_of_range);
+  EXPECT_THROW(f.irfft(y3, TR(4, 6, 10), 2), out_of_range);
+  EXPECT_THROW(f.rfft(x, 3), out_of_range);
+}
+
+TEST(FftTest, doubleComplexTest) {
+  complexTest< DoubleFft >();
+}
+
+TEST(FftTest, floatComplexTest) {
+  complexTest< FloatFft >();
+}
+
+TEST(FftTest, doubleRealTest) {
+  realTest< DoubleFft >();
+}
+
+TEST(FftTest, floatRealTest) {
+  realTest< FloatFft >();
+}
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,51 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_LINALG_HPP_
+#define THUNDER_LINALG_HPP_
+
+#include "thunder/linalg/blas.hpp"
+
+#include "thunder/linalg/math.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+
+template < typename T = DoubleTensor >
+using Blas = linalg::Blas< T >;
+
+typedef Blas< DoubleTensor > DoubleBlas;
+typedef Blas< FloatTensor > FloatBlas;
+typedef Blas< DoubleComplexTensor > DoubleComplexBlas;
+typedef Blas< FloatComplexTensor > FloatComplexBlas;
+
+}  // namespace thunder
+
+namespace thunder {
+namespace linalg {
+
+extern template class Blas< DoubleTensor >;
+extern template class Blas< FloatTensor >;
+extern template class Blas< DoubleComplexTensor >;
+extern template class Blas< FloatComplexTensor >;
+
+}  // namespace linalg
+}  // namespace thunder
+
+#endif  // THUNDER_LINALG_HPP_
@@ -0,0 +1,139 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_LINALG_BLAS_INL_HPP_
+#define THUNDER_LINALG_BLAS_INL_HPP_
+
+#include "thunder/linalg/blas.hpp"
+
+#include "thunder/exception.hpp"
+#include "thunder/linalg/math.hpp"
+
+namespace thunder {
+namespace linalg {
+
+template < typename T >
+Blas< T >::Blas() {}
+
+template < typename T >
+typename Blas< T >::value_type Blas< T >::dot(const T &x, const T &y) {
+  return math::dot< Blas >(this, x, y);
+}
+
+template < typename T >
+const T& Blas< T >::axpy(const T &x, const T &y, value_type a) {
+  return math::axpy< Blas >(this, x, y, a);
+}
+
+template < typename T >
+T& Blas< T >::axpy(const T &x, T &y, value_type a) {
+  return const_cast< T& >(axpy(x, const_cast< const T& >(y), a));
+}
+
+template < typename T >
+T Blas< T >::gemv(const T &a, const T &x) {
+  if (a.dimension() != 2) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  T y(a.size(0));
+  gemv(a, x, y, 1, 0);
+  return y;
+}
+
+template < typename T >
+const T& Blas< T >::gemv(const T &a, const T &x, const T &y, value_type alpha,
+                         value_type beta) {
+  return math::gemv< Blas >(this, a, x, y, alpha, beta);
+}
+
+template < typename T >
+T& Blas< T >::gemv(const T &a, const T &x, T &y, value_type alpha,
+                   value_type beta) {
+  return const_cast< T& >(
+      gemv(a, x, const_cast< const T& >(y), alpha, beta));
+}
+
+template < typename T >
+T Blas< T >::ger(const T &x, const T &y) {
+  T a(x.length(), y.length());
+  a.zero();
+  ger(x, y, a, 1);
+  return a;
+}
+
+template < typename T >
+const T& Blas< T >::ger(const T &x, const T &y, const T &a, value_type alpha) {
+  return math::ger< Blas >(this, x, y, a, alpha);
+}
+
+template < typename T >
+T& Blas< T >::ger(const T &x, const T &y, T &a, value_type alpha) {
+  return const_cast< T& >(ger(x, y, const_cast< const T& >(a), alpha));
+}
+
+template < typename T >
+T Blas< T >::gemm(const T &a, const T &b) {
+  if (a.dimension() != 2 || b.dimension() != 2) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  T c(a.size(0), b.size(1));
+  gemm(a, b, c, 1, 0);
+  return c;
+}
+
+template < typename T >
+const T& Blas< T >::gemm(const T &a, const T &b, const T &c, value_type alpha,
+                         value_type beta) {
+  return math::gemm< Blas >(this, a, b, c, alpha, beta);
+}
+
+template < typename T >
+T& Blas< T >::gemm(const T &a, const T &b, T &c, value_type alpha,
+                   value_type beta) {
+  return const_cast< T& >(
+      gemm(a, b, const_cast< const T& >(c), alpha, beta));
+}
+
+template < typename T >
+T Blas< T >::bmm(const T &a, const T &b) {
+  if (a.dimension() != 3 || b.dimension() != 3) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  T c(a.size(0), a.size(1), b.size(2));
+  bmm(a, b, c, 1, 0);
+  return c;
+}
+
+template < typename T >
+const T& Blas< T >::bmm(const T &a, const T &b, const T &c, value_type alpha,
+                        value_type beta) {
+  return math::bmm< Blas >(this, a, b, c, alpha, beta);
+}
+
+template < typename T >
+T& Blas< T >::bmm(const T &a, const T &b, T &c, value_type alpha,
+                  value_type beta) {
+  return const_cast< T& >(
+      bmm(a, b, const_cast< const T& >(c), alpha, beta));
+}
+
+}  // namespace linalg
+}  // namespace thunder
+
+#endif  // THUNDER_LINALG_BLAS_INL_HPP_
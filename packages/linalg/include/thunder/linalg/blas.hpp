@@ -0,0 +1,77 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_LINALG_BLAS_HPP_
+#define THUNDER_LINALG_BLAS_HPP_
+
+namespace thunder {
+namespace linalg {
+
+template < typename T >
+class Blas {
+ public:
+  typedef T tensor_type;
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+  typedef typename T::size_storage size_storage;
+
+  explicit Blas();
+
+  // Level 1 routines. Vectors are tensors of any shape and matching length.
+  value_type dot(const T &x, const T &y);
+
+  // y = a * x + y
+  const T& axpy(const T &x, const T &y, value_type a = 1);
+  T& axpy(const T &x, T &y, value_type a = 1);
+
+  // Level 2 routines. Matrices are 2-dimensional tensors of any stride.
+  // y = alpha * a * x + beta * y
+  T gemv(const T &a, const T &x);
+  const T& gemv(const T &a, const T &x, const T &y, value_type alpha = 1,
+                value_type beta = 0);
+  T& gemv(const T &a, const T &x, T &y, value_type alpha = 1,
+          value_type beta = 0);
+
+  // a = alpha * x * y^T + a
+  T ger(const T &x, const T &y);
+  const T& ger(const T &x, const T &y, const T &a, value_type alpha = 1);
+  T& ger(const T &x, const T &y, T &a, value_type alpha = 1);
+
+  // Level 3 routines
+  // c = alpha * a * b + beta * c
+  T gemm(const T &a, const T &b);
+  const T& gemm(const T &a, const T &b, const T &c, value_type alpha = 1,
+                value_type beta = 0);
+  T& gemm(const T &a, const T &b, T &c, value_type alpha = 1,
+          value_type beta = 0);
+
+  // Batched level 3 routines. Batches are the first dimension of 3-dimensional
+  // tensors of any stride.
+  // c[i] = alpha * a[i] * b[i] + beta * c[i]
+  T bmm(const T &a, const T &b);
+  const T& bmm(const T &a, const T &b, const T &c, value_type alpha = 1,
+               value_type beta = 0);
+  T& bmm(const T &a, const T &b, T &c, value_type alpha = 1,
+         value_type beta = 0);
+};
+
+}  // namespace linalg
+}  // namespace thunder
+
+#endif  // THUNDER_LINALG_BLAS_HPP_
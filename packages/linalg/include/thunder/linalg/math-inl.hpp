@@ -0,0 +1,481 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_LINALG_MATH_INL_HPP_
+#define THUNDER_LINALG_MATH_INL_HPP_
+
+#include "thunder/linalg/math.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#include "thunder/exception.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace linalg {
+namespace math {
+
+template < typename B >
+typename B::value_type dot(
+    B *, const typename B::tensor_type &x,
+    const typename B::tensor_type &y) {
+  typedef typename B::tensor_type T;
+  typedef typename T::value_type D;
+  if (x.length() != y.length()) {
+    throw out_of_range("Tensors have different length.");
+  }
+  if (x.partialContiguity(0, x.dimension() - 1) &&
+      y.partialContiguity(0, y.dimension() - 1)) {
+    typename T::pointer x_pointer = x.data();
+    typename T::difference_type x_step = x.stride(x.dimension() - 1);
+    typename T::pointer y_pointer = y.data();
+    typename T::difference_type y_step = y.stride(y.dimension() - 1);
+    typename T::size_type length = x.length();
+    // Independent accumulators break the dependency chain of the additions
+    D sum[4] = {D(0), D(0), D(0), D(0)};
+    typename T::size_type i = 0;
+    for (; i + 4 <= length; i += 4) {
+      sum[0] += x_pointer[i * x_step] * y_pointer[i * y_step];
+      sum[1] += x_pointer[(i + 1) * x_step] * y_pointer[(i + 1) * y_step];
+      sum[2] += x_pointer[(i + 2) * x_step] * y_pointer[(i + 2) * y_step];
+      sum[3] += x_pointer[(i + 3) * x_step] * y_pointer[(i + 3) * y_step];
+    }
+    for (; i < length; ++i) {
+      sum[0] += x_pointer[i * x_step] * y_pointer[i * y_step];
+    }
+    return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+  }
+  D sum = D(0);
+  for (typename T::reference_iterator x_begin = x.reference_begin(),
+           x_end = x.reference_end(), y_begin = y.reference_begin();
+       x_begin != x_end; ++x_begin, ++y_begin) {
+    sum += (*x_begin) * (*y_begin);
+  }
+  return sum;
+}
+
+template < typename B >
+const typename B::tensor_type& axpy(
+    B *, const typename B::tensor_type &x,
+    const typename B::tensor_type &y, typename B::value_type a) {
+  typedef typename B::tensor_type T;
+  if (x.length() != y.length()) {
+    throw out_of_range("Tensors have different length.");
+  }
+  y.detach();
+  tensor::parallel::forEach(y, x, [&a](typename T::reference y_ref,
+                                       typename T::reference x_ref) {
+      y_ref = a * x_ref + y_ref;
+    });
+  return y;
+}
+
+template < typename B >
+const typename B::tensor_type& gemv(
+    B *, const typename B::tensor_type &a,
+    const typename B::tensor_type &x, const typename B::tensor_type &y,
+    typename B::value_type alpha, typename B::value_type beta) {
+  typedef typename B::tensor_type T;
+  typedef typename T::value_type D;
+  if (a.dimension() != 2) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  typename T::size_type m = a.size(0);
+  typename T::size_type n = a.size(1);
+  if (x.length() != n || y.length() != m) {
+    throw out_of_range("Size mismatches.");
+  }
+  y.detach();
+
+  // Vectors that cannot be addressed with a single step are copied
+  T x_vector = x.partialContiguity(0, x.dimension() - 1) ?
+      x : T(n).copy(x);
+  T y_vector = y.partialContiguity(0, y.dimension() - 1) ?
+      y : T(m).copy(y);
+  typename T::pointer a_pointer = a.data();
+  typename T::difference_type a_row = a.stride(0);
+  typename T::difference_type a_column = a.stride(1);
+  typename T::pointer x_pointer = x_vector.data();
+  typename T::difference_type x_step =
+      x_vector.stride(x_vector.dimension() - 1);
+  typename T::pointer y_pointer = y_vector.data();
+  typename T::difference_type y_step =
+      y_vector.stride(y_vector.dimension() - 1);
+
+  tensor::parallel::forRange(
+      m, tensor::parallel::getGrain() / (n + 1) + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        if (::std::abs(a_column) <= ::std::abs(a_row)) {
+          // Rows are dense, so compute one dot product per row
+          for (::std::size_t i = begin; i < end; ++i) {
+            const D *a_vector = a_pointer + i * a_row;
+            D sum[2] = {D(0), D(0)};
+            typename T::size_type j = 0;
+            for (; j + 2 <= n; j += 2) {
+              sum[0] += a_vector[j * a_column] * x_pointer[j * x_step];
+              sum[1] += a_vector[(j + 1) * a_column] *
+                  x_pointer[(j + 1) * x_step];
+            }
+            for (; j < n; ++j) {
+              sum[0] += a_vector[j * a_column] * x_pointer[j * x_step];
+            }
+            D &y_ref = y_pointer[i * y_step];
+            y_ref = beta == D(0) ? alpha * (sum[0] + sum[1]) :
+                alpha * (sum[0] + sum[1]) + beta * y_ref;
+          }
+        } else {
+          // Columns are dense, so accumulate scaled columns into y
+          for (::std::size_t i = begin; i < end; ++i) {
+            D &y_ref = y_pointer[i * y_step];
+            y_ref = beta == D(0) ? D(0) : beta * y_ref;
+          }
+          for (typename T::size_type j = 0; j < n; ++j) {
+            D scale = alpha * x_pointer[j * x_step];
+            const D *a_vector = a_pointer + j * a_column;
+            for (::std::size_t i = begin; i < end; ++i) {
+              y_pointer[i * y_step] += scale * a_vector[i * a_row];
+            }
+          }
+        }
+      });
+
+  if (y_vector.data() != y.data()) {
+    y.copy(y_vector);
+  }
+  return y;
+}
+
+template < typename B >
+const typename B::tensor_type& ger(
+    B *, const typename B::tensor_type &x,
+    const typename B::tensor_type &y, const typename B::tensor_type &a,
+    typename B::value_type alpha) {
+  typedef typename B::tensor_type T;
+  typedef typename T::value_type D;
+  if (a.dimension() != 2) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  typename T::size_type m = a.size(0);
+  typename T::size_type n = a.size(1);
+  if (x.length() != m || y.length() != n) {
+    throw out_of_range("Size mismatches.");
+  }
+  a.detach();
+
+  T x_vector = x.partialContiguity(0, x.dimension() - 1) ?
+      x : T(m).copy(x);
+  T y_vector = y.partialContiguity(0, y.dimension() - 1) ?
+      y : T(n).copy(y);
+  typename T::pointer a_pointer = a.data();
+  typename T::difference_type a_row = a.stride(0);
+  typename T::difference_type a_column = a.stride(1);
+  typename T::pointer x_pointer = x_vector.data();
+  typename T::difference_type x_step =
+      x_vector.stride(x_vector.dimension() - 1);
+  typename T::pointer y_pointer = y_vector.data();
+  typename T::difference_type y_step =
+      y_vector.stride(y_vector.dimension() - 1);
+
+  tensor::parallel::forRange(
+      m, tensor::parallel::getGrain() / (n + 1) + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t i = begin; i < end; ++i) {
+          D scale = alpha * x_pointer[i * x_step];
+          D *a_vector = a_pointer + i * a_row;
+          for (typename T::size_type j = 0; j < n; ++j) {
+            a_vector[j * a_column] += scale * y_pointer[j * y_step];
+          }
+        }
+      });
+  return a;
+}
+
+template < typename B >
+const typename B::tensor_type& gemm(
+    B *, const typename B::tensor_type &a,
+    const typename B::tensor_type &b, const typename B::tensor_type &c,
+    typename B::value_type alpha, typename B::value_type beta) {
+  typedef typename B::tensor_type T;
+  typedef typename T::value_type D;
+  if (a.dimension() != 2 || b.dimension() != 2 || c.dimension() != 2) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  ::std::size_t m = a.size(0);
+  ::std::size_t n = b.size(1);
+  ::std::size_t k = a.size(1);
+  if (b.size(0) != k || c.size(0) != m || c.size(1) != n) {
+    throw out_of_range("Size mismatches.");
+  }
+
+  c.detach();
+  if (beta == D(0)) {
+    c.zero();
+  } else if (beta != D(1)) {
+    c.mul(beta);
+  }
+  if (k == 0 || alpha == D(0)) {
+    return c;
+  }
+
+  const ::std::size_t mr = GemmBlocking< D >::mr;
+  const ::std::size_t nr = GemmBlocking< D >::nr;
+  const ::std::size_t mc = GemmBlocking< D >::mc;
+  const ::std::size_t kc = GemmBlocking< D >::kc;
+  const ::std::size_t nc = GemmBlocking< D >::nc;
+  // Work is scheduled in tiles of mc rows and nr * 16 columns
+  const ::std::size_t tile = nr * 16;
+
+  typename T::pointer a_pointer = a.data();
+  typename T::difference_type a_row = a.stride(0);
+  typename T::difference_type a_column = a.stride(1);
+  typename T::pointer b_pointer = b.data();
+  typename T::difference_type b_row = b.stride(0);
+  typename T::difference_type b_column = b.stride(1);
+  typename T::pointer c_pointer = c.data();
+  typename T::difference_type c_row = c.stride(0);
+  typename T::difference_type c_column = c.stride(1);
+
+  ::std::vector< D > b_buffer(
+      ((::std::min(n, nc) + nr - 1) / nr) * nr * ::std::min(k, kc));
+  for (::std::size_t jc = 0; jc < n; jc += nc) {
+    ::std::size_t n_block = ::std::min(n - jc, nc);
+    for (::std::size_t pc = 0; pc < k; pc += kc) {
+      ::std::size_t k_block = ::std::min(k - pc, kc);
+      gemmPackB(k_block, n_block, b_pointer + pc * b_row + jc * b_column,
+                b_row, b_column, b_buffer.data());
+
+      ::std::size_t m_tiles = (m + mc - 1) / mc;
+      ::std::size_t n_tiles = (n_block + tile - 1) / tile;
+      tensor::parallel::forRange(
+          m_tiles * n_tiles, 1, [&](::std::size_t begin, ::std::size_t end) {
+            ::std::vector< D > a_buffer(mc * k_block);
+            ::std::size_t packed = m_tiles;
+            for (::std::size_t t = begin; t < end; ++t) {
+              ::std::size_t ic = (t / n_tiles) * mc;
+              ::std::size_t m_block = ::std::min(m - ic, mc);
+              if (packed != t / n_tiles) {
+                packed = t / n_tiles;
+                gemmPackA(m_block, k_block,
+                          a_pointer + ic * a_row + pc * a_column, a_row,
+                          a_column, a_buffer.data());
+              }
+              ::std::size_t j_begin = (t % n_tiles) * tile;
+              ::std::size_t j_end = ::std::min(n_block, j_begin + tile);
+              for (::std::size_t jr = j_begin; jr < j_end; jr += nr) {
+                for (::std::size_t ir = 0; ir < m_block; ir += mr) {
+                  gemmKernel(k_block, a_buffer.data() + ir * k_block,
+                             b_buffer.data() + jr * k_block,
+                             c_pointer + (ic + ir) * c_row +
+                             (jc + jr) * c_column,
+                             c_row, c_column, ::std::min(m_block - ir, mr),
+                             ::std::min(j_end - jr, nr), alpha);
+                }
+              }
+            }
+          });
+    }
+  }
+  return c;
+}
+
+template < typename B >
+const typename B::tensor_type& bmm(
+    B *, const typename B::tensor_type &a,
+    const typename B::tensor_type &b, const typename B::tensor_type &c,
+    typename B::value_type alpha, typename B::value_type beta) {
+  typedef typename B::tensor_type T;
+  typedef typename T::value_type D;
+  if (a.dimension() != 3 || b.dimension() != 3 || c.dimension() != 3) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  ::std::size_t batch = a.size(0);
+  ::std::size_t m = a.size(1);
+  ::std::size_t n = b.size(2);
+  ::std::size_t k = a.size(2);
+  if (b.size(0) != batch || c.size(0) != batch || b.size(1) != k ||
+      c.size(1) != m || c.size(2) != n) {
+    throw out_of_range("Size mismatches.");
+  }
+
+  c.detach();
+  if (beta == D(0)) {
+    c.zero();
+  } else if (beta != D(1)) {
+    c.mul(beta);
+  }
+  if (k == 0 || alpha == D(0)) {
+    return c;
+  }
+
+  const ::std::size_t mr = GemmBlocking< D >::mr;
+  const ::std::size_t nr = GemmBlocking< D >::nr;
+  const ::std::size_t mc = GemmBlocking< D >::mc;
+  const ::std::size_t kc = GemmBlocking< D >::kc;
+  // Small matrices are one task each, and larger ones are split in tiles of
+  // mc rows and nr * 16 columns that pack their own panels of a and b
+  const ::std::size_t tile = nr * 16;
+  ::std::size_t m_tiles = (m + mc - 1) / mc;
+  ::std::size_t n_tiles = (n + tile - 1) / tile;
+  ::std::size_t tiles = m_tiles * n_tiles;
+
+  typename T::pointer a_pointer = a.data();
+  typename T::difference_type a_batch = a.stride(0);
+  typename T::difference_type a_row = a.stride(1);
+  typename T::difference_type a_column = a.stride(2);
+  typename T::pointer b_pointer = b.data();
+  typename T::difference_type b_batch = b.stride(0);
+  typename T::difference_type b_row = b.stride(1);
+  typename T::difference_type b_column = b.stride(2);
+  typename T::pointer c_pointer = c.data();
+  typename T::difference_type c_batch = c.stride(0);
+  typename T::difference_type c_row = c.stride(1);
+  typename T::difference_type c_column = c.stride(2);
+
+  tensor::parallel::forRange(
+      batch * tiles, 1, [&](::std::size_t begin, ::std::size_t end) {
+        ::std::vector< D > a_buffer(
+            ((::std::min(m, mc) + mr - 1) / mr) * mr * ::std::min(k, kc));
+        ::std::vector< D > b_buffer(
+            ((::std::min(n, tile) + nr - 1) / nr) * nr * ::std::min(k, kc));
+        for (::std::size_t t = begin; t < end; ++t) {
+          ::std::size_t l = t / tiles;
+          ::std::size_t ic = (t % tiles) / n_tiles * mc;
+          ::std::size_t jc = (t % n_tiles) * tile;
+          gemmBlock(::std::min(m - ic, mc), ::std::min(n - jc, tile), k,
+                    a_pointer + l * a_batch + ic * a_row, a_row, a_column,
+                    b_pointer + l * b_batch + jc * b_column, b_row, b_column,
+                    c_pointer + l * c_batch + ic * c_row + jc * c_column,
+                    c_row, c_column, alpha, a_buffer.data(),
+                    b_buffer.data());
+        }
+      });
+  return c;
+}
+
+template < typename D >
+void gemmPackA(::std::size_t mc, ::std::size_t kc, const D *a,
+               ::std::ptrdiff_t a_row, ::std::ptrdiff_t a_column, D *buffer) {
+  const ::std::size_t mr = GemmBlocking< D >::mr;
+  for (::std::size_t ir = 0; ir < mc; ir += mr) {
+    ::std::size_t m = ::std::min(mc - ir, mr);
+    for (::std::size_t p = 0; p < kc; ++p) {
+      for (::std::size_t i = 0; i < m; ++i) {
+        buffer[i] = a[(ir + i) * a_row + p * a_column];
+      }
+      for (::std::size_t i = m; i < mr; ++i) {
+        buffer[i] = D(0);
+      }
+      buffer += mr;
+    }
+  }
+}
+
+template < typename D >
+void gemmPackB(::std::size_t kc, ::std::size_t nc, const D *b,
+               ::std::ptrdiff_t b_row, ::std::ptrdiff_t b_column, D *buffer) {
+  const ::std::size_t nr = GemmBlocking< D >::nr;
+  for (::std::size_t jr = 0; jr < nc; jr += nr) {
+    ::std::size_t n = ::std::min(nc - jr, nr);
+    for (::std::size_t p = 0; p < kc; ++p) {
+      for (::std::size_t j = 0; j < n; ++j) {
+        buffer[j] = b[p * b_row + (jr + j) * b_column];
+      }
+      for (::std::size_t j = n; j < nr; ++j) {
+        buffer[j] = D(0);
+      }
+      buffer += nr;
+    }
+  }
+}
+
+template < typename D >
+void gemmKernel(::std::size_t kc, const D *a, const D *b, D *c,
+                ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column,
+                ::std::size_t m, ::std::size_t n, D alpha) {
+  const ::std::size_t mr = GemmBlocking< D >::mr;
+  const ::std::size_t nr = GemmBlocking< D >::nr;
+  // The accumulator block is small enough to live in vector registers
+  D ab[mr * nr];
+  for (::std::size_t i = 0; i < mr * nr; ++i) {
+    ab[i] = D(0);
+  }
+  for (::std::size_t p = 0; p < kc; ++p) {
+    for (::std::size_t i = 0; i < mr; ++i) {
+      D a_value = a[i];
+      for (::std::size_t j = 0; j < nr; ++j) {
+        ab[i * nr + j] += a_value * b[j];
+      }
+    }
+    a += mr;
+    b += nr;
+  }
+  for (::std::size_t i = 0; i < m; ++i) {
+    for (::std::size_t j = 0; j < n; ++j) {
+      c[i * c_row + j * c_column] += alpha * ab[i * nr + j];
+    }
+  }
+}
+
+template < >
+inline void gemmKernel< double >(
+    ::std::size_t kc, const double *a, const double *b, double *c,
+    ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+    ::std::size_t n, double alpha) {
+  tensor::simd::gemm(kc, a, b, c, c_row, c_column, m, n, alpha);
+}
+
+template < >
+inline void gemmKernel< float >(
+    ::std::size_t kc, const float *a, const float *b, float *c,
+    ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+    ::std::size_t n, float alpha) {
+  tensor::simd::gemm(kc, a, b, c, c_row, c_column, m, n, alpha);
+}
+
+template < typename D >
+void gemmBlock(::std::size_t m, ::std::size_t n, ::std::size_t k, const D *a,
+               ::std::ptrdiff_t a_row, ::std::ptrdiff_t a_column, const D *b,
+               ::std::ptrdiff_t b_row, ::std::ptrdiff_t b_column, D *c,
+               ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, D alpha,
+               D *a_buffer, D *b_buffer) {
+  const ::std::size_t mr = GemmBlocking< D >::mr;
+  const ::std::size_t nr = GemmBlocking< D >::nr;
+  const ::std::size_t kc = GemmBlocking< D >::kc;
+  for (::std::size_t pc = 0; pc < k; pc += kc) {
+    ::std::size_t k_block = ::std::min(k - pc, kc);
+    gemmPackA(m, k_block, a + pc * a_column, a_row, a_column, a_buffer);
+    gemmPackB(k_block, n, b + pc * b_row, b_row, b_column, b_buffer);
+    for (::std::size_t jr = 0; jr < n; jr += nr) {
+      for (::std::size_t ir = 0; ir < m; ir += mr) {
+        gemmKernel(k_block, a_buffer + ir * k_block, b_buffer + jr * k_block,
+                   c + ir * c_row + jr * c_column, c_row, c_column,
+                   ::std::min(m - ir, mr), ::std::min(n - jr, nr), alpha);
+      }
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace linalg
+}  // namespace thunder
+
+#endif  // THUNDER_LINALG_MATH_INL_HPP_
@@ -0,0 +1,121 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_LINALG_MATH_HPP_
+#define THUNDER_LINALG_MATH_HPP_
+
+#include <cstddef>
+
+#include "thunder/tensor/simd.hpp"
+
+namespace thunder {
+namespace linalg {
+namespace math {
+
+template < typename B >
+typename B::value_type dot(
+    B *blas, const typename B::tensor_type &x,
+    const typename B::tensor_type &y);
+
+template < typename B >
+const typename B::tensor_type& axpy(
+    B *blas, const typename B::tensor_type &x,
+    const typename B::tensor_type &y, typename B::value_type a);
+
+template < typename B >
+const typename B::tensor_type& gemv(
+    B *blas, const typename B::tensor_type &a,
+    const typename B::tensor_type &x, const typename B::tensor_type &y,
+    typename B::value_type alpha, typename B::value_type beta);
+
+template < typename B >
+const typename B::tensor_type& ger(
+    B *blas, const typename B::tensor_type &x,
+    const typename B::tensor_type &y, const typename B::tensor_type &a,
+    typename B::value_type alpha);
+
+template < typename B >
+const typename B::tensor_type& gemm(
+    B *blas, const typename B::tensor_type &a,
+    const typename B::tensor_type &b, const typename B::tensor_type &c,
+    typename B::value_type alpha, typename B::value_type beta);
+
+template < typename B >
+const typename B::tensor_type& bmm(
+    B *blas, const typename B::tensor_type &a,
+    const typename B::tensor_type &b, const typename B::tensor_type &c,
+    typename B::value_type alpha, typename B::value_type beta);
+
+// Blocking parameters of gemm. Panels of mr rows of a and nr columns of b are
+// multiplied in registers, kc x nr panels of b stay in L1, mc x kc blocks of
+// a in L2 and kc x nc panels of b in L3. mc is a multiple of mr. Real types
+// use the register tiles of the vectorized kernels.
+template < typename D >
+struct GemmBlocking {
+  static const ::std::size_t mr = 4;
+  static const ::std::size_t nr = 8;
+  static const ::std::size_t mc = 96;
+  static const ::std::size_t kc = 256;
+  static const ::std::size_t nc = 2048;
+};
+template < >
+struct GemmBlocking< double > {
+  static const ::std::size_t mr = tensor::simd::GemmTile< double >::m;
+  static const ::std::size_t nr = tensor::simd::GemmTile< double >::n;
+  static const ::std::size_t mc = 96;
+  static const ::std::size_t kc = 256;
+  static const ::std::size_t nc = 2048;
+};
+template < >
+struct GemmBlocking< float > {
+  static const ::std::size_t mr = tensor::simd::GemmTile< float >::m;
+  static const ::std::size_t nr = tensor::simd::GemmTile< float >::n;
+  static const ::std::size_t mc = 120;
+  static const ::std::size_t kc = 384;
+  static const ::std::size_t nc = 2048;
+};
+
+// Packing of a into mr-row panels and of b into nr-column panels, padded with
+// zeros. The kernel computes c = c + alpha * a * b for one packed panel of
+// each, writing only the first m rows and n columns of c.
+template < typename D >
+void gemmPackA(::std::size_t mc, ::std::size_t kc, const D *a,
+               ::std::ptrdiff_t a_row, ::std::ptrdiff_t a_column, D *buffer);
+template < typename D >
+void gemmPackB(::std::size_t kc, ::std::size_t nc, const D *b,
+               ::std::ptrdiff_t b_row, ::std::ptrdiff_t b_column, D *buffer);
+template < typename D >
+void gemmKernel(::std::size_t kc, const D *a, const D *b, D *c,
+                ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column,
+                ::std::size_t m, ::std::size_t n, D alpha);
+
+// Computes c = c + alpha * a * b for an m x n block of c with m <= mc, looping
+// over k in panels of kc. The buffers hold packed panels of a and b.
+template < typename D >
+void gemmBlock(::std::size_t m, ::std::size_t n, ::std::size_t k, const D *a,
+               ::std::ptrdiff_t a_row, ::std::ptrdiff_t a_column, const D *b,
+               ::std::ptrdiff_t b_row, ::std::ptrdiff_t b_column, D *c,
+               ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, D alpha,
+               D *a_buffer, D *b_buffer);
+
+}  // namespace math
+}  // namespace linalg
+}  // namespace thunder
+
+#endif  // THUNDER_LINALG_MATH_HPP_
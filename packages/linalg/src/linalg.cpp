@@ -0,0 +1,38 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/linalg/blas.hpp"
+
+#include "thunder/linalg/math.hpp"
+#include "thunder/tensor.hpp"
+
+#include "thunder/linalg/blas-inl.hpp"
+#include "thunder/linalg/math-inl.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+
+namespace thunder {
+namespace linalg {
+
+template class Blas< DoubleTensor >;
+template class Blas< FloatTensor >;
+template class Blas< DoubleComplexTensor >;
+template class Blas< FloatComplexTensor >;
+
+}  // namespace linalg
+}  // namespace thunder
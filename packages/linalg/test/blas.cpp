@@ -0,0 +1,257 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/linalg.hpp"
+
+#include <complex>
+
+#include "gtest/gtest.h"
+#include "thunder/exception.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fillTensor(const T &t, int start, int scale) {
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++ % 17) /
+        static_cast< typename T::value_type >(scale);
+  }
+}
+
+template < typename D >
+void expectNear(D expected, D actual) {
+  EXPECT_NEAR(expected, actual, 1e-3 * (1 + ::std::abs(expected)));
+}
+
+template < typename D >
+void expectNear(::std::complex< D > expected, ::std::complex< D > actual) {
+  expectNear(::std::real(expected), ::std::real(actual));
+  expectNear(::std::imag(expected), ::std::imag(actual));
+}
+
+template < typename T >
+void levelOneTest() {
+  typedef typename T::value_type D;
+  Blas< T > blas;
+  T x(70, 30);
+  T y = T(30, 70).transpose(0, 1);
+  fillTensor(x, -35, 7);
+  fillTensor(y, 12, 5);
+
+  D expected = D(0);
+  for (typename T::reference_iterator x_begin = x.reference_begin(),
+           x_end = x.reference_end(), y_begin = y.reference_begin();
+       x_begin != x_end; ++x_begin, ++y_begin) {
+    expected += (*x_begin) * (*y_begin);
+  }
+  expectNear(expected, blas.dot(x, y));
+  expectNear(expected, blas.dot(x, y.contiguous()));
+
+  T z = y.clone();
+  blas.axpy(x, z, D(3));
+  for (typename T::reference_iterator x_begin = x.reference_begin(),
+           x_end = x.reference_end(), y_begin = y.reference_begin(),
+           z_begin = z.reference_begin();
+       x_begin != x_end; ++x_begin, ++y_begin, ++z_begin) {
+    expectNear(D(3) * (*x_begin) + (*y_begin), *z_begin);
+  }
+
+  EXPECT_THROW(blas.dot(x, T(20)), out_of_range);
+}
+
+template < typename T >
+void levelTwoTest() {
+  typedef typename T::value_type D;
+  Blas< T > blas;
+  T a1(37, 53);
+  T a2 = T(53, 37).transpose(0, 1);
+  T x(typename T::size_storage({53}), typename T::stride_storage({3}));
+  fillTensor(a1, -400, 11);
+  fillTensor(a2, 128, 13);
+  fillTensor(x, 7, 3);
+
+  for (const T &a : {a1, a2}) {
+    T y1 = blas.gemv(a, x);
+    T y2 = T(typename T::size_storage({37}),
+             typename T::stride_storage({2})).fill(D(2));
+    blas.gemv(a, x, y2, D(2), D(3));
+    ASSERT_EQ(37, y1.length());
+    for (typename T::size_type i = 0; i < 37; ++i) {
+      D expected = D(0);
+      for (typename T::size_type j = 0; j < 53; ++j) {
+        expected += a(i, j) * x(j);
+      }
+      expectNear(expected, y1(i));
+      expectNear(D(2) * expected + D(6), y2(i));
+    }
+
+    T g = blas.ger(x, y1);
+    T h = a.clone();
+    blas.ger(T(37).copy(y1), x, h, D(-1));
+    for (typename T::size_type i = 0; i < 53; ++i) {
+      for (typename T::size_type j = 0; j < 37; ++j) {
+        expectNear(x(i) * y1(j), g(i, j));
+        expectNear(a(j, i) - y1(j) * x(i), h(j, i));
+      }
+    }
+  }
+
+  EXPECT_THROW(blas.gemv(a1, T(37)), out_of_range);
+  EXPECT_THROW(blas.gemv(T(3, 4, 5), x), out_of_range);
+}
+
+template < typename T >
+void levelThreeTest() {
+  typedef typename T::value_type D;
+  Blas< T > blas;
+  tensor::parallel::setThreads(4);
+
+  // Sizes cross the register, cache and scheduling block boundaries
+  T a1(203, 411);
+  T a2 = T(411, 203).transpose(0, 1);
+  T b1(411, 151);
+  T b2 = T(151, 411).transpose(0, 1);
+  fillTensor(a1, -9, 7);
+  fillTensor(a2, 4, 9);
+  fillTensor(b1, 3, 5);
+  fillTensor(b2, -6, 11);
+
+  for (const T &a : {a1, a2}) {
+    for (const T &b : {b1, b2}) {
+      T c1 = blas.gemm(a, b);
+      T c2 = T(151, 203).transpose(0, 1).fill(D(1));
+      T c3 = T(203, 151).fill(D(1));
+      blas.gemm(a, b, c2, D(2), D(-1));
+      blas.gemm(a, b, c3, D(2), D(-1));
+      ASSERT_EQ(203, c1.size(0));
+      ASSERT_EQ(151, c1.size(1));
+      for (typename T::size_type i = 0; i < 203; i += 7) {
+        for (typename T::size_type j = 0; j < 151; ++j) {
+          D expected = D(0);
+          for (typename T::size_type p = 0; p < 411; ++p) {
+            expected += a(i, p) * b(p, j);
+          }
+          expectNear(expected, c1(i, j));
+          expectNear(D(2) * expected - D(1), c2(i, j));
+          expectNear(D(2) * expected - D(1), c3(i, j));
+        }
+      }
+    }
+  }
+
+  EXPECT_THROW(blas.gemm(a1, a1), out_of_range);
+  tensor::parallel::setThreads(0);
+}
+
+template < typename T >
+void batchedTest() {
+  typedef typename T::value_type D;
+  Blas< T > blas;
+  tensor::parallel::setThreads(4);
+
+  // Matrices of the batch are smaller and larger than a scheduling tile
+  typename T::size_type sizes[][3] = {{9, 5, 7}, {130, 45, 150}};
+  for (const typename T::size_type *size : sizes) {
+    typename T::size_type m = size[0], k = size[1], n = size[2];
+    T a1(6, m, k);
+    T a2 = T(6, k, m).transpose(1, 2);
+    T b1(6, k, n);
+    T b2 = T(n, k, 6).permute(2, 1, 0);
+    fillTensor(a1, -9, 7);
+    fillTensor(a2, 4, 9);
+    fillTensor(b1, 3, 5);
+    fillTensor(b2, -6, 11);
+
+    for (const T &a : {a1, a2}) {
+      for (const T &b : {b1, b2}) {
+        T c1 = blas.bmm(a, b);
+        T c2 = T(n, 6, m).permute(1, 2, 0).fill(D(1));
+        blas.bmm(a, b, c2, D(2), D(-1));
+        ASSERT_EQ(6, c1.size(0));
+        ASSERT_EQ(m, c1.size(1));
+        ASSERT_EQ(n, c1.size(2));
+        for (typename T::size_type l = 0; l < 6; ++l) {
+          for (typename T::size_type i = 0; i < m; i += 3) {
+            for (typename T::size_type j = 0; j < n; ++j) {
+              D expected = D(0);
+              for (typename T::size_type p = 0; p < k; ++p) {
+                expected += a(l, i, p) * b(l, p, j);
+              }
+              expectNear(expected, c1(l, i, j));
+              expectNear(D(2) * expected - D(1), c2(l, i, j));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  EXPECT_THROW(blas.bmm(T(6, 3, 4), T(5, 4, 3)), out_of_range);
+  EXPECT_THROW(blas.bmm(T(6, 3, 4), T(6, 3, 4)), out_of_range);
+  EXPECT_THROW(blas.bmm(T(3, 4), T(4, 3)), out_of_range);
+  tensor::parallel::setThreads(0);
+}
+
+TEST(BlasTest, levelOneTest) {
+  levelOneTest< DoubleTensor >();
+  levelOneTest< FloatTensor >();
+  levelOneTest< DoubleComplexTensor >();
+  levelOneTest< FloatComplexTensor >();
+}
+
+TEST(BlasTest, levelTwoTest) {
+  levelTwoTest< DoubleTensor >();
+  levelTwoTest< FloatTensor >();
+  levelTwoTest< DoubleComplexTensor >();
+  levelTwoTest< FloatComplexTensor >();
+}
+
+TEST(BlasTest, levelThreeTest) {
+  levelThreeTest< DoubleTensor >();
+  levelThreeTest< FloatTensor >();
+  levelThreeTest< DoubleComplexTensor >();
+  levelThreeTest< FloatComplexTensor >();
+}
+
+TEST(BlasTest, batchedTest) {
+  batchedTest< DoubleTensor >();
+  batchedTest< FloatTensor >();
+  batchedTest< DoubleComplexTensor >();
+  batchedTest< FloatComplexTensor >();
+}
+
+TEST(BlasTest, instructionTest) {
+  // Real matrix products run the kernels of each instruction set
+  tensor::simd::Instruction best = tensor::simd::detect();
+  for (int i = tensor::simd::SCALAR; i <= best; ++i) {
+    tensor::simd::setInstruction(static_cast< tensor::simd::Instruction >(i));
+    levelThreeTest< DoubleTensor >();
+    levelThreeTest< FloatTensor >();
+    batchedTest< DoubleTensor >();
+    batchedTest< FloatTensor >();
+  }
+  tensor::simd::setInstruction(tensor::simd::AVX512);
+}
+
+}  // namespace
+}  // namespace thunder
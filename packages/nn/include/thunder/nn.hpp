@@ -0,0 +1,47 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_NN_HPP_
+#define THUNDER_NN_HPP_
+
+#include "thunder/nn/convolution.hpp"
+
+#include "thunder/nn/math.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+
+template < typename T = DoubleTensor >
+using Convolution = nn::Convolution< T >;
+
+typedef Convolution< DoubleTensor > DoubleConvolution;
+typedef Convolution< FloatTensor > FloatConvolution;
+
+}  // namespace thunder
+
+namespace thunder {
+namespace nn {
+
+extern template class Convolution< DoubleTensor >;
+extern template class Convolution< FloatTensor >;
+
+}  // namespace nn
+}  // namespace thunder
+
+#endif  // THUNDER_NN_HPP_
@@ -0,0 +1,113 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_NN_CONVOLUTION_INL_HPP_
+#define THUNDER_NN_CONVOLUTION_INL_HPP_
+
+#include "thunder/nn/convolution.hpp"
+
+#include "thunder/exception.hpp"
+#include "thunder/nn/math.hpp"
+
+namespace thunder {
+namespace nn {
+
+template < typename T >
+Convolution< T >::Convolution(size_storage st, size_storage pd,
+                              size_storage dl, Algorithm al)
+    : stride_(st), padding_(pd), dilation_(dl), algorithm_(al) {
+  for (const size_type &stride_x : stride_) {
+    if (stride_x == 0) {
+      throw invalid_argument("Stride evaluates to zero.");
+    }
+  }
+  for (const size_type &dilation_x : dilation_) {
+    if (dilation_x == 0) {
+      throw invalid_argument("Dilation evaluates to zero.");
+    }
+  }
+}
+
+template < typename T >
+const typename Convolution< T >::size_storage& Convolution< T >::stride()
+    const {
+  return stride_;
+}
+
+template < typename T >
+const typename Convolution< T >::size_storage& Convolution< T >::padding()
+    const {
+  return padding_;
+}
+
+template < typename T >
+const typename Convolution< T >::size_storage& Convolution< T >::dilation()
+    const {
+  return dilation_;
+}
+
+template < typename T >
+typename Convolution< T >::Algorithm Convolution< T >::algorithm() const {
+  return algorithm_;
+}
+
+template < typename T >
+typename Convolution< T >::size_storage Convolution< T >::outputSize(
+    const T &x, const T &w) {
+  return math::outputSize< Convolution >(this, x, w);
+}
+
+template < typename T >
+T Convolution< T >::correlate(const T &x, const T &w) {
+  T y(outputSize(x, w));
+  correlate(x, w, y);
+  return y;
+}
+
+template < typename T >
+const T& Convolution< T >::correlate(const T &x, const T &w, const T &y) {
+  return math::correlate< Convolution >(this, x, w, y, false);
+}
+
+template < typename T >
+T& Convolution< T >::correlate(const T &x, const T &w, T &y) {
+  return const_cast< T& >(correlate(x, w, const_cast< const T& >(y)));
+}
+
+template < typename T >
+T Convolution< T >::convolve(const T &x, const T &w) {
+  T y(outputSize(x, w));
+  convolve(x, w, y);
+  return y;
+}
+
+template < typename T >
+const T& Convolution< T >::convolve(const T &x, const T &w, const T &y) {
+  return math::correlate< Convolution >(this, x, w, y, true);
+}
+
+template < typename T >
+T& Convolution< T >::convolve(const T &x, const T &w, T &y) {
+  return const_cast< T& >(convolve(x, w, const_cast< const T& >(y)));
+}
+
+}  // namespace nn
+}  // namespace thunder
+
+#endif  // THUNDER_NN_CONVOLUTION_INL_HPP_
@@ -0,0 +1,80 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_NN_CONVOLUTION_HPP_
+#define THUNDER_NN_CONVOLUTION_HPP_
+
+namespace thunder {
+namespace nn {
+
+// Convolutions of inputs of size batch x channels x spatial dimensions, with
+// 1, 2 or 3 spatial dimensions, by weights of size output channels x input
+// channels x kernel dimensions. Stride, padding and dilation are given either
+// once for all spatial dimensions or once for each of them.
+template < typename T >
+class Convolution {
+ public:
+  typedef T tensor_type;
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+  typedef typename T::size_storage size_storage;
+
+  // Winograd applies to 2-dimensional 3 x 3 kernels with unit stride and
+  // dilation, and is what AUTO picks for them
+  enum Algorithm {
+    AUTO,
+    DIRECT,
+    WINOGRAD
+  };
+
+  explicit Convolution(size_storage st = size_storage(1, 1),
+                       size_storage pd = size_storage(1, 0),
+                       size_storage dl = size_storage(1, 1),
+                       Algorithm al = AUTO);
+
+  const size_storage& stride() const;
+  const size_storage& padding() const;
+  const size_storage& dilation() const;
+  Algorithm algorithm() const;
+
+  // Size of the output for input x and weight w
+  size_storage outputSize(const T &x, const T &w);
+
+  // y[n][o] = sum_i sum_k w[o][i][k] * x[n][i][stride * p + dilation * k]
+  // where positions in the padding read zeros
+  T correlate(const T &x, const T &w);
+  const T& correlate(const T &x, const T &w, const T &y);
+  T& correlate(const T &x, const T &w, T &y);
+
+  // Same as correlate with the kernel flipped in every spatial dimension
+  T convolve(const T &x, const T &w);
+  const T& convolve(const T &x, const T &w, const T &y);
+  T& convolve(const T &x, const T &w, T &y);
+
+ private:
+  size_storage stride_;
+  size_storage padding_;
+  size_storage dilation_;
+  Algorithm algorithm_;
+};
+
+}  // namespace nn
+}  // namespace thunder
+
+#endif  // THUNDER_NN_CONVOLUTION_HPP_
@@ -0,0 +1,432 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_NN_MATH_INL_HPP_
+#define THUNDER_NN_MATH_INL_HPP_
+
+#include "thunder/nn/math.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "thunder/exception.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace nn {
+namespace math {
+
+template < typename S >
+typename S::value_type geometry(const S &g, ::std::size_t i,
+                                ::std::size_t d) {
+  if (g.size() == 1) {
+    return g[0];
+  }
+  if (g.size() != d) {
+    throw out_of_range("Geometry mismatches dimension.");
+  }
+  return g[i];
+}
+
+template < typename C >
+Shape shape(C *conv, const typename C::tensor_type &x,
+            const typename C::tensor_type &w) {
+  typedef typename C::tensor_type T;
+  typedef typename T::dim_type dim_type;
+  if (x.dimension() < 3 || x.dimension() > 5 ||
+      w.dimension() != x.dimension()) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  if (w.size(1) != x.size(1)) {
+    throw out_of_range("Size mismatches.");
+  }
+  dim_type d = x.dimension() - 2;
+  Shape s;
+  s.batch = x.size(0);
+  s.in = x.size(1);
+  s.out = w.size(0);
+  for (dim_type i = 0; i < 2; ++i) {
+    s.x_stride[i] = x.stride(i);
+    s.w_stride[i] = w.stride(i);
+    s.y_stride[i] = 0;
+  }
+  // Missing leading spatial dimensions have size 1
+  for (dim_type i = 0; i < 3; ++i) {
+    s.y_stride[i + 2] = 0;
+    if (i < 3 - d) {
+      s.input[i] = s.kernel[i] = s.output[i] = 1;
+      s.stride[i] = s.dilation[i] = 1;
+      s.padding[i] = 0;
+      s.x_stride[i + 2] = s.w_stride[i + 2] = 0;
+      continue;
+    }
+    dim_type k = i - (3 - d);
+    s.input[i] = x.size(k + 2);
+    s.kernel[i] = w.size(k + 2);
+    s.stride[i] = geometry(conv->stride(), k, d);
+    s.padding[i] = geometry(conv->padding(), k, d);
+    s.dilation[i] = geometry(conv->dilation(), k, d);
+    s.x_stride[i + 2] = x.stride(k + 2);
+    s.w_stride[i + 2] = w.stride(k + 2);
+    ::std::size_t span = s.dilation[i] * (s.kernel[i] - 1) + 1;
+    if (s.input[i] + 2 * s.padding[i] < span) {
+      throw out_of_range("Kernel exceeds input size.");
+    }
+    s.output[i] = (s.input[i] + 2 * s.padding[i] - span) / s.stride[i] + 1;
+  }
+  return s;
+}
+
+template < typename C >
+typename C::size_storage outputSize(
+    C *conv, const typename C::tensor_type &x,
+    const typename C::tensor_type &w) {
+  typedef typename C::tensor_type T;
+  typedef typename T::dim_type dim_type;
+  Shape s = shape(conv, x, w);
+  dim_type d = x.dimension() - 2;
+  typename C::size_storage sz(x.dimension());
+  sz[0] = s.batch;
+  sz[1] = s.out;
+  for (dim_type i = 0; i < d; ++i) {
+    sz[i + 2] = s.output[3 - d + i];
+  }
+  return sz;
+}
+
+template < typename C >
+const typename C::tensor_type& correlate(
+    C *conv, const typename C::tensor_type &x,
+    const typename C::tensor_type &w, const typename C::tensor_type &y,
+    bool flip) {
+  typedef typename C::tensor_type T;
+  typedef typename T::value_type D;
+  typedef typename T::dim_type dim_type;
+  Shape s = shape(conv, x, w);
+  dim_type d = x.dimension() - 2;
+  if (y.dimension() != x.dimension() || y.size(0) != s.batch ||
+      y.size(1) != s.out) {
+    throw out_of_range("Size mismatches.");
+  }
+  s.y_stride[0] = y.stride(0);
+  s.y_stride[1] = y.stride(1);
+  for (dim_type i = 0; i < d; ++i) {
+    if (y.size(i + 2) != s.output[3 - d + i]) {
+      throw out_of_range("Size mismatches.");
+    }
+    s.y_stride[3 - d + i + 2] = y.stride(i + 2);
+  }
+
+  // Convolution walks the kernel backwards
+  const D *w_pointer = w.data();
+  if (flip) {
+    for (dim_type i = 0; i < 3; ++i) {
+      w_pointer += static_cast< ::std::ptrdiff_t >(s.kernel[i] - 1) *
+          s.w_stride[i + 2];
+      s.w_stride[i + 2] = -s.w_stride[i + 2];
+    }
+  }
+
+  bool winograd = d == 2 && s.kernel[1] == 3 && s.kernel[2] == 3 &&
+      s.stride[1] == 1 && s.stride[2] == 1 && s.dilation[1] == 1 &&
+      s.dilation[2] == 1;
+  if (conv->algorithm() == C::WINOGRAD && !winograd) {
+    throw invalid_argument(
+        "Winograd requires 3 x 3 kernels with unit stride and dilation.");
+  }
+  y.detach();
+  if (winograd && conv->algorithm() != C::DIRECT) {
+    correlateWinograd(s, x.data(), w_pointer, y.data());
+    return y;
+  }
+
+  // The direct kernel reads a zero-padded copy of the input, which is only
+  // larger than the input by its borders
+  if (s.padding[0] + s.padding[1] + s.padding[2] == 0) {
+    correlateDirect(s, x.data(), w_pointer, y.data());
+    return y;
+  }
+  typename T::size_storage sz = x.size();
+  for (dim_type i = 0; i < d; ++i) {
+    sz[i + 2] = sz[i + 2] + 2 * s.padding[3 - d + i];
+  }
+  T padded(sz);
+  padded.zero();
+  T inner = padded;
+  for (dim_type i = 0; i < d; ++i) {
+    inner = inner.narrow(i + 2, s.padding[3 - d + i], x.size(i + 2));
+  }
+  inner.copy(x);
+  s.x_stride[0] = padded.stride(0);
+  s.x_stride[1] = padded.stride(1);
+  for (dim_type i = 0; i < d; ++i) {
+    s.input[3 - d + i] = sz[i + 2];
+    s.padding[3 - d + i] = 0;
+    s.x_stride[3 - d + i + 2] = padded.stride(i + 2);
+  }
+  correlateDirect(s, padded.data(), w_pointer, y.data());
+  return y;
+}
+
+template < typename D >
+void correlateDirect(const Shape &s, const D *x, const D *w, D *y) {
+  const ::std::size_t mr = DirectBlocking< D >::mr;
+  const ::std::size_t nr = DirectBlocking< D >::nr;
+  // Each task computes one output row for mr output channels, in tiles of nr
+  // outputs along the width
+  ::std::size_t o_blocks = (s.out + mr - 1) / mr;
+  ::std::size_t rows = s.output[0] * s.output[1];
+  ::std::size_t width = s.output[2];
+  ::std::size_t work = ::std::min(mr, s.out) * width * s.in * s.kernel[0] *
+      s.kernel[1] * s.kernel[2];
+  bool contiguous = s.stride[2] == 1 && s.x_stride[4] == 1;
+
+  // Weights are packed in the order the tiles read them, mr channels at a
+  // time and padded with zeros
+  ::std::size_t taps = s.in * s.kernel[0] * s.kernel[1] * s.kernel[2];
+  ::std::vector< D > packed(o_blocks * taps * mr);
+  tensor::parallel::forRange(
+      o_blocks * taps, tensor::parallel::getGrain() / mr + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t t = begin; t < end; ++t) {
+          ::std::size_t o = t / taps * mr;
+          ::std::size_t kw = t % taps % s.kernel[2];
+          ::std::size_t kh = t % taps / s.kernel[2] % s.kernel[1];
+          ::std::size_t kd = t % taps / s.kernel[2] / s.kernel[1] %
+              s.kernel[0];
+          ::std::size_t c = t % taps / s.kernel[2] / s.kernel[1] /
+              s.kernel[0];
+          const D *w_pointer = w + c * s.w_stride[1] + kd * s.w_stride[2] +
+              kh * s.w_stride[3] + kw * s.w_stride[4];
+          for (::std::size_t i = 0; i < mr; ++i) {
+            packed[t * mr + i] = o + i < s.out ?
+                w_pointer[(o + i) * s.w_stride[0]] : D(0);
+          }
+        }
+      });
+
+  tensor::parallel::forRange(
+      s.batch * o_blocks * rows, tensor::parallel::getGrain() / work + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t t = begin; t < end; ++t) {
+          ::std::size_t n = t / (o_blocks * rows);
+          ::std::size_t o = t / rows % o_blocks * mr;
+          ::std::size_t od = t % rows / s.output[1];
+          ::std::size_t oh = t % rows % s.output[1];
+          const D *x_row = x + n * s.x_stride[0] +
+              od * s.stride[0] * s.x_stride[2] +
+              oh * s.stride[1] * s.x_stride[3];
+          const D *w_block = packed.data() + o * taps;
+          D *y_row = y + n * s.y_stride[0] + o * s.y_stride[1] +
+              od * s.y_stride[2] + oh * s.y_stride[3];
+          ::std::size_t m = ::std::min(mr, s.out - o);
+          for (::std::size_t ow = 0; ow < width; ow += nr) {
+            const D *x_tile = x_row + ow * s.stride[2] * s.x_stride[4];
+            D *y_tile = y_row + ow * s.y_stride[4];
+            if (contiguous && ow + nr <= width) {
+              correlateTile< D, true >(s, x_tile, w_block, y_tile, m, nr);
+            } else {
+              correlateTile< D, false >(s, x_tile, w_block, y_tile, m,
+                                        ::std::min(nr, width - ow));
+            }
+          }
+        }
+      });
+}
+
+template < typename D, bool contiguous >
+void correlateTile(const Shape &s, const D *x, const D *w, D *y,
+                   ::std::size_t m, ::std::size_t n) {
+  const ::std::size_t mr = DirectBlocking< D >::mr;
+  const ::std::size_t nr = DirectBlocking< D >::nr;
+  // Columns past n repeat the last valid one, so that the loops below have
+  // constant bounds and stay in registers
+  ::std::ptrdiff_t x_column[nr];
+  for (::std::size_t j = 0; j < nr; ++j) {
+    x_column[j] = ::std::min(j, n - 1) * s.stride[2] * s.x_stride[4];
+  }
+  D ab[mr * nr];
+  for (::std::size_t i = 0; i < mr * nr; ++i) {
+    ab[i] = D(0);
+  }
+  for (::std::size_t c = 0; c < s.in; ++c) {
+    for (::std::size_t kd = 0; kd < s.kernel[0]; ++kd) {
+      for (::std::size_t kh = 0; kh < s.kernel[1]; ++kh) {
+        const D *x_kernel = x + c * s.x_stride[1] +
+            kd * s.dilation[0] * s.x_stride[2] +
+            kh * s.dilation[1] * s.x_stride[3];
+        for (::std::size_t kw = 0; kw < s.kernel[2]; ++kw) {
+          const D *x_pointer = x_kernel + kw * s.dilation[2] * s.x_stride[4];
+          D xv[nr];
+          for (::std::size_t j = 0; j < nr; ++j) {
+            xv[j] = contiguous ? x_pointer[j] : x_pointer[x_column[j]];
+          }
+          for (::std::size_t i = 0; i < mr; ++i) {
+            for (::std::size_t j = 0; j < nr; ++j) {
+              ab[i * nr + j] += w[i] * xv[j];
+            }
+          }
+          w += mr;
+        }
+      }
+    }
+  }
+  for (::std::size_t i = 0; i < m; ++i) {
+    for (::std::size_t j = 0; j < n; ++j) {
+      y[i * s.y_stride[1] + j * s.y_stride[4]] = ab[i * nr + j];
+    }
+  }
+}
+
+template < typename D >
+void correlateWinograd(const Shape &s, const D *x, const D *w, D *y) {
+  typedef ::std::ptrdiff_t difference_type;
+  const D half = D(1) / D(2);
+  // Kernels are transformed to u = G g G^T and stored as 16 matrices of size
+  // out x in, one for each position of the 4 x 4 transformed tile
+  ::std::size_t in = s.in, out = s.out;
+  ::std::vector< D > u(16 * out * in);
+  tensor::parallel::forRange(
+      out * in, tensor::parallel::getGrain() / 64 + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t t = begin; t < end; ++t) {
+          ::std::size_t o = t / in, i = t % in;
+          const D *g = w + o * s.w_stride[0] + i * s.w_stride[1];
+          D h[4][3];
+          for (::std::size_t c = 0; c < 3; ++c) {
+            D g0 = g[c * s.w_stride[4]];
+            D g1 = g[s.w_stride[3] + c * s.w_stride[4]];
+            D g2 = g[2 * s.w_stride[3] + c * s.w_stride[4]];
+            h[0][c] = g0;
+            h[1][c] = (g0 + g1 + g2) * half;
+            h[2][c] = (g0 - g1 + g2) * half;
+            h[3][c] = g2;
+          }
+          for (::std::size_t r = 0; r < 4; ++r) {
+            D v[4] = {h[r][0], (h[r][0] + h[r][1] + h[r][2]) * half,
+                      (h[r][0] - h[r][1] + h[r][2]) * half, h[r][2]};
+            for (::std::size_t c = 0; c < 4; ++c) {
+              u[((r * 4 + c) * out + o) * in + i] = v[c];
+            }
+          }
+        }
+      });
+
+  // Tasks transform blocks of input tiles to v = B^T d B, multiply them with
+  // u for every tile position and transform the sums back to y = A^T m A
+  const ::std::size_t block = 32;
+  ::std::size_t height = s.output[1], width = s.output[2];
+  ::std::size_t tile_width = (width + 1) / 2;
+  ::std::size_t tiles = (height + 1) / 2 * tile_width;
+  ::std::size_t t_blocks = (tiles + block - 1) / block;
+  tensor::parallel::forRange(
+      s.batch * t_blocks, 1, [&](::std::size_t begin, ::std::size_t end) {
+        ::std::vector< D > v(16 * in * block), m(16 * out * block);
+        for (::std::size_t task = begin; task < end; ++task) {
+          ::std::size_t n = task / t_blocks;
+          ::std::size_t t_begin = task % t_blocks * block;
+          ::std::size_t count = ::std::min(block, tiles - t_begin);
+          for (::std::size_t i = 0; i < in; ++i) {
+            const D *x_plane = x + n * s.x_stride[0] + i * s.x_stride[1];
+            for (::std::size_t p = 0; p < count; ++p) {
+              difference_type h0 = (t_begin + p) / tile_width * 2;
+              difference_type w0 = (t_begin + p) % tile_width * 2;
+              h0 = h0 - s.padding[1];
+              w0 = w0 - s.padding[2];
+              D d[4][4];
+              for (difference_type r = 0; r < 4; ++r) {
+                for (difference_type c = 0; c < 4; ++c) {
+                  bool inside = h0 + r >= 0 && w0 + c >= 0 &&
+                      h0 + r < static_cast< difference_type >(s.input[1]) &&
+                      w0 + c < static_cast< difference_type >(s.input[2]);
+                  d[r][c] = inside ? x_plane[(h0 + r) * s.x_stride[3] +
+                                             (w0 + c) * s.x_stride[4]] : D(0);
+                }
+              }
+              for (::std::size_t r = 0; r < 4; ++r) {
+                D e[4] = {d[0][r] - d[2][r], d[1][r] + d[2][r],
+                          d[2][r] - d[1][r], d[1][r] - d[3][r]};
+                for (::std::size_t c = 0; c < 4; ++c) {
+                  d[c][r] = e[c];
+                }
+              }
+              for (::std::size_t r = 0; r < 4; ++r) {
+                D e[4] = {d[r][0] - d[r][2], d[r][1] + d[r][2],
+                          d[r][2] - d[r][1], d[r][1] - d[r][3]};
+                for (::std::size_t c = 0; c < 4; ++c) {
+                  v[((r * 4 + c) * in + i) * block + p] = e[c];
+                }
+              }
+            }
+          }
+
+          // Products are summed over input channels for a whole block of
+          // tiles at once, which keeps the sums in registers
+          for (::std::size_t q = 0; q < 16; ++q) {
+            for (::std::size_t o = 0; o < out; ++o) {
+              const D *u_row = u.data() + (q * out + o) * in;
+              D ab[block];
+              for (::std::size_t p = 0; p < block; ++p) {
+                ab[p] = D(0);
+              }
+              for (::std::size_t i = 0; i < in; ++i) {
+                D weight = u_row[i];
+                const D *v_row = v.data() + (q * in + i) * block;
+                for (::std::size_t p = 0; p < block; ++p) {
+                  ab[p] += weight * v_row[p];
+                }
+              }
+              ::std::copy(ab, ab + count, m.data() + (q * out + o) * block);
+            }
+          }
+
+          for (::std::size_t o = 0; o < out; ++o) {
+            D *y_plane = y + n * s.y_stride[0] + o * s.y_stride[1];
+            for (::std::size_t p = 0; p < count; ++p) {
+              ::std::size_t h0 = (t_begin + p) / tile_width * 2;
+              ::std::size_t w0 = (t_begin + p) % tile_width * 2;
+              D e[2][4];
+              for (::std::size_t c = 0; c < 4; ++c) {
+                D m0 = m[((0 * 4 + c) * out + o) * block + p];
+                D m1 = m[((1 * 4 + c) * out + o) * block + p];
+                D m2 = m[((2 * 4 + c) * out + o) * block + p];
+                D m3 = m[((3 * 4 + c) * out + o) * block + p];
+                e[0][c] = m0 + m1 + m2;
+                e[1][c] = m1 - m2 - m3;
+              }
+              for (::std::size_t r = 0; r < 2 && h0 + r < height; ++r) {
+                D z[2] = {e[r][0] + e[r][1] + e[r][2],
+                          e[r][1] - e[r][2] - e[r][3]};
+                for (::std::size_t c = 0; c < 2 && w0 + c < width; ++c) {
+                  y_plane[(h0 + r) * s.y_stride[3] +
+                          (w0 + c) * s.y_stride[4]] = z[c];
+                }
+              }
+            }
+          }
+        }
+      });
+}
+
+}  // namespace math
+}  // namespace nn
+}  // namespace thunder
+
+#endif  // THUNDER_NN_MATH_INL_HPP_
@@ -0,0 +1,93 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_NN_MATH_HPP_
+#define THUNDER_NN_MATH_HPP_
+
+#include <cstddef>
+
+namespace thunder {
+namespace nn {
+namespace math {
+
+// Geometry of a convolution with the spatial dimensions padded to three, in
+// the order depth, height and width. Strides of x, w and y are in elements
+// for batch (or output channel for w), channel, depth, height and width.
+struct Shape {
+  ::std::size_t batch;
+  ::std::size_t in;
+  ::std::size_t out;
+  ::std::size_t input[3];
+  ::std::size_t kernel[3];
+  ::std::size_t output[3];
+  ::std::size_t stride[3];
+  ::std::size_t padding[3];
+  ::std::size_t dilation[3];
+  ::std::ptrdiff_t x_stride[5];
+  ::std::ptrdiff_t w_stride[5];
+  ::std::ptrdiff_t y_stride[5];
+};
+
+template < typename C >
+Shape shape(C *conv, const typename C::tensor_type &x,
+            const typename C::tensor_type &w);
+
+template < typename C >
+typename C::size_storage outputSize(
+    C *conv, const typename C::tensor_type &x,
+    const typename C::tensor_type &w);
+
+template < typename C >
+const typename C::tensor_type& correlate(
+    C *conv, const typename C::tensor_type &x,
+    const typename C::tensor_type &w, const typename C::tensor_type &y,
+    bool flip);
+
+// Register tiles of the direct correlation, of mr output channels by nr
+// positions along the width
+template < typename D >
+struct DirectBlocking {
+  static const ::std::size_t mr = 4;
+  static const ::std::size_t nr = 4;
+};
+template < >
+struct DirectBlocking< float > {
+  static const ::std::size_t mr = 8;
+  static const ::std::size_t nr = 8;
+};
+
+// Direct correlation of an input without padding. Outputs are computed in
+// register tiles of DirectBlocking, 4 x 4 for double and 8 x 8 for float,
+// reading the input where the kernel overlaps it instead of unfolding it.
+// Tiles read weights packed mr output channels at a time.
+template < typename D >
+void correlateDirect(const Shape &s, const D *x, const D *w, D *y);
+template < typename D, bool contiguous >
+void correlateTile(const Shape &s, const D *x, const D *w, D *y,
+                   ::std::size_t m, ::std::size_t n);
+
+// Winograd F(2 x 2, 3 x 3) over tiles of 2 x 2 outputs
+template < typename D >
+void correlateWinograd(const Shape &s, const D *x, const D *w, D *y);
+
+}  // namespace math
+}  // namespace nn
+}  // namespace thunder
+
+#endif  // THUNDER_NN_MATH_HPP_
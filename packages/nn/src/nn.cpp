@@ -0,0 +1,36 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/nn/convolution.hpp"
+
+#include "thunder/nn/math.hpp"
+#include "thunder/tensor.hpp"
+
+#include "thunder/nn/convolution-inl.hpp"
+#include "thunder/nn/math-inl.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+
+namespace thunder {
+namespace nn {
+
+template class Convolution< DoubleTensor >;
+template class Convolution< FloatTensor >;
+
+}  // namespace nn
+}  // namespace thunder
@@ -0,0 +1,160 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/nn.hpp"
+
+#include <cmath>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "thunder/exception.hpp"
+#include "thunder/tensor.hpp"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+void fillTensor(const T &t, int start, int scale) {
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++ % 17) /
+        static_cast< typename T::value_type >(scale);
+  }
+}
+
+// Correlation computed position by position
+template < typename T >
+void expectCorrelation(const Convolution< T > &conv, const T &x, const T &w,
+                       const T &y, bool flip) {
+  typedef typename T::value_type D;
+  typedef typename T::size_storage size_storage;
+  typename T::dim_type d = x.dimension() - 2;
+  for (typename T::reference_iterator begin = y.reference_begin(),
+           end = y.reference_end(); begin != end; ++begin) {
+    size_storage pos = begin.position();
+    D expected = D(0);
+    for (typename T::size_type i = 0; i < x.size(1); ++i) {
+      T kernel = w.select(0, pos[1]).select(0, i);
+      for (typename T::reference_iterator k_begin = kernel.reference_begin(),
+               k_end = kernel.reference_end(); k_begin != k_end; ++k_begin) {
+        size_storage k = k_begin.position();
+        size_storage x_pos(d + 2);
+        x_pos[0] = pos[0];
+        x_pos[1] = i;
+        bool inside = true;
+        for (typename T::dim_type j = 0; j < d; ++j) {
+          typename T::size_type g = conv.stride().size() == 1 ? 0 : j;
+          long p = static_cast< long >(pos[j + 2] * conv.stride()[g]);
+          g = conv.dilation().size() == 1 ? 0 : j;
+          p += static_cast< long >(k[j] * conv.dilation()[g]);
+          g = conv.padding().size() == 1 ? 0 : j;
+          p -= static_cast< long >(conv.padding()[g]);
+          inside = inside && p >= 0 && p < static_cast< long >(x.size(j + 2));
+          x_pos[j + 2] = static_cast< typename T::size_type >(p);
+          if (flip) {
+            k[j] = kernel.size(j) - 1 - k[j];
+          }
+        }
+        if (inside) {
+          expected += kernel(k) * x(x_pos);
+        }
+      }
+    }
+    EXPECT_NEAR(expected, *begin, 1e-3 * (1 + ::std::fabs(expected)));
+  }
+}
+
+template < typename T >
+void correlateTest(const Convolution< T > &conv, const T &x, const T &w) {
+  Convolution< T > c = conv;
+  T y1 = c.correlate(x, w);
+  expectCorrelation(conv, x, w, y1, false);
+  T y2 = c.convolve(x, w);
+  expectCorrelation(conv, x, w, y2, true);
+
+  // Outputs may have any layout
+  typename T::size_storage sz = c.outputSize(x, w);
+  ASSERT_EQ(y1.dimension(), sz.size());
+  ::std::swap(sz[0], sz[sz.size() - 1]);
+  T y3 = T(sz).transpose(0, sz.size() - 1);
+  c.correlate(x, w, y3);
+  expectCorrelation(conv, x, w, y3, false);
+}
+
+template < typename T >
+void convolutionTest() {
+  typedef Convolution< T > C;
+  typedef typename T::size_storage size_storage;
+
+  // One, two and three spatial dimensions with all of the geometry
+  T x1(3, 4, 29), w1(5, 4, 4);
+  fillTensor(x1, -5, 7);
+  fillTensor(w1, 3, 5);
+  correlateTest(C(size_storage({2}), size_storage({3}), size_storage({2})),
+                x1, w1);
+
+  T x2(2, 3, 13, 17), w2(4, 3, 3, 5);
+  fillTensor(x2, 2, 9);
+  fillTensor(w2, -7, 3);
+  correlateTest(C(size_storage({1, 2}), size_storage({2, 1}),
+                  size_storage({2, 1})), x2, w2);
+  correlateTest(C(), x2.transpose(2, 3).transpose(2, 3), w2);
+  correlateTest(C(), T(2, 13, 3, 17).transpose(1, 2), w2);
+
+  T x3(size_storage({2, 2, 7, 8, 9})), w3(size_storage({3, 2, 2, 3, 2}));
+  fillTensor(x3, 4, 11);
+  fillTensor(w3, -1, 4);
+  correlateTest(C(size_storage({2, 1, 2}), size_storage({1})), x3, w3);
+
+  // Winograd tiles cover odd output sizes and padded borders
+  T x4(2, 5, 11, 14), w4(9, 5, 3, 3);
+  fillTensor(x4, -3, 13);
+  fillTensor(w4, 6, 7);
+  for (typename T::size_type p : {0, 1, 2}) {
+    correlateTest(C(size_storage({1}), size_storage({p})), x4, w4);
+    correlateTest(C(size_storage({1}), size_storage({p}), size_storage({1}),
+                    C::WINOGRAD), x4, w4);
+    correlateTest(C(size_storage({1}), size_storage({p}), size_storage({1}),
+                    C::DIRECT), x4, w4);
+  }
+  T x5 = T(2, 11, 5, 14).transpose(1, 2);
+  fillTensor(x5, 1, 3);
+  correlateTest(C(size_storage({1}), size_storage({1})), x5, w4);
+
+  C conv;
+  EXPECT_THROW(conv.correlate(T(1, 3, 2, 2), T(1, 3, 3, 3)), out_of_range);
+  EXPECT_THROW(conv.correlate(T(1, 3, 5, 5), T(1, 2, 3, 3)), out_of_range);
+  EXPECT_THROW(conv.correlate(T(3, 5, 5), T(1, 3, 3, 3)), out_of_range);
+  EXPECT_THROW(C(size_storage({1, 1})).correlate(x1, w1), out_of_range);
+  EXPECT_THROW(C(size_storage({0})), invalid_argument);
+  EXPECT_THROW(C(size_storage({1}), size_storage({0}), size_storage({1}),
+                 C::WINOGRAD).correlate(x2, w2), invalid_argument);
+}
+
+TEST(ConvolutionTest, doubleConvolutionTest) {
+  convolutionTest< DoubleTensor >();
+}
+
+TEST(ConvolutionTest, floatConvolutionTest) {
+  convolutionTest< FloatTensor >();
+}
+
+}  // namespace
+}  // namespace thunder
@@ -22,9 +22,11 @@
 
 #include "thunder/random/random.hpp"
 
+#include <cstdint>
 #include <ctime>
 #include <random>
 
+#include "thunder/random/counter.hpp"
 #include "thunder/random/math.hpp"
 #include "thunder/tensor.hpp"
 
@@ -44,6 +46,25 @@ typedef Random<
   SizeTensor, ::std::mt19937, typename SizeTensor::value_type, double >
 SizeRandom;
 
+typedef Random<
+  DoubleTensor, random::Philox4x32, int, typename DoubleTensor::value_type >
+DoublePhiloxRandom;
+typedef Random<
+  FloatTensor, random::Philox4x32, int, typename FloatTensor::value_type >
+FloatPhiloxRandom;
+typedef Random<
+  SizeTensor, random::Philox4x32, typename SizeTensor::value_type, double >
+SizePhiloxRandom;
+typedef Random<
+  DoubleTensor, random::Threefry4x32, int, typename DoubleTensor::value_type >
+DoubleThreefryRandom;
+typedef Random<
+  FloatTensor, random::Threefry4x32, int, typename FloatTensor::value_type >
+FloatThreefryRandom;
+typedef Random<
+  SizeTensor, random::Threefry4x32, typename SizeTensor::value_type, double >
+SizeThreefryRandom;
+
 }  // namespace thunder
 
 namespace thunder {
@@ -68,6 +89,35 @@ THUNDER_RANDOM_INSTANTIATE_MT19937(
 
 #undef THUNDR_RANDOM_INSTANTIATE_MT19937
 
+extern template struct Philox4x32Block< 10 >;
+extern template struct Threefry4x32Block< 20 >;
+extern template class CounterEngine< Philox4x32Block< 10 > >;
+extern template class CounterEngine< Threefry4x32Block< 20 > >;
+
+#define THUNDER_RANDOM_INSTANTIATE_COUNTER(T, G, I, F)                  \
+  extern template class Random< T, G, I, F >;                           \
+  extern template Random< T, G, I, F >::Random();                       \
+  extern template Random< T, G, I, F >::Random(::std::uint64_t val);    \
+  extern template Random< T, G, I, F >::Random(int val);                \
+  extern template Random< T, G, I, F >::Random(::std::time_t val);      \
+  extern template Random< T, G, I, F >::Random(::std::seed_seq q);
+
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    DoubleTensor, Philox4x32, int, typename DoubleTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    FloatTensor, Philox4x32, int, typename FloatTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    SizeTensor, Philox4x32, typename SizeTensor::value_type, double);
+
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    DoubleTensor, Threefry4x32, int, typename DoubleTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    FloatTensor, Threefry4x32, int, typename FloatTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    SizeTensor, Threefry4x32, typename SizeTensor::value_type, double);
+
+#undef THUNDER_RANDOM_INSTANTIATE_COUNTER
+
 }  // namespace random
 }  // namespace thunder
 
@@ -0,0 +1,213 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_RANDOM_COUNTER_INL_HPP_
+#define THUNDER_RANDOM_COUNTER_INL_HPP_
+
+#include "thunder/random/counter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace thunder {
+namespace random {
+
+template < unsigned int N >
+void Philox4x32Block< N >::generate(
+    const ::std::uint32_t *counter, const ::std::uint32_t *key,
+    ::std::uint32_t *result) {
+  ::std::uint32_t x0 = counter[0], x1 = counter[1], x2 = counter[2],
+      x3 = counter[3];
+  ::std::uint32_t k0 = key[0], k1 = key[1];
+  for (unsigned int i = 0; i < N; ++i) {
+    ::std::uint64_t p0 = static_cast< ::std::uint64_t >(0xD2511F53) * x0;
+    ::std::uint64_t p1 = static_cast< ::std::uint64_t >(0xCD9E8D57) * x2;
+    x0 = static_cast< ::std::uint32_t >(p1 >> 32) ^ x1 ^ k0;
+    x1 = static_cast< ::std::uint32_t >(p1);
+    x2 = static_cast< ::std::uint32_t >(p0 >> 32) ^ x3 ^ k1;
+    x3 = static_cast< ::std::uint32_t >(p0);
+    k0 += 0x9E3779B9;
+    k1 += 0xBB67AE85;
+  }
+  result[0] = x0;
+  result[1] = x1;
+  result[2] = x2;
+  result[3] = x3;
+}
+
+template < unsigned int N >
+void Threefry4x32Block< N >::generate(
+    const ::std::uint32_t *counter, const ::std::uint32_t *key,
+    ::std::uint32_t *result) {
+  static const unsigned int rotation[8][2] = {
+    {10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10},
+    {18, 20}};
+  ::std::uint32_t ks[5] = {key[0], key[1], key[2], key[3],
+                           0x1BD11BDA ^ key[0] ^ key[1] ^ key[2] ^ key[3]};
+  ::std::uint32_t x0 = counter[0] + ks[0], x1 = counter[1] + ks[1],
+      x2 = counter[2] + ks[2], x3 = counter[3] + ks[3];
+  // Rounds go in pairs mixing (0, 1), (2, 3) and then (0, 3), (2, 1)
+  for (unsigned int i = 0; i < N; i += 2) {
+    const unsigned int *r = rotation[i % 8];
+    x0 += x1;
+    x1 = ((x1 << r[0]) | (x1 >> (32 - r[0]))) ^ x0;
+    x2 += x3;
+    x3 = ((x3 << r[1]) | (x3 >> (32 - r[1]))) ^ x2;
+    r = rotation[(i + 1) % 8];
+    x0 += x3;
+    x3 = ((x3 << r[0]) | (x3 >> (32 - r[0]))) ^ x0;
+    x2 += x1;
+    x1 = ((x1 << r[1]) | (x1 >> (32 - r[1]))) ^ x2;
+    // Inject the key every 4 rounds
+    if (i % 4 == 2) {
+      unsigned int s = (i + 2) / 4;
+      x0 += ks[s % 5];
+      x1 += ks[(s + 1) % 5];
+      x2 += ks[(s + 2) % 5];
+      x3 += ks[(s + 3) % 5] + s;
+    }
+  }
+  result[0] = x0;
+  result[1] = x1;
+  result[2] = x2;
+  result[3] = x3;
+}
+
+template < typename B >
+const ::std::size_t CounterEngine< B >::block;
+
+template < typename B >
+const ::std::uint64_t CounterEngine< B >::default_seed;
+
+template < typename B >
+CounterEngine< B >::CounterEngine(::std::uint64_t value) {
+  seed(value);
+}
+
+template < typename B >
+CounterEngine< B >::CounterEngine(::std::seed_seq &q) {
+  seed(q);
+}
+
+template < typename B >
+void CounterEngine< B >::seed(::std::uint64_t value) {
+  key_[0] = static_cast< ::std::uint32_t >(value);
+  key_[1] = static_cast< ::std::uint32_t >(value >> 32);
+  key_[2] = 0;
+  key_[3] = 0;
+  counter_ = 0;
+  index_ = block;
+}
+
+template < typename B >
+void CounterEngine< B >::seed(::std::seed_seq &q) {
+  q.generate(key_, key_ + 4);
+  counter_ = 0;
+  index_ = block;
+}
+
+template < typename B >
+typename CounterEngine< B >::result_type CounterEngine< B >::operator()() {
+  if (index_ == block) {
+    ::std::uint32_t counter[4] = {
+      static_cast< ::std::uint32_t >(counter_),
+      static_cast< ::std::uint32_t >(counter_ >> 32), 0, 0};
+    B::generate(counter, key_, result_);
+    ++counter_;
+    index_ = 0;
+  }
+  return result_[index_++];
+}
+
+template < typename B >
+void CounterEngine< B >::discard(unsigned long long z) {
+  // Values left in the current block are consumed first
+  ::std::size_t left = block - index_;
+  if (z <= left) {
+    index_ += z;
+    return;
+  }
+  z -= left;
+  counter_ += (z - 1) / block;
+  index_ = block;
+  ::std::size_t rest = (z - 1) % block + 1;
+  operator()();
+  index_ = rest;
+}
+
+template < typename B >
+void CounterEngine< B >::generate(result_type *first, result_type *last) {
+  while (first != last && index_ < block) {
+    *first++ = result_[index_++];
+  }
+  // Whole blocks are written in place
+  while (static_cast< ::std::size_t >(last - first) >= block) {
+    ::std::uint32_t counter[4] = {
+      static_cast< ::std::uint32_t >(counter_),
+      static_cast< ::std::uint32_t >(counter_ >> 32), 0, 0};
+    B::generate(counter, key_, first);
+    ++counter_;
+    first += block;
+  }
+  while (first != last) {
+    *first++ = operator()();
+  }
+}
+
+template < typename B >
+CounterEngine< B > CounterEngine< B >::split(::std::uint64_t id) const {
+  // The highest counter bit separates derived keys from generated values
+  ::std::uint32_t counter[4] = {
+    static_cast< ::std::uint32_t >(counter_),
+    static_cast< ::std::uint32_t >(counter_ >> 32),
+    static_cast< ::std::uint32_t >(id),
+    static_cast< ::std::uint32_t >(id >> 32) | 0x80000000};
+  CounterEngine engine;
+  B::generate(counter, key_, engine.key_);
+  return engine;
+}
+
+template < typename B >
+bool CounterEngine< B >::operator==(const CounterEngine &other) const {
+  for (::std::size_t i = 0; i < 4; ++i) {
+    if (key_[i] != other.key_[i]) {
+      return false;
+    }
+  }
+  if (counter_ != other.counter_ || index_ != other.index_) {
+    return false;
+  }
+  for (::std::size_t i = index_; i < block; ++i) {
+    if (result_[i] != other.result_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template < typename B >
+bool CounterEngine< B >::operator!=(const CounterEngine &other) const {
+  return !(*this == other);
+}
+
+}  // namespace random
+}  // namespace thunder
+
+#endif  // THUNDER_RANDOM_COUNTER_INL_HPP_
@@ -0,0 +1,100 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_RANDOM_COUNTER_HPP_
+#define THUNDER_RANDOM_COUNTER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+namespace thunder {
+namespace random {
+
+// Block functions of counter-based generators, which map a 128-bit counter
+// and a 128-bit key to 128 random bits (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC 2011)
+template < unsigned int N = 10 >
+struct Philox4x32Block {
+  static void generate(const ::std::uint32_t *counter,
+                       const ::std::uint32_t *key, ::std::uint32_t *result);
+};
+
+template < unsigned int N = 20 >
+struct Threefry4x32Block {
+  static_assert(N % 2 == 0, "Threefry rounds are applied in pairs.");
+  static void generate(const ::std::uint32_t *counter,
+                       const ::std::uint32_t *key, ::std::uint32_t *result);
+};
+
+// A random number engine that encrypts an incrementing counter with a block
+// function. Any position of the stream can be reached in constant time, and
+// split() derives generators of independent streams, so that tensors can be
+// filled concurrently with results that do not depend on the thread count.
+template < typename B >
+class CounterEngine {
+ public:
+  typedef ::std::uint32_t result_type;
+
+  // Number of values generated per counter
+  static const ::std::size_t block = 4;
+  static const ::std::uint64_t default_seed = 5489u;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 0xFFFFFFFF; }
+
+  explicit CounterEngine(::std::uint64_t value = default_seed);
+  explicit CounterEngine(::std::seed_seq &q);
+
+  void seed(::std::uint64_t value = default_seed);
+  void seed(::std::seed_seq &q);
+
+  result_type operator()();
+  void discard(unsigned long long z);
+
+  // Same values as calling operator() for each of [first, last)
+  void generate(result_type *first, result_type *last);
+
+  // Generator whose key is derived from the key, the current counter and id
+  CounterEngine split(::std::uint64_t id) const;
+
+  bool operator==(const CounterEngine &other) const;
+  bool operator!=(const CounterEngine &other) const;
+
+ private:
+  ::std::uint32_t key_[4];
+  ::std::uint64_t counter_;
+  ::std::uint32_t result_[4];
+  ::std::size_t index_;
+};
+
+typedef CounterEngine< Philox4x32Block< 10 > > Philox4x32;
+typedef CounterEngine< Threefry4x32Block< 20 > > Threefry4x32;
+
+// Generators that support split()
+template < typename G >
+struct Splittable : public ::std::false_type {};
+template < typename B >
+struct Splittable< CounterEngine< B > > : public ::std::true_type {};
+
+}  // namespace random
+}  // namespace thunder
+
+#endif  // THUNDER_RANDOM_COUNTER_HPP_
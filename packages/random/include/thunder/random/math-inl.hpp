@@ -22,463 +22,326 @@
 
 #include "thunder/random/math.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <random>
+#include <type_traits>
+#include <vector>
+
+#include "thunder/random/counter.hpp"
+#include "thunder/random/counter-inl.hpp"
+#include "thunder/random/sampler.hpp"
+#include "thunder/random/sampler-inl.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/strided.hpp"
+#include "thunder/tensor/strided-inl.hpp"
 
 namespace thunder {
 namespace random {
 namespace math {
 
-template < typename R >
-const typename R::tensor_type& random(
-    R *r, const typename R::tensor_type &t, typename R::integer_type a,
-    typename R::integer_type b) {
+// Serial generators fill elements in the order of reference iterators
+template < typename R, typename D >
+const typename R::tensor_type& fill(
+    R *r, const typename R::tensor_type &t, D *d, ::std::false_type) {
   typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
-  typedef typename R::integer_type I;
-  typedef typename R::float_type F;
-  ::std::uniform_int_distribution< I > distribution(a, b);
   if (t.partialContiguity(0, t.dimension() - 1)) {
     typename T::pointer t_pointer = t.data();
     typename T::size_type t_length = t.length();
     typename T::difference_type t_step = t.stride(t.dimension() - 1);
     for (typename T::size_type i = 0; i < t_length; ++i) {
       t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
+          (*d)(r->generator()));
     }
   } else {
     for (typename T::reference_iterator t_begin = t.reference_begin(),
              t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
       *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
+          (*d)(r->generator()));
     }
   }
   return t;
 }
 
+// Splittable generators fill each chunk from its own stream, so that chunks
+// can be filled concurrently and the result does not depend on the threads
+template < typename R, typename D >
+const typename R::tensor_type& fill(
+    R *r, const typename R::tensor_type &t, D *d, ::std::true_type) {
+  typedef typename R::tensor_type T;
+  typedef typename R::generator_type G;
+  typedef typename T::size_type size_type;
+  const G &generator = r->generator();
+  size_type length = t.length();
+  size_type chunks = (length + chunk - 1) / chunk;
+  tensor::parallel::forRange(
+      chunks, 1, [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t c = begin; c < end; ++c) {
+          G g = generator.split(c);
+          D distribution(d->param());
+          tensor::StridedCursor< T > cursor(t, c * chunk);
+          size_type n = ::std::min(
+              static_cast< size_type >(chunk), length - c * chunk);
+          while (n > 0) {
+            size_type run = ::std::min(cursor.run(), n);
+            typename T::pointer pointer = cursor.data();
+            typename T::difference_type step = cursor.step();
+            for (size_type i = 0; i < run; ++i) {
+              pointer[i * step] = static_cast< typename T::value_type >(
+                  distribution(g));
+            }
+            cursor.advance(run);
+            n = n - run;
+          }
+        }
+      });
+  // The next fill uses different streams
+  r->generator().discard(G::block);
+  return t;
+}
+
+template < typename R, typename D >
+const typename R::tensor_type& fill(
+    R *r, const typename R::tensor_type &t, D *d) {
+  t.detach();
+  return fill(r, t, d, Splittable< typename R::generator_type >());
+}
+
+// Samples go to the tensor directly if it has the sampler's type
+template < typename F >
+F* samplePointer(F *pointer, ::std::true_type) {
+  return pointer;
+}
+
+template < typename F, typename P >
+F* samplePointer(P *, ::std::false_type) {
+  return nullptr;
+}
+
+template < typename R, typename D, typename S >
+const typename R::tensor_type& sample(
+    R *r, const typename R::tensor_type &t, D *d, const S &,
+    ::std::false_type) {
+  return fill(r, t, d, ::std::false_type());
+}
+
+// Splittable generators draw each chunk in bulk from raw words
+template < typename R, typename D, typename S >
+const typename R::tensor_type& sample(
+    R *r, const typename R::tensor_type &t, D *, const S &s,
+    ::std::true_type) {
+  typedef typename R::tensor_type T;
+  typedef typename R::generator_type G;
+  typedef typename R::float_type F;
+  typedef typename T::size_type size_type;
+  const G &generator = r->generator();
+  size_type length = t.length();
+  size_type chunks = (length + chunk - 1) / chunk;
+  tensor::parallel::forRange(
+      chunks, 1, [&](::std::size_t begin, ::std::size_t end) {
+        ::std::vector< typename G::result_type > words(s.words(chunk));
+        ::std::vector< F > values;
+        for (::std::size_t c = begin; c < end; ++c) {
+          G g = generator.split(c);
+          size_type n = ::std::min(
+              static_cast< size_type >(chunk), length - c * chunk);
+          g.generate(words.data(), words.data() + s.words(n));
+          tensor::StridedCursor< T > cursor(t, c * chunk);
+          F *x = samplePointer< F >(
+              cursor.data(), ::std::is_same< F, typename T::value_type >());
+          if (x != nullptr && cursor.step() == 1 && cursor.run() >= n) {
+            s(words.data(), n, x);
+            continue;
+          }
+          values.resize(chunk);
+          s(words.data(), n, values.data());
+          for (size_type i = 0; i < n;) {
+            size_type run = ::std::min(cursor.run(), n - i);
+            typename T::pointer pointer = cursor.data();
+            typename T::difference_type step = cursor.step();
+            for (size_type j = 0; j < run; ++j) {
+              pointer[j * step] = static_cast< typename T::value_type >(
+                  values[i + j]);
+            }
+            cursor.advance(run);
+            i = i + run;
+          }
+        }
+      });
+  r->generator().discard(G::block);
+  return t;
+}
+
+template < typename R, typename D, typename S >
+const typename R::tensor_type& sample(
+    R *r, const typename R::tensor_type &t, D *d, const S &s) {
+  t.detach();
+  return sample(r, t, d, s, Splittable< typename R::generator_type >());
+}
+
+template < typename R >
+const typename R::tensor_type& random(
+    R *r, const typename R::tensor_type &t, typename R::integer_type a,
+    typename R::integer_type b) {
+  typedef typename R::integer_type I;
+  typedef typename R::float_type F;
+  ::std::uniform_int_distribution< I > distribution(a, b);
+  return fill(r, t, &distribution);
+}
+
 template < typename R >
 const typename R::tensor_type& uniform(
     R *r, const typename R::tensor_type &t, typename R::float_type a,
     typename R::float_type b) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::uniform_real_distribution< F > distribution(a, b);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::Uniform< F >(a, b));
 }
 
 template < typename R >
 const typename R::tensor_type& bernoulli(
     R *r, const typename R::tensor_type &t, typename R::float_type p) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::bernoulli_distribution distribution(p);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& binomial(
     R *r, const typename R::tensor_type &t, typename R::integer_type s,
     typename R::float_type p) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::binomial_distribution< I > distribution(s, p);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& negativeBinomial(
     R *r, const typename R::tensor_type &t, typename R::integer_type k,
     typename R::float_type p) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::negative_binomial_distribution< I > distribution(k, p);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& geometric(
     R *r, const typename R::tensor_type &t, typename R::float_type p) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::geometric_distribution< I > distribution(p);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& poisson(
     R *r, const typename R::tensor_type &t, typename R::float_type mean) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::poisson_distribution< I > distribution(mean);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& exponential(
     R *r, const typename R::tensor_type &t, typename R::float_type lambda) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::exponential_distribution< F > distribution(lambda);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::Exponential< F >(lambda));
 }
 
 template < typename R >
 const typename R::tensor_type& gamma(
     R *r, const typename R::tensor_type &t, typename R::float_type alpha,
     typename R::float_type beta) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::gamma_distribution< F > distribution(alpha, beta);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& weibull(
     R *r, const typename R::tensor_type &t, typename R::float_type a,
     typename R::float_type b) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::weibull_distribution< F > distribution(a, b);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::Weibull< F >(a, b));
 }
 
 template < typename R >
 const typename R::tensor_type& extremeValue(
     R *r, const typename R::tensor_type &t, typename R::float_type a,
     typename R::float_type b) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::extreme_value_distribution< F > distribution(a, b);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::ExtremeValue< F >(a, b));
 }
 
 template < typename R >
 const typename R::tensor_type& normal(
     R *r, const typename R::tensor_type &t, typename R::float_type mean,
     typename R::float_type stddev) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::normal_distribution< F > distribution(mean, stddev);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::Normal< F >(mean, stddev));
 }
 
 template < typename R >
 const typename R::tensor_type& logNormal(
     R *r, const typename R::tensor_type &t, typename R::float_type m,
     typename R::float_type s) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::lognormal_distribution< F > distribution(m, s);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::LogNormal< F >(m, s));
 }
 
 template < typename R >
 const typename R::tensor_type& chiSquared(
     R *r, const typename R::tensor_type &t, typename R::float_type n) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::chi_squared_distribution< F > distribution(n);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& cauchy(
     R *r, const typename R::tensor_type &t, typename R::float_type a,
     typename R::float_type b) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::cauchy_distribution< F > distribution(a, b);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return sample(r, t, &distribution, sampler::Cauchy< F >(a, b));
 }
 
 template < typename R >
 const typename R::tensor_type& fisherF(
     R *r, const typename R::tensor_type &t, typename R::float_type m,
     typename R::float_type n) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::fisher_f_distribution< F > distribution(m, n);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 template < typename R >
 const typename R::tensor_type& studentT(
     R *r, const typename R::tensor_type &t, typename R::float_type n) {
-  typedef typename R::tensor_type T;
-  typedef typename R::generator_type G;
   typedef typename R::integer_type I;
   typedef typename R::float_type F;
   ::std::student_t_distribution< F > distribution(n);
-  if (t.partialContiguity(0, t.dimension() - 1)) {
-    typename T::pointer t_pointer = t.data();
-    typename T::size_type t_length = t.length();
-    typename T::difference_type t_step = t.stride(t.dimension() - 1);
-    for (typename T::size_type i = 0; i < t_length; ++i) {
-      t_pointer[i * t_step] = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  } else {
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      *t_begin = static_cast< typename T::value_type >(
-          distribution(r->generator()));
-    }
-  }
-  return t;
+  return fill(r, t, &distribution);
 }
 
 }  // namespace math
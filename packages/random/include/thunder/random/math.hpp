@@ -20,10 +20,26 @@
 #ifndef THUNDER_RANDOM_MATH_HPP_
 #define THUNDER_RANDOM_MATH_HPP_
 
+#include <cstddef>
+
 namespace thunder {
 namespace random {
 namespace math {
 
+// Number of elements filled from each stream of splittable generators
+const ::std::size_t chunk = 4096;
+
+// Fill t with values drawn from distribution d
+template < typename R, typename D >
+const typename R::tensor_type& fill(
+    R *r, const typename R::tensor_type &t, D *d);
+
+// Fill t using sampler s for generators that support split(), and
+// distribution d otherwise
+template < typename R, typename D, typename S >
+const typename R::tensor_type& sample(
+    R *r, const typename R::tensor_type &t, D *d, const S &s);
+
 template < typename R >
 const typename R::tensor_type& random(
     R *r, const typename R::tensor_type &t, typename R::integer_type a,
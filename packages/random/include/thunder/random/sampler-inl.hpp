@@ -0,0 +1,182 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_RANDOM_SAMPLER_INL_HPP_
+#define THUNDER_RANDOM_SAMPLER_INL_HPP_
+
+#include "thunder/random/sampler.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "thunder/tensor/simd.hpp"
+
+namespace thunder {
+namespace random {
+namespace sampler {
+
+// Values are centered in 2^23 or 2^52 bins, which are exact and never 0 or 1
+inline float Canonical< float >::get(const ::std::uint32_t *w,
+                                     ::std::size_t i) {
+  return (static_cast< float >(w[i] >> 9) + 0.5f) * 1.1920928955078125e-7f;
+}
+
+inline double Canonical< double >::get(const ::std::uint32_t *w,
+                                       ::std::size_t i) {
+  ::std::uint64_t v = (static_cast< ::std::uint64_t >(w[2 * i]) << 20) |
+      (w[2 * i + 1] >> 12);
+  return (static_cast< double >(v) + 0.5) * 2.220446049250313080847e-16;
+}
+
+template < typename F >
+Uniform< F >::Uniform(F a, F b) : a_(a), b_(b) {}
+
+template < typename F >
+::std::size_t Uniform< F >::words(::std::size_t n) const {
+  return n * Canonical< F >::words;
+}
+
+template < typename F >
+void Uniform< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = Canonical< F >::get(w, i);
+  }
+  tensor::simd::fma(x, nullptr, b_ - a_, nullptr, a_, n);
+}
+
+template < typename F >
+Normal< F >::Normal(F mean, F stddev) : mean_(mean), stddev_(stddev) {}
+
+template < typename F >
+::std::size_t Normal< F >::words(::std::size_t n) const {
+  return (n + 1) / 2 * 2 * Canonical< F >::words;
+}
+
+template < typename F >
+void Normal< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  const F pi2 = static_cast< F >(6.283185307179586476925);
+  ::std::size_t h = n / 2;
+  for (::std::size_t i = 0; i < h; ++i) {
+    F r = ::std::sqrt(-2 * ::std::log(Canonical< F >::get(w, 2 * i)));
+    F theta = pi2 * Canonical< F >::get(w, 2 * i + 1);
+    x[2 * i] = r * ::std::cos(theta);
+    x[2 * i + 1] = r * ::std::sin(theta);
+  }
+  if (n % 2 == 1) {
+    F r = ::std::sqrt(-2 * ::std::log(Canonical< F >::get(w, 2 * h)));
+    x[2 * h] = r * ::std::cos(pi2 * Canonical< F >::get(w, 2 * h + 1));
+  }
+  tensor::simd::fma(x, nullptr, stddev_, nullptr, mean_, n);
+}
+
+template < typename F >
+LogNormal< F >::LogNormal(F m, F s) : normal_(m, s) {}
+
+template < typename F >
+::std::size_t LogNormal< F >::words(::std::size_t n) const {
+  return normal_.words(n);
+}
+
+template < typename F >
+void LogNormal< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  normal_(w, n, x);
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = ::std::exp(x[i]);
+  }
+}
+
+template < typename F >
+Exponential< F >::Exponential(F lambda) : lambda_(lambda) {}
+
+template < typename F >
+::std::size_t Exponential< F >::words(::std::size_t n) const {
+  return n * Canonical< F >::words;
+}
+
+template < typename F >
+void Exponential< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = ::std::log(Canonical< F >::get(w, i));
+  }
+  tensor::simd::fma(x, nullptr, -1 / lambda_, nullptr, 0, n);
+}
+
+template < typename F >
+Cauchy< F >::Cauchy(F a, F b) : a_(a), b_(b) {}
+
+template < typename F >
+::std::size_t Cauchy< F >::words(::std::size_t n) const {
+  return n * Canonical< F >::words;
+}
+
+template < typename F >
+void Cauchy< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  const F pi = static_cast< F >(3.141592653589793238463);
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = ::std::tan(pi * Canonical< F >::get(w, i) - pi / 2);
+  }
+  tensor::simd::fma(x, nullptr, b_, nullptr, a_, n);
+}
+
+template < typename F >
+Weibull< F >::Weibull(F a, F b) : a_(a), b_(b) {}
+
+template < typename F >
+::std::size_t Weibull< F >::words(::std::size_t n) const {
+  return n * Canonical< F >::words;
+}
+
+template < typename F >
+void Weibull< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  F k = 1 / a_;
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = ::std::pow(-::std::log(Canonical< F >::get(w, i)), k);
+  }
+  tensor::simd::fma(x, nullptr, b_, nullptr, 0, n);
+}
+
+template < typename F >
+ExtremeValue< F >::ExtremeValue(F a, F b) : a_(a), b_(b) {}
+
+template < typename F >
+::std::size_t ExtremeValue< F >::words(::std::size_t n) const {
+  return n * Canonical< F >::words;
+}
+
+template < typename F >
+void ExtremeValue< F >::operator()(
+    const ::std::uint32_t *w, ::std::size_t n, F *x) const {
+  for (::std::size_t i = 0; i < n; ++i) {
+    x[i] = ::std::log(-::std::log(Canonical< F >::get(w, i)));
+  }
+  tensor::simd::fma(x, nullptr, -b_, nullptr, a_, n);
+}
+
+}  // namespace sampler
+}  // namespace random
+}  // namespace thunder
+
+#endif  // THUNDER_RANDOM_SAMPLER_INL_HPP_
@@ -0,0 +1,132 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_RANDOM_SAMPLER_HPP_
+#define THUNDER_RANDOM_SAMPLER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace thunder {
+namespace random {
+namespace sampler {
+
+// Uniform values in the open interval (0, 1) built from raw 32-bit words.
+// Floats take one word per value and doubles take two.
+template < typename F >
+struct Canonical;
+
+template < >
+struct Canonical< float > {
+  static const ::std::size_t words = 1;
+  static float get(const ::std::uint32_t *w, ::std::size_t i);
+};
+
+template < >
+struct Canonical< double > {
+  static const ::std::size_t words = 2;
+  static double get(const ::std::uint32_t *w, ::std::size_t i);
+};
+
+// Samplers turn words(n) raw words into n values of a distribution at once.
+// The parameters follow the distributions of the standard library.
+template < typename F >
+class Uniform {
+ public:
+  Uniform(F a, F b);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F a_, b_;
+};
+
+// Box-Muller transform on pairs of uniform values
+template < typename F >
+class Normal {
+ public:
+  Normal(F mean, F stddev);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F mean_, stddev_;
+};
+
+template < typename F >
+class LogNormal {
+ public:
+  LogNormal(F m, F s);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  Normal< F > normal_;
+};
+
+// The following are sampled by inverse cumulative distribution functions
+template < typename F >
+class Exponential {
+ public:
+  explicit Exponential(F lambda);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F lambda_;
+};
+
+template < typename F >
+class Cauchy {
+ public:
+  Cauchy(F a, F b);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F a_, b_;
+};
+
+template < typename F >
+class Weibull {
+ public:
+  Weibull(F a, F b);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F a_, b_;
+};
+
+template < typename F >
+class ExtremeValue {
+ public:
+  ExtremeValue(F a, F b);
+  ::std::size_t words(::std::size_t n) const;
+  void operator()(const ::std::uint32_t *w, ::std::size_t n, F *x) const;
+
+ private:
+  F a_, b_;
+};
+
+}  // namespace sampler
+}  // namespace random
+}  // namespace thunder
+
+#endif  // THUNDER_RANDOM_SAMPLER_HPP_
@@ -19,12 +19,15 @@
 
 #include "thunder/random/random.hpp"
 
+#include <cstdint>
 #include <ctime>
 #include <random>
 
+#include "thunder/random/counter.hpp"
 #include "thunder/random/math.hpp"
 #include "thunder/tensor.hpp"
 
+#include "thunder/random/counter-inl.hpp"
 #include "thunder/random/math-inl.hpp"
 #include "thunder/random/random-inl.hpp"
 
@@ -49,5 +52,34 @@ THUNDER_RANDOM_INSTANTIATE_MT19937(
 
 #undef THUNDR_RANDOM_INSTANTIATE_MT19937
 
+template struct Philox4x32Block< 10 >;
+template struct Threefry4x32Block< 20 >;
+template class CounterEngine< Philox4x32Block< 10 > >;
+template class CounterEngine< Threefry4x32Block< 20 > >;
+
+#define THUNDER_RANDOM_INSTANTIATE_COUNTER(T, G, I, F)                  \
+  template class Random< T, G, I, F >;                                  \
+  template Random< T, G, I, F >::Random();                              \
+  template Random< T, G, I, F >::Random(::std::uint64_t val);           \
+  template Random< T, G, I, F >::Random(int val);                       \
+  template Random< T, G, I, F >::Random(::std::time_t val);             \
+  template Random< T, G, I, F >::Random(::std::seed_seq q);
+
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    DoubleTensor, Philox4x32, int, typename DoubleTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    FloatTensor, Philox4x32, int, typename FloatTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    SizeTensor, Philox4x32, typename SizeTensor::value_type, double);
+
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    DoubleTensor, Threefry4x32, int, typename DoubleTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    FloatTensor, Threefry4x32, int, typename FloatTensor::value_type);
+THUNDER_RANDOM_INSTANTIATE_COUNTER(
+    SizeTensor, Threefry4x32, typename SizeTensor::value_type, double);
+
+#undef THUNDER_RANDOM_INSTANTIATE_COUNTER
+
 }  // namespace random
 }  // namespace thunder
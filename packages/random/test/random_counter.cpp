@@ -0,0 +1,157 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/random.hpp"
+
+#include <cstdint>
+#include <random>
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+template < typename B >
+void expectBlock(::std::uint32_t c0, ::std::uint32_t c1, ::std::uint32_t c2,
+                 ::std::uint32_t c3, ::std::uint32_t k0, ::std::uint32_t k1,
+                 ::std::uint32_t k2, ::std::uint32_t k3, ::std::uint32_t r0,
+                 ::std::uint32_t r1, ::std::uint32_t r2, ::std::uint32_t r3) {
+  ::std::uint32_t counter[4] = {c0, c1, c2, c3};
+  ::std::uint32_t key[4] = {k0, k1, k2, k3};
+  ::std::uint32_t result[4];
+  B::generate(counter, key, result);
+  EXPECT_EQ(r0, result[0]);
+  EXPECT_EQ(r1, result[1]);
+  EXPECT_EQ(r2, result[2]);
+  EXPECT_EQ(r3, result[3]);
+}
+
+TEST(CounterTest, knownAnswerTest) {
+  // Known answers of the Random123 library
+  typedef random::Philox4x32Block< 10 > P;
+  expectBlock< P >(0, 0, 0, 0, 0, 0, 0, 0,
+                   0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8);
+  expectBlock< P >(0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                   0xffffffff, 0xffffffff, 0, 0,
+                   0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd);
+  expectBlock< P >(0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+                   0xa4093822, 0x299f31d0, 0, 0,
+                   0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1);
+
+  typedef random::Threefry4x32Block< 20 > T;
+  expectBlock< T >(0, 0, 0, 0, 0, 0, 0, 0,
+                   0x9c6ca96a, 0xe17eae66, 0xfc10ecd4, 0x5256a7d8);
+  expectBlock< T >(0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                   0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                   0x2a881696, 0x57012287, 0xf6c7446e, 0xa16a6732);
+  expectBlock< T >(0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+                   0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89,
+                   0x59cd1dbb, 0xb8879579, 0x86b5d00c, 0xac8b6d84);
+}
+
+template < typename G >
+void engineTest() {
+  // Discarding is the same as generating
+  for (unsigned long long n = 0; n < 20; ++n) {
+    G g1(91857), g2(91857);
+    for (unsigned long long i = 0; i < n; ++i) {
+      g1();
+    }
+    g2.discard(n);
+    EXPECT_TRUE(g1 == g2);
+    EXPECT_EQ(g1(), g2());
+  }
+
+  // Split streams differ from each other and from the parent
+  G g(91857);
+  G s1 = g.split(0), s2 = g.split(1);
+  EXPECT_TRUE(s1 == g.split(0));
+  EXPECT_NE(s1(), s2());
+  EXPECT_NE(G(91857)(), G(91857).split(0)());
+  g.discard(G::block);
+  EXPECT_TRUE(g.split(0) != G(91857).split(0));
+}
+
+TEST(CounterTest, philoxEngineTest) {
+  engineTest< random::Philox4x32 >();
+}
+
+TEST(CounterTest, threefryEngineTest) {
+  engineTest< random::Threefry4x32 >();
+}
+
+template < typename R >
+void fillTest() {
+  typedef typename R::tensor_type T;
+  typedef typename R::generator_type G;
+  typedef typename R::integer_type I;
+
+  // Each chunk of elements is drawn from the stream split by its index
+  R rand1(91857);
+  T t1 = rand1.random({3, 50, 70}, 0, 1000);
+  G gen(91857);
+  ::std::size_t index = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++index) {
+    G g = gen.split(index);
+    ::std::uniform_int_distribution< I > dist(0, 1000);
+    for (::std::size_t i = 0; i < random::math::chunk && begin != end;
+         ++i, ++begin) {
+      EXPECT_EQ(static_cast< typename T::value_type >(dist(g)), *begin);
+    }
+  }
+
+  // The result does not depend on the number of threads
+  tensor::parallel::setThreads(1);
+  R rand2(91857);
+  T t2 = rand2.uniform(T(9, 70, 50).transpose(0, 2));
+  T t3 = rand2.normal({9, 70, 50});
+  tensor::parallel::setThreads(4);
+  R rand3(91857);
+  T t4 = rand3.uniform(T(9, 70, 50).transpose(0, 2));
+  T t5 = rand3.normal({9, 70, 50});
+  for (typename T::reference_iterator t2_begin = t2.reference_begin(),
+           t2_end = t2.reference_end(), t4_begin = t4.reference_begin();
+       t2_begin != t2_end; ++t2_begin, ++t4_begin) {
+    EXPECT_EQ(*t2_begin, *t4_begin);
+  }
+  for (typename T::size_type i = 0; i < t3.length(); ++i) {
+    EXPECT_EQ(t3.data()[i], t5.data()[i]);
+  }
+  tensor::parallel::setThreads(0);
+
+  // Consecutive fills use different streams
+  EXPECT_NE(t3.data()[0], rand3.normal({9, 70, 50}).data()[0]);
+  EXPECT_NEAR(0.0, t3.mean(), 0.05);
+  EXPECT_NEAR(1.0, t3.var(), 0.05);
+  EXPECT_NEAR(0.5, t2.mean(), 0.05);
+}
+
+TEST(CounterTest, philoxFillTest) {
+  fillTest< DoublePhiloxRandom >();
+  fillTest< FloatPhiloxRandom >();
+}
+
+TEST(CounterTest, threefryFillTest) {
+  fillTest< DoubleThreefryRandom >();
+  fillTest< FloatThreefryRandom >();
+}
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,130 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/random.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "thunder/random/sampler.hpp"
+#include "thunder/random/sampler-inl.hpp"
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+// Checks the values against the sampler applied to each chunk, and returns
+// the mean and variance of the values
+template < typename R, typename S, typename U >
+void samplerTest(const S &s, const U &func, double mean, double var) {
+  typedef typename R::tensor_type T;
+  typedef typename R::generator_type G;
+  typedef typename R::float_type F;
+
+  R rand1(91857);
+  T t1 = func(&rand1, T(4, 50, 70));
+  G gen(91857);
+  ::std::vector< ::std::uint32_t > words;
+  ::std::vector< F > values(random::math::chunk);
+  for (::std::size_t c = 0; c * random::math::chunk < t1.length(); ++c) {
+    G g = gen.split(c);
+    ::std::size_t n = ::std::min(
+        random::math::chunk, t1.length() - c * random::math::chunk);
+    words.resize(s.words(n));
+    g.generate(words.data(), words.data() + words.size());
+    s(words.data(), n, values.data());
+    for (::std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(values[i], t1.data()[c * random::math::chunk + i]);
+    }
+  }
+  EXPECT_NEAR(mean, t1.mean(), 0.02 + 0.02 * ::std::fabs(mean));
+  EXPECT_NEAR(var, t1.var(), 0.05 * var);
+
+  // Strided tensors receive the same values in iterator order
+  R rand2(91857);
+  T t2 = func(&rand2, T(70, 50, 4).transpose(0, 2));
+  typename T::pointer t1_pointer = t1.data();
+  for (typename T::reference_iterator begin = t2.reference_begin(),
+           end = t2.reference_end(); begin != end; ++begin, ++t1_pointer) {
+    EXPECT_EQ(*t1_pointer, *begin);
+  }
+}
+
+template < typename R >
+void samplersTest() {
+  typedef typename R::tensor_type T;
+  typedef typename R::float_type F;
+  samplerTest< R >(random::sampler::Uniform< F >(-1, 3), [](R *r, T t) {
+      return r->uniform(t, -1, 3); }, 1, 16.0 / 12);
+  samplerTest< R >(random::sampler::Normal< F >(1, 2), [](R *r, T t) {
+      return r->normal(t, 1, 2); }, 1, 4);
+  samplerTest< R >(random::sampler::LogNormal< F >(0, 0.5), [](R *r, T t) {
+      return r->logNormal(t, 0, 0.5); }, ::std::exp(0.125),
+    (::std::exp(0.25) - 1) * ::std::exp(0.25));
+  samplerTest< R >(random::sampler::Exponential< F >(2), [](R *r, T t) {
+      return r->exponential(t, 2); }, 0.5, 0.25);
+  samplerTest< R >(random::sampler::Weibull< F >(2, 1), [](R *r, T t) {
+      return r->weibull(t, 2, 1); }, 0.886226925, 1 - 0.785398163);
+  samplerTest< R >(random::sampler::ExtremeValue< F >(0, 1), [](R *r, T t) {
+      return r->extremeValue(t, 0, 1); }, 0.577215665, 1.644934067);
+
+  // Cauchy values have no moments, but half of them are within the scale
+  R rand(91857);
+  T t = rand.cauchy({4, 50, 70}, 1, 2);
+  ::std::size_t count = 0;
+  for (typename T::size_type i = 0; i < t.length(); ++i) {
+    count += ::std::fabs(t.data()[i] - 1) < 2 ? 1 : 0;
+  }
+  EXPECT_NEAR(0.5, static_cast< double >(count) / t.length(), 0.02);
+}
+
+TEST(SamplerTest, philoxTest) {
+  samplersTest< DoublePhiloxRandom >();
+  samplersTest< FloatPhiloxRandom >();
+}
+
+TEST(SamplerTest, threefryTest) {
+  samplersTest< DoubleThreefryRandom >();
+  samplersTest< FloatThreefryRandom >();
+}
+
+TEST(SamplerTest, sizeTest) {
+  // Values are converted when the tensor type is not the float type
+  SizePhiloxRandom rand(91857);
+  SizeTensor t = rand.uniform({4, 50, 70}, 0, 100);
+  double sum = 0;
+  for (SizeTensor::size_type i = 0; i < t.length(); ++i) {
+    EXPECT_GT(100, t.data()[i]);
+    sum += t.data()[i];
+  }
+  EXPECT_NEAR(49.5, sum / t.length(), 1);
+}
+
+TEST(SamplerTest, canonicalTest) {
+  ::std::uint32_t words[] = {0, 0, 0xFFFFFFFF, 0xFFFFFFFF};
+  EXPECT_LT(0.0f, random::sampler::Canonical< float >::get(words, 0));
+  EXPECT_GT(1.0f, random::sampler::Canonical< float >::get(words, 2));
+  EXPECT_LT(0.0, random::sampler::Canonical< double >::get(words, 0));
+  EXPECT_GT(1.0, random::sampler::Canonical< double >::get(words, 1));
+}
+
+}  // namespace
+}  // namespace thunder
@@ -22,10 +22,13 @@
 
 #include "thunder/serializer/binary_protocol.hpp"
 
+#include <complex>
+#include <cstddef>
 #include <cstring>
 #include <iomanip>
 #include <ios>
 #include <limits>
+#include <type_traits>
 
 #include "thunder/serializer/serializer.hpp"
 #include "thunder/serializer/static.hpp"
@@ -61,7 +64,76 @@ void BinaryProtocol< M >::load(S *s, T *t) {
   ::thunder::serializer::load(s, t);
 }
 
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::saveArray(S *s, const T *t, ::std::size_t n) {
+  saveArray(s, t, n, typename ::std::is_arithmetic< T >::type());
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::loadArray(S *s, T *t, ::std::size_t n) {
+  loadArray(s, t, n, typename ::std::is_arithmetic< T >::type());
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::saveArray(
+    S *s, const ::std::complex< T > *t, ::std::size_t n) {
+  // Complex numbers are laid out as arrays of real and imaginary parts
+  saveArray(s, reinterpret_cast< const T* >(t), 2 * n);
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::loadArray(
+    S *s, ::std::complex< T > *t, ::std::size_t n) {
+  loadArray(s, reinterpret_cast< T* >(t), 2 * n);
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::saveArray(
+    S *s, const T *t, ::std::size_t n, ::std::true_type) {
+  if (sizeof(T) % sizeof(char_type) == 0) {
+    stream_.write(reinterpret_cast< const char_type* >(t),
+                  static_cast< ::std::streamsize >(
+                      n * (sizeof(T) / sizeof(char_type))));
+  } else {
+    saveArray(s, t, n, ::std::false_type());
+  }
+}
 
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::saveArray(
+    S *s, const T *t, ::std::size_t n, ::std::false_type) {
+  for (::std::size_t i = 0; i < n; ++i) {
+    s->save(t[i]);
+  }
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::loadArray(
+    S *s, T *t, ::std::size_t n, ::std::true_type) {
+  if (sizeof(T) % sizeof(char_type) == 0) {
+    stream_.read(reinterpret_cast< char_type* >(t),
+                 static_cast< ::std::streamsize >(
+                     n * (sizeof(T) / sizeof(char_type))));
+  } else {
+    loadArray(s, t, n, ::std::false_type());
+  }
+}
+
+template < typename M >
+template < typename S, typename T >
+void BinaryProtocol< M >::loadArray(
+    S *s, T *t, ::std::size_t n, ::std::false_type) {
+  for (::std::size_t i = 0; i < n; ++i) {
+    s->load(&t[i]);
+  }
+}
 
 #define THUNDER_SERIALIZER_BINARY_PROTOCOL_DEFINE(TYPE)                 \
   template < typename M >                                               \
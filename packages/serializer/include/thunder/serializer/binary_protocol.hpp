@@ -20,7 +20,10 @@
 #ifndef THUNDER_SERIALIZER_BINARY_PROTOCOL_HPP_
 #define THUNDER_SERIALIZER_BINARY_PROTOCOL_HPP_
 
+#include <complex>
+#include <cstddef>
 #include <sstream>
+#include <type_traits>
 
 namespace thunder {
 namespace serializer {
@@ -47,6 +50,16 @@ class BinaryProtocol {
   template < typename S, typename T >
   void load(S *s, T *t);
 
+  // Save and load of n contiguous elements
+  template < typename S, typename T >
+  void saveArray(S *s, const T *t, ::std::size_t n);
+  template < typename S, typename T >
+  void loadArray(S *s, T *t, ::std::size_t n);
+  template < typename S, typename T >
+  void saveArray(S *s, const ::std::complex< T > *t, ::std::size_t n);
+  template < typename S, typename T >
+  void loadArray(S *s, ::std::complex< T > *t, ::std::size_t n);
+
   // Listing of fundamental C++11 character type serialization
   template < typename S >
   void save(S *s, const char &t);
@@ -122,6 +135,17 @@ class BinaryProtocol {
   void load(S *s, long double *t);
 
  private:
+  // Arithmetic arrays are written in a single call when their size is a
+  // multiple of char_type, otherwise element by element
+  template < typename S, typename T >
+  void saveArray(S *s, const T *t, ::std::size_t n, ::std::true_type);
+  template < typename S, typename T >
+  void saveArray(S *s, const T *t, ::std::size_t n, ::std::false_type);
+  template < typename S, typename T >
+  void loadArray(S *s, T *t, ::std::size_t n, ::std::true_type);
+  template < typename S, typename T >
+  void loadArray(S *s, T *t, ::std::size_t n, ::std::false_type);
+
   stream_type stream_;
 };
 
@@ -22,6 +22,7 @@
 
 #include "thunder/serializer/serializer.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace thunder {
@@ -56,6 +57,18 @@ void Serializer< P >::load(T *t) {
   protocol_.load(this, t);
 }
 
+template < typename P >
+template < typename T >
+void Serializer< P >::saveArray(const T *t, ::std::size_t n) {
+  protocol_.saveArray(this, t, n);
+}
+
+template < typename P >
+template < typename T >
+void Serializer< P >::loadArray(T *t, ::std::size_t n) {
+  protocol_.loadArray(this, t, n);
+}
+
 template < typename P >
 template < typename T >
 void Serializer< P >::save(T* const &t) {
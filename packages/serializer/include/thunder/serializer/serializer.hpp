@@ -20,6 +20,7 @@
 #ifndef THUNDER_SERIALIZER_SERIALIZER_HPP_
 #define THUNDER_SERIALIZER_SERIALIZER_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -51,6 +52,13 @@ class Serializer {
   template < typename T >
   void load(T *t);
 
+  // Array save and load of n contiguous elements. The format is the same as
+  // saving each element, but protocols may write the array at once.
+  template < typename T >
+  void saveArray(const T *t, ::std::size_t n);
+  template < typename T >
+  void loadArray(T *t, ::std::size_t n);
+
   // Pointer save: record the saved pointer
   template < typename T >
   void save(T* const &t);
@@ -22,6 +22,7 @@
 
 #include "thunder/serializer/text_protocol.hpp"
 
+#include <cstddef>
 #include <iomanip>
 #include <ios>
 #include <limits>
@@ -60,6 +61,22 @@ void TextProtocol< M >::load(S *s, T *t) {
   ::thunder::serializer::load(s, t);
 }
 
+template < typename M >
+template < typename S, typename T >
+void TextProtocol< M >::saveArray(S *s, const T *t, ::std::size_t n) {
+  for (::std::size_t i = 0; i < n; ++i) {
+    s->save(t[i]);
+  }
+}
+
+template < typename M >
+template < typename S, typename T >
+void TextProtocol< M >::loadArray(S *s, T *t, ::std::size_t n) {
+  for (::std::size_t i = 0; i < n; ++i) {
+    s->load(&t[i]);
+  }
+}
+
 #define THUNDER_SERIALIZER_TEXT_PROTOCOL_DEFINE_CHAR(CHAR_TYPE, INT_TYPE) \
   template < typename M >                                               \
   template < typename S >                                               \
@@ -20,6 +20,7 @@
 #ifndef THUNDER_SERIALIZER_TEXT_PROTOCOL_HPP_
 #define THUNDER_SERIALIZER_TEXT_PROTOCOL_HPP_
 
+#include <cstddef>
 #include <sstream>
 
 namespace thunder {
@@ -46,6 +47,12 @@ class TextProtocol {
   template < typename S, typename T >
   void load(S *s, T *t);
 
+  // Save and load of n contiguous elements
+  template < typename S, typename T >
+  void saveArray(S *s, const T *t, ::std::size_t n);
+  template < typename S, typename T >
+  void loadArray(S *s, T *t, ::std::size_t n);
+
   // Listing of fundamental C++11 character type serialization
   template < typename S >
   void save(S *s, const char &t);
@@ -19,6 +19,7 @@
 
 #include "thunder/serializer/serializer.hpp"
 
+#include <complex>
 #include <ios>
 #include <memory>
 #include <sstream>
@@ -26,7 +27,11 @@
 
 #include "gtest/gtest.h"
 #include "thunder/serializer.hpp"
+#include "thunder/serializer/binary_protocol.hpp"
+#include "thunder/serializer/binary_protocol-inl.hpp"
 #include "thunder/serializer/serializer-inl.hpp"
+#include "thunder/serializer/static.hpp"
+#include "thunder/serializer/static-inl.hpp"
 #include "thunder/serializer/text_protocol.hpp"
 #include "thunder/serializer/text_protocol-inl.hpp"
 
@@ -208,5 +213,46 @@ TEST(SerializerTest, pointerTest) {
   pointerTest< StringTextSerializer, int >();
 }
 
+template < typename S, typename T >
+void arrayTest() {
+  T array_saved[9];
+  for (int i = 0; i < 9; ++i) {
+    array_saved[i] = static_cast< T >(3 * i - 7);
+  }
+
+  // Array and per-element serialization produce the same stream, except for
+  // the unspecified padding of elements smaller than the stream characters
+  S s1;
+  S s2;
+  s1.saveArray(array_saved, 9);
+  for (int i = 0; i < 9; ++i) {
+    s2.save(array_saved[i]);
+  }
+  if (sizeof(T) >= sizeof(typename S::stream_type::char_type)) {
+    EXPECT_EQ(s1.protocol().stream().str(), s2.protocol().stream().str());
+  }
+
+  T array_loaded[9];
+  s1.loadArray(array_loaded, 9);
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(array_saved[i], array_loaded[i]);
+  }
+}
+
+TEST(SerializerTest, arrayTest) {
+  typedef Serializer< BinaryProtocol< ::std::wstringstream > >
+      WideBinarySerializer;
+  arrayTest< StringTextSerializer, int >();
+  arrayTest< StringTextSerializer, double >();
+  arrayTest< StringTextSerializer, ::std::complex< float > >();
+  arrayTest< StringBinarySerializer, char >();
+  arrayTest< StringBinarySerializer, int >();
+  arrayTest< StringBinarySerializer, double >();
+  arrayTest< StringBinarySerializer, ::std::complex< float > >();
+  arrayTest< WideBinarySerializer, char >();
+  arrayTest< WideBinarySerializer, double >();
+  arrayTest< WideBinarySerializer, ::std::complex< double > >();
+}
+
 }  // namespace serializer
 }  // namespace thunder
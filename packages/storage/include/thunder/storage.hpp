@@ -21,6 +21,9 @@
 #define THUNDER_STORAGE_HPP_
 
 #include "thunder/storage/storage.hpp"
+#include "thunder/storage/allocator.hpp"
+#include "thunder/storage/mapped_storage.hpp"
+#include "thunder/storage/small_storage.hpp"
 
 #include <memory>
 #include <complex>
@@ -36,6 +39,28 @@ typedef Storage< double, ::std::allocator< double > > DoubleStorage;
 typedef Storage< float, ::std::allocator< float > > FloatStorage;
 typedef Storage< ::std::size_t, ::std::allocator< ::std::size_t > > SizeStorage;
 
+template < typename D = double >
+using AlignedStorage = storage::Storage< D, storage::AlignedAllocator< D > >;
+typedef AlignedStorage< double > AlignedDoubleStorage;
+typedef AlignedStorage< float > AlignedFloatStorage;
+typedef AlignedStorage< ::std::complex< double > > AlignedDoubleComplexStorage;
+typedef AlignedStorage< ::std::complex< float > > AlignedFloatComplexStorage;
+
+template < typename D = double >
+using PoolStorage = storage::Storage< D, storage::PoolAllocator< D > >;
+typedef PoolStorage< double > PoolDoubleStorage;
+typedef PoolStorage< float > PoolFloatStorage;
+typedef PoolStorage< ::std::complex< double > > PoolDoubleComplexStorage;
+typedef PoolStorage< ::std::complex< float > > PoolFloatComplexStorage;
+
+template < typename D = double >
+using MappedStorage = storage::MappedStorage< D >;
+typedef MappedStorage< double > MappedDoubleStorage;
+typedef MappedStorage< float > MappedFloatStorage;
+
+template < typename D, ::std::size_t N = 8 >
+using SmallStorage = storage::SmallStorage< D, N >;
+
 template < typename D = double,
            typename A = ::std::allocator< ::std::complex< D > > >
 using ComplexStorage = storage::Storage< ::std::complex< D >, A >;
@@ -56,6 +81,40 @@ extern template class Storage< ::std::complex< float > >;
 extern template class Storage< ::std::size_t >;
 extern template class Storage< ::std::ptrdiff_t >;
 extern template class Storage< ::std::pair< ::std::size_t, ::std::size_t > >;
+extern template class SmallStorage< ::std::size_t >;
+extern template class SmallStorage< ::std::ptrdiff_t >;
+extern template SmallStorage< ::std::size_t >::SmallStorage(
+    const Storage< ::std::size_t > &other);
+extern template
+SmallStorage< ::std::size_t >::operator Storage< ::std::size_t >() const;
+extern template SmallStorage< ::std::ptrdiff_t >::SmallStorage(
+    const Storage< ::std::ptrdiff_t > &other);
+extern template
+SmallStorage< ::std::ptrdiff_t >::operator Storage< ::std::ptrdiff_t >() const;
+extern template class MappedStorage< double >;
+extern template class MappedStorage< float >;
+
+extern template class AlignedAllocator< double >;
+extern template class AlignedAllocator< float >;
+extern template class AlignedAllocator< ::std::complex< double > >;
+extern template class AlignedAllocator< ::std::complex< float > >;
+extern template class Storage< double, AlignedAllocator< double > >;
+extern template class Storage< float, AlignedAllocator< float > >;
+extern template class Storage< ::std::complex< double >,
+                         AlignedAllocator< ::std::complex< double > > >;
+extern template class Storage< ::std::complex< float >,
+                         AlignedAllocator< ::std::complex< float > > >;
+
+extern template class PoolAllocator< double >;
+extern template class PoolAllocator< float >;
+extern template class PoolAllocator< ::std::complex< double > >;
+extern template class PoolAllocator< ::std::complex< float > >;
+extern template class Storage< double, PoolAllocator< double > >;
+extern template class Storage< float, PoolAllocator< float > >;
+extern template class Storage< ::std::complex< double >,
+                         PoolAllocator< ::std::complex< double > > >;
+extern template class Storage< ::std::complex< float >,
+                         PoolAllocator< ::std::complex< float > > >;
 
 }  // namespace storage
 }  // namespace thunder
@@ -105,6 +164,132 @@ namespace serializer {
   extern template void FileTextSerializer::load(                       \
       ::thunder::storage::Storage< D > *t);
 
+#define THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE(D, A)   \
+  extern template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void StringBinarySerializer::load(                   \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void FileBinarySerializer::load(                     \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void StringTextSerializer::save(                     \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void StringTextSerializer::load(                     \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void FileTextSerializer::save(                       \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  extern template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  extern template void FileTextSerializer::load(                       \
+      ::thunder::storage::Storage< D, A< D > > *t);
+
+#define THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(D)          \
+  extern template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void StringBinarySerializer::load(                   \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void FileBinarySerializer::load(                     \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void StringTextSerializer::save(                     \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void StringTextSerializer::load(                     \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void FileTextSerializer::save(                       \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  extern template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  extern template void FileTextSerializer::load(                       \
+      ::thunder::storage::SmallStorage< D > *t);
+
+#define THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(D)         \
+  extern template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void StringBinarySerializer::load(                   \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void FileBinarySerializer::load(                     \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void StringTextSerializer::save(                     \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void StringTextSerializer::load(                     \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void FileTextSerializer::save(                       \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  extern template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  extern template void FileTextSerializer::load(                       \
+      ::thunder::storage::MappedStorage< D > *t);
+
 
 #define THUNDER_STORAGE_EXPAND_SERIALIZE(INSTANTIATE)           \
   INSTANTIATE(double);                                          \
@@ -114,6 +299,12 @@ namespace serializer {
   INSTANTIATE(::std::size_t);                                   \
   INSTANTIATE(::std::ptrdiff_t);
 
+#define THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(INSTANTIATE, A)      \
+  INSTANTIATE(double, A);                                               \
+  INSTANTIATE(float, A);                                                \
+  INSTANTIATE(::std::complex< double >, A);                             \
+  INSTANTIATE(::std::complex< float >, A);
+
 extern template void save(
     StringBinarySerializer *s,
     const ::thunder::storage::Storage<
@@ -172,9 +363,23 @@ extern template void FileTextSerializer::load(
     ::std::pair< ::std::size_t, ::std::size_t > > *t);
 
 THUNDER_STORAGE_EXPAND_SERIALIZE(THUNDER_STORAGE_INSTANTIATE_SERIALIZE);
+THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(::std::size_t);
+THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(::std::ptrdiff_t);
+THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(double);
+THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(float);
+THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(
+    THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE,
+    ::thunder::storage::AlignedAllocator);
+THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(
+    THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE,
+    ::thunder::storage::PoolAllocator);
 
 #undef THUNDER_STORAGE_INSTANTIATE_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE
 #undef THUNDER_STORAGE_EXPAND_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE
+#undef THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE
 
 }  // namespace serializer
 }  // namespace thunder
@@ -0,0 +1,99 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_STORAGE_ALLOCATOR_INL_HPP_
+#define THUNDER_STORAGE_ALLOCATOR_INL_HPP_
+
+#include "thunder/storage/allocator.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace thunder {
+namespace storage {
+
+template < typename T, ::std::size_t N >
+AlignedAllocator< T, N >::AlignedAllocator() {}
+
+template < typename T, ::std::size_t N >
+template < typename U >
+AlignedAllocator< T, N >::AlignedAllocator(const AlignedAllocator< U, N > &) {}
+
+template < typename T, ::std::size_t N >
+typename AlignedAllocator< T, N >::pointer AlignedAllocator< T, N >::allocate(
+    size_type n) {
+  if (n > ::std::numeric_limits< size_type >::max() / sizeof(T)) {
+    throw ::std::bad_alloc();
+  }
+  return static_cast< pointer >(alignedAllocate(n * sizeof(T), N));
+}
+
+template < typename T, ::std::size_t N >
+void AlignedAllocator< T, N >::deallocate(pointer p, size_type) {
+  alignedDeallocate(p);
+}
+
+template < typename T >
+PoolAllocator< T >::PoolAllocator() {}
+
+template < typename T >
+template < typename U >
+PoolAllocator< T >::PoolAllocator(const PoolAllocator< U > &) {}
+
+template < typename T >
+typename PoolAllocator< T >::pointer PoolAllocator< T >::allocate(
+    size_type n) {
+  if (n > ::std::numeric_limits< size_type >::max() / sizeof(T)) {
+    throw ::std::bad_alloc();
+  }
+  return static_cast< pointer >(pool::allocate(n * sizeof(T)));
+}
+
+template < typename T >
+void PoolAllocator< T >::deallocate(pointer p, size_type n) {
+  pool::deallocate(p, n * sizeof(T));
+}
+
+template < typename T, typename U, ::std::size_t N >
+bool operator==(const AlignedAllocator< T, N > &,
+                const AlignedAllocator< U, N > &) {
+  return true;
+}
+
+template < typename T, typename U, ::std::size_t N >
+bool operator!=(const AlignedAllocator< T, N > &,
+                const AlignedAllocator< U, N > &) {
+  return false;
+}
+
+template < typename T, typename U >
+bool operator==(const PoolAllocator< T > &, const PoolAllocator< U > &) {
+  return true;
+}
+
+template < typename T, typename U >
+bool operator!=(const PoolAllocator< T > &, const PoolAllocator< U > &) {
+  return false;
+}
+
+}  // namespace storage
+}  // namespace thunder
+
+#endif  // THUNDER_STORAGE_ALLOCATOR_INL_HPP_
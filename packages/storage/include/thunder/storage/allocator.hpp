@@ -0,0 +1,120 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_STORAGE_ALLOCATOR_HPP_
+#define THUNDER_STORAGE_ALLOCATOR_HPP_
+
+#include <cstddef>
+
+namespace thunder {
+namespace storage {
+
+// Allocate memory aligned to alignment, which must be a power of 2. Throws
+// ::std::bad_alloc on failure. Memory must be freed by alignedDeallocate.
+void* alignedAllocate(::std::size_t bytes, ::std::size_t alignment);
+void alignedDeallocate(void *p);
+
+// Size-class memory pool with thread-local caches. Requests are rounded up to
+// classes of at most 25% overhead, and freed blocks are kept for reuse by
+// later requests of the same class. Blocks are aligned to 64 bytes.
+namespace pool {
+
+void* allocate(::std::size_t bytes);
+void deallocate(void *p, ::std::size_t bytes);
+
+// Maximum number of bytes kept in the pool shared by all threads. Each thread
+// additionally caches a bounded number of blocks.
+void setLimit(::std::size_t bytes);
+::std::size_t getLimit();
+
+// Return cached blocks of the calling thread and the shared pool to the system
+void release();
+
+}  // namespace pool
+
+// Allocator returning memory aligned to N bytes, so that vectorized kernels
+// start at a cache line boundary
+template < typename T, ::std::size_t N = 64 >
+class AlignedAllocator {
+  static_assert(N != 0 && (N & (N - 1)) == 0,
+                "Alignment must be a power of 2.");
+
+ public:
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef ::std::size_t size_type;
+  typedef ::std::ptrdiff_t difference_type;
+
+  template < typename U >
+  struct rebind {
+    typedef AlignedAllocator< U, N > other;
+  };
+
+  AlignedAllocator();
+  template < typename U >
+  AlignedAllocator(const AlignedAllocator< U, N > &other);
+
+  pointer allocate(size_type n);
+  void deallocate(pointer p, size_type n);
+};
+
+// Allocator drawing from the size-class pool, which avoids the system
+// allocator for repeated temporaries of the same size
+template < typename T >
+class PoolAllocator {
+ public:
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef ::std::size_t size_type;
+  typedef ::std::ptrdiff_t difference_type;
+
+  template < typename U >
+  struct rebind {
+    typedef PoolAllocator< U > other;
+  };
+
+  PoolAllocator();
+  template < typename U >
+  PoolAllocator(const PoolAllocator< U > &other);
+
+  pointer allocate(size_type n);
+  void deallocate(pointer p, size_type n);
+};
+
+template < typename T, typename U, ::std::size_t N >
+bool operator==(const AlignedAllocator< T, N > &a,
+                const AlignedAllocator< U, N > &b);
+template < typename T, typename U, ::std::size_t N >
+bool operator!=(const AlignedAllocator< T, N > &a,
+                const AlignedAllocator< U, N > &b);
+template < typename T, typename U >
+bool operator==(const PoolAllocator< T > &a, const PoolAllocator< U > &b);
+template < typename T, typename U >
+bool operator!=(const PoolAllocator< T > &a, const PoolAllocator< U > &b);
+
+}  // namespace storage
+}  // namespace thunder
+
+#endif  // THUNDER_STORAGE_ALLOCATOR_HPP_
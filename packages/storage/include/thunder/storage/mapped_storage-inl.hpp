@@ -0,0 +1,260 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_STORAGE_MAPPED_STORAGE_INL_HPP_
+#define THUNDER_STORAGE_MAPPED_STORAGE_INL_HPP_
+
+#include "thunder/serializer.hpp"
+#include "thunder/storage/mapped_storage.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace thunder {
+namespace storage {
+
+template < typename D >
+MappedStorage< D >::MappedStorage()
+    : size_(0), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(false) {}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(size_type count)
+    : size_(0), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(false) {
+  resize(count);
+}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(size_type count, const_reference value)
+    : size_(0), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(false) {
+  resize(count, value);
+}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(const MappedStorage &other)
+    : size_(0), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(false) {
+  resize(other.size_);
+  for (size_type i = 0; i < size_; ++i) {
+    data_[i] = other.data_[i];
+  }
+}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(MappedStorage &&other)
+    : size_(other.size_), data_(other.data_), map_base_(other.map_base_),
+      map_length_(other.map_length_), read_only_(other.read_only_) {
+  other.size_ = 0;
+  other.data_ = nullptr;
+  other.map_base_ = nullptr;
+  other.map_length_ = 0;
+  other.read_only_ = false;
+}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(::std::initializer_list< D > init)
+    : size_(0), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(false) {
+  resize(init.size());
+  size_type i = 0;
+  for (const D& value : init) {
+    data_[i++] = value;
+  }
+}
+
+template < typename D >
+MappedStorage< D >::MappedStorage(const ::std::string &file, size_type offset,
+                                  size_type count, Mode mode)
+    : size_(count), data_(nullptr), map_base_(nullptr), map_length_(0),
+      read_only_(mode == READ_ONLY) {
+  if (count > 0) {
+    data_ = static_cast< pointer >(mapFile(
+        file, offset, count * sizeof(D), mode == COPY_ON_WRITE, &map_base_,
+        &map_length_));
+  }
+}
+
+template < typename D >
+MappedStorage< D >::~MappedStorage() {
+  release();
+}
+
+template < typename D >
+MappedStorage< D > &MappedStorage< D >::operator=(MappedStorage other) {
+  ::std::swap(size_, other.size_);
+  ::std::swap(data_, other.data_);
+  ::std::swap(map_base_, other.map_base_);
+  ::std::swap(map_length_, other.map_length_);
+  ::std::swap(read_only_, other.read_only_);
+  return *this;
+}
+
+template < typename D >
+typename MappedStorage< D >::reference MappedStorage< D >::operator[](
+    size_type pos) {
+  return data_[pos];
+}
+
+template < typename D >
+typename MappedStorage< D >::const_reference MappedStorage< D >::operator[](
+    size_type pos) const {
+  return data_[pos];
+}
+
+template < typename D >
+typename MappedStorage< D >::pointer MappedStorage< D >::data() {
+  return data_;
+}
+
+template < typename D >
+typename MappedStorage< D >::const_pointer MappedStorage< D >::data() const {
+  return data_;
+}
+
+template < typename D >
+typename MappedStorage< D >::iterator MappedStorage< D >::begin() {
+  return data_;
+}
+
+template < typename D >
+typename MappedStorage< D >::const_iterator MappedStorage< D >::begin() const {
+  return data_;
+}
+
+template < typename D >
+typename MappedStorage< D >::iterator MappedStorage< D >::end() {
+  return data_ + size_;
+}
+
+template < typename D >
+typename MappedStorage< D >::const_iterator MappedStorage< D >::end() const {
+  return data_ + size_;
+}
+
+template < typename D >
+template < typename S >
+void MappedStorage< D >::copy(const S &other) {
+  if (this != reinterpret_cast< const MappedStorage* >(&other)) {
+    resize(static_cast< size_type >(other.size()));
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i] = static_cast< D >(
+          other[static_cast< typename S::size_type >(i)]);
+    }
+  }
+}
+
+template < typename D >
+void MappedStorage< D >::resize(size_type count) {
+  if (size_ != count) {
+    release();
+    if (count > 0) {
+      data_ = alloc_.allocate(count);
+    }
+    size_ = count;
+  }
+}
+
+template < typename D >
+void MappedStorage< D >::resize(size_type count, const_reference value) {
+  resize(count);
+  for (size_type i = 0; i < size_; ++i) {
+    data_[i] = value;
+  }
+}
+
+template < typename D >
+typename MappedStorage< D >::size_type MappedStorage< D >::size() const {
+  return size_;
+}
+
+template < typename D >
+bool MappedStorage< D >::mapped() const {
+  return map_base_ != nullptr;
+}
+
+template < typename D >
+void MappedStorage< D >::detach() {
+  if (map_base_ != nullptr && read_only_) {
+    pointer data = alloc_.allocate(size_);
+    for (size_type i = 0; i < size_; ++i) {
+      data[i] = data_[i];
+    }
+    size_type size = size_;
+    release();
+    size_ = size;
+    data_ = data;
+  }
+}
+
+template < typename D >
+void MappedStorage< D >::release() {
+  if (map_base_ != nullptr) {
+    unmapFile(map_base_, map_length_);
+  } else if (data_ != nullptr) {
+    alloc_.deallocate(data_, size_);
+  }
+  size_ = 0;
+  data_ = nullptr;
+  map_base_ = nullptr;
+  map_length_ = 0;
+  read_only_ = false;
+}
+
+}  // namespace storage
+}  // namespace thunder
+
+namespace thunder {
+namespace serializer {
+
+// The format is the same as Storage
+template < typename S, typename D >
+void save(S *s, const storage::MappedStorage< D > &t) {
+  typedef storage::MappedStorage< D > T;
+
+  // Save size of storage
+  typename T::size_type size = t.size();
+  s->save(size);
+
+  // Save data of storage
+  s->saveArray(t.data(), size);
+}
+
+template < typename S, typename D >
+void load(S *s, storage::MappedStorage< D > *t) {
+  typedef storage::MappedStorage< D > T;
+
+  // Load size of storage
+  typename T::size_type size;
+  s->load(&size);
+  if (t->mapped()) {
+    *t = T();
+  }
+  t->resize(size);
+
+  // Restore data of storage
+  s->loadArray(t->data(), size);
+}
+
+}  // namespace serializer
+}  // namespace thunder
+
+#endif  // THUNDER_STORAGE_MAPPED_STORAGE_INL_HPP_
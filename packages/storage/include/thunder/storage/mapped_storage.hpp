@@ -0,0 +1,151 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_STORAGE_MAPPED_STORAGE_HPP_
+#define THUNDER_STORAGE_MAPPED_STORAGE_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "thunder/serializer.hpp"
+
+namespace thunder {
+namespace storage {
+
+// Map bytes of file starting at offset into memory. Writable mappings are
+// private copy-on-write pages, and the file is never modified. Returns the
+// mapped data, and sets base and length for unmapFile. Throws runtime_error
+// when the file cannot be mapped.
+void* mapFile(const ::std::string &file, ::std::size_t offset,
+              ::std::size_t bytes, bool writable, void **base,
+              ::std::size_t *length);
+void unmapFile(void *base, ::std::size_t length);
+
+// Storage whose data can be a read-only or copy-on-write mapping of a file,
+// so that large tensors are loaded without copying. Storages created in any
+// other way keep their data on the heap. Resizing a mapped storage to a
+// different size replaces the mapping by heap memory, and so does detach() for
+// read-only mappings, which must not be written otherwise.
+template < typename D >
+class MappedStorage {
+ public:
+  enum Mode { READ_ONLY, COPY_ON_WRITE };
+
+  typedef ::std::allocator< D > allocator_type;
+  typedef D value_type;
+  typedef D& reference;
+  typedef const D& const_reference;
+  typedef ::std::ptrdiff_t difference_type;
+  typedef ::std::size_t size_type;
+  typedef D* pointer;
+  typedef const D* const_pointer;
+
+  // Iterator definitions
+  typedef pointer iterator;
+  typedef const_pointer const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  // Default Constructor
+  MappedStorage();
+  // Constructor with given size
+  explicit MappedStorage(size_type count);
+  // Constructor with given size and a default value
+  MappedStorage(size_type count, const_reference value);
+  // Copy constructor. The copy is always on the heap.
+  MappedStorage(const MappedStorage &other);
+  // Move constructor
+  MappedStorage(MappedStorage &&other);
+  // Constructor from initializer_list
+  MappedStorage(::std::initializer_list< D > init);
+  // Map count elements starting at byte offset of file
+  MappedStorage(const ::std::string &file, size_type offset, size_type count,
+                Mode mode = READ_ONLY);
+
+  // Destructor
+  ~MappedStorage();
+
+  // Assignment operator (using copy and swap idiom)
+  MappedStorage &operator=(MappedStorage other);
+
+  // Get reference at pos without bound checking
+  reference operator[](size_type pos);
+  // Get const reference at pos without bound checking
+  const_reference operator[](size_type pos) const;
+
+  // Get raw pointer to data
+  pointer data();
+  // Get const raw pointer to data
+  const_pointer data() const;
+
+  // Get iterator to data
+  iterator begin();
+  // Get const iterator to data
+  const_iterator begin() const;
+  // Get iterater pass the last element
+  iterator end();
+  // Get const iterator passing the last element
+  const_iterator end() const;
+
+  // Copy from a different storage using static casts
+  template< typename S >
+  void copy(const S &other);
+
+  // Resize. Data content will be lost.
+  void resize(size_type count);
+  // Resize with all elements using target value
+  void resize(size_type count, const_reference value);
+
+  // Check the size of the storage
+  size_type size() const;
+  // Check whether data is mapped from a file
+  bool mapped() const;
+  // Copy a read-only mapping to the heap so that data can be written
+  void detach();
+
+ private:
+  void release();
+
+  allocator_type alloc_;
+  size_type size_;
+  pointer data_;
+  void *map_base_;
+  size_type map_length_;
+  bool read_only_;
+};
+
+}  // namespace storage
+}  // namespace thunder
+
+namespace thunder {
+namespace serializer {
+
+template < typename S, typename D >
+void save(S *s, const ::thunder::storage::MappedStorage< D > &t);
+
+template < typename S, typename D >
+void load(S *s, ::thunder::storage::MappedStorage< D > *t);
+
+}  // namespace serializer
+}  // namespace thunder
+
+#endif  // THUNDER_STORAGE_MAPPED_STORAGE_HPP_
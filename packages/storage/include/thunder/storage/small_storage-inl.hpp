@@ -0,0 +1,254 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_STORAGE_SMALL_STORAGE_INL_HPP_
+#define THUNDER_STORAGE_SMALL_STORAGE_INL_HPP_
+
+#include "thunder/serializer.hpp"
+#include "thunder/storage/small_storage.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace thunder {
+namespace storage {
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage() : size_(0), data_(buffer_) {}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage(size_type count)
+    : size_(0), data_(buffer_) {
+  allocate(count);
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage(size_type count, const_reference value)
+    : size_(0), data_(buffer_) {
+  allocate(count);
+  for (size_type i = 0; i < size_; ++i) {
+    data_[i] = value;
+  }
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage(const SmallStorage &other)
+    : size_(0), data_(buffer_) {
+  allocate(other.size_);
+  for (size_type i = 0; i < size_; ++i) {
+    data_[i] = other.data_[i];
+  }
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage(SmallStorage &&other)
+    : size_(0), data_(buffer_) {
+  *this = ::std::move(other);
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::SmallStorage(::std::initializer_list< D > init)
+    : size_(0), data_(buffer_) {
+  allocate(init.size());
+  size_type i = 0;
+  for (const D& value : init) {
+    data_[i++] = value;
+  }
+}
+
+template < typename D, ::std::size_t N >
+template < typename A >
+SmallStorage< D, N >::SmallStorage(const Storage< D, A > &other)
+    : size_(0), data_(buffer_) {
+  allocate(other.size());
+  ::std::copy(other.data(), other.data() + other.size(), data_);
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N >::~SmallStorage() {
+  deallocate();
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N > &SmallStorage< D, N >::operator=(
+    const SmallStorage &other) {
+  if (this != &other) {
+    resize(other.size_);
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i] = other.data_[i];
+    }
+  }
+  return *this;
+}
+
+template < typename D, ::std::size_t N >
+SmallStorage< D, N > &SmallStorage< D, N >::operator=(SmallStorage &&other) {
+  if (this != &other) {
+    if (other.data_ != other.buffer_) {
+      // Heap blocks are taken over
+      deallocate();
+      size_ = other.size_;
+      data_ = other.data_;
+      other.size_ = 0;
+      other.data_ = other.buffer_;
+    } else {
+      *this = static_cast< const SmallStorage& >(other);
+    }
+  }
+  return *this;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::reference SmallStorage< D, N >::operator[](
+    size_type pos) {
+  return data_[pos];
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::const_reference
+SmallStorage< D, N >::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::pointer SmallStorage< D, N >::data() {
+  return data_;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::const_pointer
+SmallStorage< D, N >::data() const {
+  return data_;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::iterator SmallStorage< D, N >::begin() {
+  return data_;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::const_iterator
+SmallStorage< D, N >::begin() const {
+  return data_;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::iterator SmallStorage< D, N >::end() {
+  return data_ + size_;
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::const_iterator
+SmallStorage< D, N >::end() const {
+  return data_ + size_;
+}
+
+template < typename D, ::std::size_t N >
+template < typename S >
+void SmallStorage< D, N >::copy(const S &other) {
+  if (static_cast< const void* >(this) != static_cast< const void* >(&other)) {
+    resize(static_cast< size_type >(other.size()));
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i] = static_cast< D >(
+          other[static_cast< typename S::size_type >(i)]);
+    }
+  }
+}
+
+template < typename D, ::std::size_t N >
+void SmallStorage< D, N >::resize(size_type count) {
+  if (size_ != count) {
+    deallocate();
+    allocate(count);
+  }
+}
+
+template < typename D, ::std::size_t N >
+void SmallStorage< D, N >::resize(size_type count, const_reference value) {
+  resize(count);
+  for (size_type i = 0; i < size_; ++i) {
+    data_[i] = value;
+  }
+}
+
+template < typename D, ::std::size_t N >
+typename SmallStorage< D, N >::size_type SmallStorage< D, N >::size() const {
+  return size_;
+}
+
+template < typename D, ::std::size_t N >
+template < typename A >
+SmallStorage< D, N >::operator Storage< D, A >() const {
+  Storage< D, A > other(size_);
+  ::std::copy(data_, data_ + size_, other.data());
+  return other;
+}
+
+template < typename D, ::std::size_t N >
+void SmallStorage< D, N >::allocate(size_type count) {
+  size_ = count;
+  data_ = count > N ? new value_type[count] : buffer_;
+}
+
+template < typename D, ::std::size_t N >
+void SmallStorage< D, N >::deallocate() {
+  if (data_ != buffer_) {
+    delete[] data_;
+  }
+  size_ = 0;
+  data_ = buffer_;
+}
+
+}  // namespace storage
+}  // namespace thunder
+
+namespace thunder {
+namespace serializer {
+
+// The format is the same as Storage
+template < typename S, typename D, ::std::size_t N >
+void save(S *s, const storage::SmallStorage< D, N > &t) {
+  typedef storage::SmallStorage< D, N > T;
+
+  // Save size of storage
+  typename T::size_type size = t.size();
+  s->save(size);
+
+  // Save data of storage
+  s->saveArray(t.data(), size);
+}
+
+template < typename S, typename D, ::std::size_t N >
+void load(S *s, storage::SmallStorage< D, N > *t) {
+  typedef storage::SmallStorage< D, N > T;
+
+  // Load size of storage
+  typename T::size_type size;
+  s->load(&size);
+  t->resize(size);
+
+  // Restore data of storage
+  s->loadArray(t->data(), size);
+}
+
+}  // namespace serializer
+}  // namespace thunder
+
+#endif  // THUNDER_STORAGE_SMALL_STORAGE_INL_HPP_
@@ -59,7 +59,7 @@ Storage< D, A >::Storage(const Storage &other)
 template < typename D, typename A >
 Storage< D, A >::Storage(Storage &&other)
     : alloc_(::std::move(other.alloc_)), size_(::std::move(other.size_)),
-      data_(other.data_) {
+      data_(other.data_), share_(::std::move(other.share_)) {
   other.data_ = nullptr;
 }
 
@@ -75,9 +75,7 @@ Storage< D, A >::Storage(::std::initializer_list< D > init, const A& alloc)
 
 template < typename D, typename A >
 Storage< D, A >::~Storage() {
-  if (data_ != nullptr) {
-    alloc_.deallocate(data_, size_);
-  }
+  deallocate();
 }
 
 template < typename D, typename A >
@@ -85,6 +83,7 @@ Storage< D, A > &Storage< D, A >::operator=(Storage< D, A > other) {
   std::swap(size_, other.size_);
   std::swap(data_, other.data_);
   std::swap(alloc_, other.alloc_);
+  std::swap(share_, other.share_);
   return *this;
 }
 
@@ -143,10 +142,8 @@ void Storage< D, A >::copy(const S &other) {
 
 template < typename D, typename A >
 void Storage< D, A >::resize(size_type count) {
-  if (size_ != count) {
-    if (data_ != nullptr) {
-      alloc_.deallocate(data_, size_);
-    }
+  if (size_ != count || isShared()) {
+    deallocate();
     pointer data = nullptr;
     if (count > 0) {
       data = alloc_.allocate(count);
@@ -169,6 +166,55 @@ typename Storage< D, A >::size_type Storage< D, A >::size() const {
   return size_;
 }
 
+template < typename D, typename A >
+Storage< D, A > Storage< D, A >::share() {
+  // Ownership of data moves to share_ once it is shared
+  if (share_ == nullptr && data_ != nullptr) {
+    share_ = ::std::shared_ptr< value_type >(data_, Release(alloc_, size_));
+  }
+  Storage other(alloc_);
+  other.size_ = size_;
+  other.data_ = data_;
+  other.share_ = share_;
+  return other;
+}
+
+template < typename D, typename A >
+void Storage< D, A >::detach() {
+  if (isShared()) {
+    pointer data = alloc_.allocate(size_);
+    for (size_type i = 0; i < size_; ++i) {
+      data[i] = data_[i];
+    }
+    share_.reset();
+    data_ = data;
+  }
+}
+
+template < typename D, typename A >
+bool Storage< D, A >::isShared() const {
+  return share_.use_count() > 1;
+}
+
+template < typename D, typename A >
+Storage< D, A >::Release::Release(const A &alloc, size_type size)
+    : alloc_(alloc), size_(size) {}
+
+template < typename D, typename A >
+void Storage< D, A >::Release::operator()(pointer p) {
+  alloc_.deallocate(p, size_);
+}
+
+template < typename D, typename A >
+void Storage< D, A >::deallocate() {
+  if (share_ != nullptr) {
+    share_.reset();
+  } else if (data_ != nullptr) {
+    alloc_.deallocate(data_, size_);
+  }
+  data_ = nullptr;
+}
+
 }  // namespace storage
 }  // namespace thunder
 
@@ -184,10 +230,7 @@ void save(S *s, const storage::Storage< D, A > &t) {
   s->save(size);
 
   // Save data of storage
-  typename T::const_pointer data = t.data();
-  for (typename T::size_type i = 0; i < size; ++i) {
-    s->save(data[i]);
-  }
+  s->saveArray(t.data(), size);
 }
 
 template < typename S, typename D, typename A >
@@ -200,10 +243,7 @@ void load(S *s, storage::Storage< D, A > *t) {
   t->resize(size);
 
   // Restore data of storage
-  typename T::pointer data = t->data();
-  for (typename T::size_type i = 0; i < size; ++i) {
-    s->load(&data[i]);
-  }
+  s->loadArray(t->data(), size);
 }
 
 }  // namespace serializer
@@ -98,10 +98,33 @@ class Storage {
   // Check the size of the storage
   size_type size() const;
 
+  // Get a storage sharing data with this one. Resizing or copying into either
+  // of them stops the sharing, but writes through data(), begin() or
+  // operator[] must call detach() first.
+  Storage share();
+  // Copy data if it is shared with other storages
+  void detach();
+  // Check whether data is shared with other storages
+  bool isShared() const;
+
  private:
+  // Deallocator of data shared between storages
+  class Release {
+   public:
+    Release(const A &alloc, size_type size);
+    void operator()(pointer p);
+
+   private:
+    A alloc_;
+    size_type size_;
+  };
+
+  void deallocate();
+
   A alloc_;
   size_type size_;
   pointer data_;
+  ::std::shared_ptr< value_type > share_;
 };
 
 }  // namespace storage
@@ -0,0 +1,254 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/storage/allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace thunder {
+namespace storage {
+
+void* alignedAllocate(::std::size_t bytes, ::std::size_t alignment) {
+  if (alignment < sizeof(void*)) {
+    alignment = sizeof(void*);
+  }
+  if (bytes > ::std::numeric_limits< ::std::size_t >::max() - alignment) {
+    throw ::std::bad_alloc();
+  }
+  void *raw = ::std::malloc(bytes + alignment);
+  if (raw == nullptr) {
+    throw ::std::bad_alloc();
+  }
+  // The original pointer is kept just before the aligned address
+  ::std::uintptr_t address = (reinterpret_cast< ::std::uintptr_t >(raw) +
+                              alignment) & ~(alignment - 1);
+  reinterpret_cast< void** >(address)[-1] = raw;
+  return reinterpret_cast< void* >(address);
+}
+
+void alignedDeallocate(void *p) {
+  if (p != nullptr) {
+    ::std::free(static_cast< void** >(p)[-1]);
+  }
+}
+
+namespace pool {
+
+namespace {
+
+// Classes are 64, 128, 192 and 256 bytes, followed by 4 classes between each
+// pair of powers of 2 up to 2^31 bytes. Larger requests bypass the pool.
+const ::std::size_t kAlignment = 64;
+const int kClasses = 96;
+const ::std::size_t kMaxClassBytes = static_cast< ::std::size_t >(1) << 31;
+
+// Bounds of each thread cache
+const ::std::size_t kThreadBlocks = 16;
+const ::std::size_t kThreadBytes = static_cast< ::std::size_t >(32) << 20;
+
+int classOf(::std::size_t bytes) {
+  if (bytes <= 256) {
+    return bytes == 0 ? 0 : static_cast< int >((bytes - 1) / 64);
+  }
+  // 2^k < bytes <= 2^(k + 1), with quarter steps of 2^(k - 2)
+  int k = 8;
+  while ((static_cast< ::std::size_t >(2) << k) < bytes) {
+    ++k;
+  }
+  ::std::size_t step = static_cast< ::std::size_t >(1) << (k - 2);
+  ::std::size_t quarter =
+      (bytes - (static_cast< ::std::size_t >(1) << k) + step - 1) / step;
+  return 4 + (k - 8) * 4 + static_cast< int >(quarter) - 1;
+}
+
+::std::size_t classBytes(int index) {
+  if (index < 4) {
+    return static_cast< ::std::size_t >(index + 1) * 64;
+  }
+  int k = 8 + (index - 4) / 4;
+  ::std::size_t quarter = (index - 4) % 4 + 1;
+  return (static_cast< ::std::size_t >(1) << k) +
+      quarter * (static_cast< ::std::size_t >(1) << (k - 2));
+}
+
+// Blocks shared by all threads. It is never destroyed, so that storages freed
+// during static destruction can still return their memory.
+struct SharedPool {
+  SharedPool() : bytes(0), limit(static_cast< ::std::size_t >(1) << 30) {}
+
+  ::std::mutex mutex;
+  ::std::vector< void* > blocks[kClasses];
+  ::std::size_t bytes;
+  ::std::size_t limit;
+};
+
+SharedPool& shared() {
+  static SharedPool *pool = new SharedPool();
+  return *pool;
+}
+
+void* sharedAllocate(int index) {
+  SharedPool &pool = shared();
+  {
+    ::std::lock_guard< ::std::mutex > lock(pool.mutex);
+    if (!pool.blocks[index].empty()) {
+      void *p = pool.blocks[index].back();
+      pool.blocks[index].pop_back();
+      pool.bytes -= classBytes(index);
+      return p;
+    }
+  }
+  return alignedAllocate(classBytes(index), kAlignment);
+}
+
+void sharedDeallocate(void *p, int index) {
+  SharedPool &pool = shared();
+  {
+    ::std::lock_guard< ::std::mutex > lock(pool.mutex);
+    if (pool.bytes + classBytes(index) <= pool.limit) {
+      pool.blocks[index].push_back(p);
+      pool.bytes += classBytes(index);
+      return;
+    }
+  }
+  alignedDeallocate(p);
+}
+
+void sharedRelease() {
+  SharedPool &pool = shared();
+  ::std::lock_guard< ::std::mutex > lock(pool.mutex);
+  for (int i = 0; i < kClasses; ++i) {
+    for (void *p : pool.blocks[i]) {
+      alignedDeallocate(p);
+    }
+    pool.blocks[i].clear();
+  }
+  pool.bytes = 0;
+}
+
+// State of the calling thread's cache. Once the cache is destroyed at thread
+// exit, requests go directly to the shared pool.
+enum CacheState { kUninitialized = 0, kAlive, kDestroyed };
+thread_local CacheState cache_state = kUninitialized;
+
+struct ThreadCache {
+  ThreadCache() : bytes(0) {
+    cache_state = kAlive;
+  }
+
+  ~ThreadCache() {
+    flush();
+    cache_state = kDestroyed;
+  }
+
+  void flush() {
+    for (int i = 0; i < kClasses; ++i) {
+      for (void *p : blocks[i]) {
+        sharedDeallocate(p, i);
+      }
+      blocks[i].clear();
+    }
+    bytes = 0;
+  }
+
+  ::std::vector< void* > blocks[kClasses];
+  ::std::size_t bytes;
+};
+
+ThreadCache* threadCache() {
+  if (cache_state == kDestroyed) {
+    return nullptr;
+  }
+  thread_local ThreadCache cache;
+  return &cache;
+}
+
+}  // namespace
+
+void* allocate(::std::size_t bytes) {
+  if (bytes > kMaxClassBytes) {
+    return alignedAllocate(bytes, kAlignment);
+  }
+  int index = classOf(bytes);
+  ThreadCache *cache = threadCache();
+  if (cache != nullptr && !cache->blocks[index].empty()) {
+    void *p = cache->blocks[index].back();
+    cache->blocks[index].pop_back();
+    cache->bytes -= classBytes(index);
+    return p;
+  }
+  return sharedAllocate(index);
+}
+
+void deallocate(void *p, ::std::size_t bytes) {
+  if (p == nullptr) {
+    return;
+  }
+  if (bytes > kMaxClassBytes) {
+    alignedDeallocate(p);
+    return;
+  }
+  int index = classOf(bytes);
+  ThreadCache *cache = threadCache();
+  if (cache != nullptr && cache->blocks[index].size() < kThreadBlocks &&
+      cache->bytes + classBytes(index) <= kThreadBytes) {
+    cache->blocks[index].push_back(p);
+    cache->bytes += classBytes(index);
+    return;
+  }
+  sharedDeallocate(p, index);
+}
+
+void setLimit(::std::size_t bytes) {
+  SharedPool &pool = shared();
+  ::std::lock_guard< ::std::mutex > lock(pool.mutex);
+  pool.limit = bytes;
+  for (int i = kClasses - 1; i >= 0 && pool.bytes > pool.limit; --i) {
+    while (!pool.blocks[i].empty() && pool.bytes > pool.limit) {
+      alignedDeallocate(pool.blocks[i].back());
+      pool.blocks[i].pop_back();
+      pool.bytes -= classBytes(i);
+    }
+  }
+}
+
+::std::size_t getLimit() {
+  SharedPool &pool = shared();
+  ::std::lock_guard< ::std::mutex > lock(pool.mutex);
+  return pool.limit;
+}
+
+void release() {
+  ThreadCache *cache = threadCache();
+  if (cache != nullptr) {
+    cache->flush();
+  }
+  sharedRelease();
+}
+
+}  // namespace pool
+
+}  // namespace storage
+}  // namespace thunder
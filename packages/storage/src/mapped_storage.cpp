@@ -0,0 +1,74 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/storage/mapped_storage.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <string>
+
+#include "thunder/exception.hpp"
+
+namespace thunder {
+namespace storage {
+
+void* mapFile(const ::std::string &file, ::std::size_t offset,
+              ::std::size_t bytes, bool writable, void **base,
+              ::std::size_t *length) {
+  int fd = ::open(file.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw runtime_error("Cannot open file " + file + ".");
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0 ||
+      static_cast< ::std::size_t >(status.st_size) < offset ||
+      static_cast< ::std::size_t >(status.st_size) - offset < bytes) {
+    ::close(fd);
+    throw runtime_error("File " + file + " is too short to be mapped.");
+  }
+
+  // Mappings must start at a page boundary
+  ::std::size_t page = static_cast< ::std::size_t >(::sysconf(_SC_PAGESIZE));
+  ::std::size_t start = offset - offset % page;
+  *length = bytes + offset - start;
+  *base = ::mmap(nullptr, *length,
+                 writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                 writable ? MAP_PRIVATE : MAP_SHARED, fd,
+                 static_cast< ::off_t >(start));
+  ::close(fd);
+  if (*base == MAP_FAILED) {
+    *base = nullptr;
+    *length = 0;
+    throw runtime_error("Cannot map file " + file + ".");
+  }
+  return static_cast< char* >(*base) + (offset - start);
+}
+
+void unmapFile(void *base, ::std::size_t length) {
+  if (base != nullptr) {
+    ::munmap(base, length);
+  }
+}
+
+}  // namespace storage
+}  // namespace thunder
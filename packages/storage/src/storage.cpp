@@ -18,6 +18,9 @@
  */
 
 #include "thunder/storage/storage.hpp"
+#include "thunder/storage/allocator.hpp"
+#include "thunder/storage/mapped_storage.hpp"
+#include "thunder/storage/small_storage.hpp"
 
 #include <complex>
 #include <utility>
@@ -32,6 +35,9 @@
 #include "thunder/serializer/serializer-inl.hpp"
 #include "thunder/serializer/static-inl.hpp"
 #include "thunder/serializer/text_protocol-inl.hpp"
+#include "thunder/storage/allocator-inl.hpp"
+#include "thunder/storage/mapped_storage-inl.hpp"
+#include "thunder/storage/small_storage-inl.hpp"
 #include "thunder/storage/storage-inl.hpp"
 
 namespace thunder {
@@ -44,6 +50,40 @@ template class Storage< ::std::complex< float > >;
 template class Storage< ::std::size_t >;
 template class Storage< ::std::ptrdiff_t >;
 template class Storage< ::std::pair< ::std::size_t, ::std::size_t > >;
+template class SmallStorage< ::std::size_t >;
+template class SmallStorage< ::std::ptrdiff_t >;
+template SmallStorage< ::std::size_t >::SmallStorage(
+    const Storage< ::std::size_t > &other);
+template
+SmallStorage< ::std::size_t >::operator Storage< ::std::size_t >() const;
+template SmallStorage< ::std::ptrdiff_t >::SmallStorage(
+    const Storage< ::std::ptrdiff_t > &other);
+template
+SmallStorage< ::std::ptrdiff_t >::operator Storage< ::std::ptrdiff_t >() const;
+template class MappedStorage< double >;
+template class MappedStorage< float >;
+
+template class AlignedAllocator< double >;
+template class AlignedAllocator< float >;
+template class AlignedAllocator< ::std::complex< double > >;
+template class AlignedAllocator< ::std::complex< float > >;
+template class Storage< double, AlignedAllocator< double > >;
+template class Storage< float, AlignedAllocator< float > >;
+template class Storage< ::std::complex< double >,
+                         AlignedAllocator< ::std::complex< double > > >;
+template class Storage< ::std::complex< float >,
+                         AlignedAllocator< ::std::complex< float > > >;
+
+template class PoolAllocator< double >;
+template class PoolAllocator< float >;
+template class PoolAllocator< ::std::complex< double > >;
+template class PoolAllocator< ::std::complex< float > >;
+template class Storage< double, PoolAllocator< double > >;
+template class Storage< float, PoolAllocator< float > >;
+template class Storage< ::std::complex< double >,
+                         PoolAllocator< ::std::complex< double > > >;
+template class Storage< ::std::complex< float >,
+                         PoolAllocator< ::std::complex< float > > >;
 
 }  // namespace storage
 }  // namespace thunder
@@ -93,6 +133,132 @@ namespace serializer {
   template void FileTextSerializer::load(                       \
       ::thunder::storage::Storage< D > *t);
 
+#define THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE(D, A)   \
+  template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void StringBinarySerializer::load(                   \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void FileBinarySerializer::load(                     \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void StringTextSerializer::save(                     \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void StringTextSerializer::load(                     \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void FileTextSerializer::save(                       \
+      const ::thunder::storage::Storage< D, A< D > > &t);       \
+  template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::Storage< D, A< D > > *t);             \
+  template void FileTextSerializer::load(                       \
+      ::thunder::storage::Storage< D, A< D > > *t);
+
+#define THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(D)          \
+  template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void StringBinarySerializer::load(                   \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void FileBinarySerializer::load(                     \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void StringTextSerializer::save(                     \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void StringTextSerializer::load(                     \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void FileTextSerializer::save(                       \
+      const ::thunder::storage::SmallStorage< D > &t);          \
+  template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::SmallStorage< D > *t);                \
+  template void FileTextSerializer::load(                       \
+      ::thunder::storage::SmallStorage< D > *t);
+
+#define THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(D)         \
+  template void save(                                           \
+      StringBinarySerializer *s,                                \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void StringBinarySerializer::save(                   \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void load(                                           \
+      StringBinarySerializer *s,                                \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void StringBinarySerializer::load(                   \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void save(                                           \
+      FileBinarySerializer *s,                                  \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void FileBinarySerializer::save(                     \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void load(                                           \
+      FileBinarySerializer *s,                                  \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void FileBinarySerializer::load(                     \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void save(                                           \
+      StringTextSerializer *s,                                  \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void StringTextSerializer::save(                     \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void load(                                           \
+      StringTextSerializer *s,                                  \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void StringTextSerializer::load(                     \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void save(                                           \
+      FileTextSerializer *s,                                    \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void FileTextSerializer::save(                       \
+      const ::thunder::storage::MappedStorage< D > &t);         \
+  template void load(                                           \
+      FileTextSerializer *s,                                    \
+      ::thunder::storage::MappedStorage< D > *t);               \
+  template void FileTextSerializer::load(                       \
+      ::thunder::storage::MappedStorage< D > *t);
+
 
 #define THUNDER_STORAGE_EXPAND_SERIALIZE(INSTANTIATE)           \
   INSTANTIATE(double);                                          \
@@ -102,6 +268,12 @@ namespace serializer {
   INSTANTIATE(::std::size_t);                                   \
   INSTANTIATE(::std::ptrdiff_t);
 
+#define THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(INSTANTIATE, A)      \
+  INSTANTIATE(double, A);                                               \
+  INSTANTIATE(float, A);                                                \
+  INSTANTIATE(::std::complex< double >, A);                             \
+  INSTANTIATE(::std::complex< float >, A);
+
 template void save(
     StringBinarySerializer *s,
     const ::thunder::storage::Storage<
@@ -160,9 +332,23 @@ template void FileTextSerializer::load(
     ::std::pair< ::std::size_t, ::std::size_t > > *t);
 
 THUNDER_STORAGE_EXPAND_SERIALIZE(THUNDER_STORAGE_INSTANTIATE_SERIALIZE);
+THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(::std::size_t);
+THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE(::std::ptrdiff_t);
+THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(double);
+THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE(float);
+THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(
+    THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE,
+    ::thunder::storage::AlignedAllocator);
+THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE(
+    THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE,
+    ::thunder::storage::PoolAllocator);
 
 #undef THUNDER_STORAGE_INSTANTIATE_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_SMALL_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_MAPPED_SERIALIZE
 #undef THUNDER_STORAGE_EXPAND_SERIALIZE
+#undef THUNDER_STORAGE_INSTANTIATE_ALLOCATOR_SERIALIZE
+#undef THUNDER_STORAGE_EXPAND_ALLOCATOR_SERIALIZE
 
 }  // namespace serializer
 }  // namespace thunder
@@ -0,0 +1,132 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/storage.hpp"
+#include "thunder/storage/allocator.hpp"
+
+#include <complex>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "thunder/serializer.hpp"
+#include "thunder/serializer/binary_protocol.hpp"
+#include "thunder/serializer/serializer.hpp"
+#include "thunder/serializer/static.hpp"
+#include "thunder/serializer/text_protocol.hpp"
+
+#include "thunder/serializer/binary_protocol-inl.hpp"
+#include "thunder/serializer/serializer-inl.hpp"
+#include "thunder/serializer/static-inl.hpp"
+#include "thunder/serializer/text_protocol-inl.hpp"
+#include "thunder/storage/allocator-inl.hpp"
+#include "thunder/storage/storage-inl.hpp"
+
+#define TEST_ALL_TYPES(FUNC)                             \
+  TEST(AllocatorTest, FUNC) {                            \
+    FUNC< double > ();                                   \
+    FUNC< float > ();                                    \
+    FUNC< ::std::complex< double > > ();                 \
+    FUNC< ::std::complex< float > > ();                  \
+  }
+
+template < typename S >
+void storageTest() {
+  S s1(17);
+  for (int i = 0; i < 17; ++i) {
+    s1[i] = i + 4;
+  }
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(s1.data()) % 64);
+
+  S s2(s1);
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(s2.data()) % 64);
+  s2.resize(1000);
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(s2.data()) % 64);
+  s2 = s1;
+  for (int i = 0; i < 17; ++i) {
+    EXPECT_EQ(s1[i], s2[i]);
+  }
+
+  ::thunder::StringBinarySerializer a1;
+  ::thunder::Storage< typename S::value_type > s3;
+  a1.save(s1);
+  a1.load(&s3);
+  EXPECT_EQ(s1.size(), s3.size());
+  for (int i = 0; i < s1.size(); ++i) {
+    EXPECT_EQ(s1[i], s3[i]);
+  }
+}
+
+template < typename T >
+void alignedStorageTest() {
+  storageTest< ::thunder::AlignedStorage< T > >();
+  storageTest<
+    ::thunder::Storage< T, ::thunder::storage::AlignedAllocator< T, 128 > > >();
+}
+TEST_ALL_TYPES(alignedStorageTest);
+
+template < typename T >
+void poolStorageTest() {
+  storageTest< ::thunder::PoolStorage< T > >();
+}
+TEST_ALL_TYPES(poolStorageTest);
+
+TEST(AllocatorTest, poolReuseTest) {
+  namespace pool = ::thunder::storage::pool;
+  pool::release();
+
+  // Freed blocks are reused by requests of the same size class
+  void *p1 = pool::allocate(1000);
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(p1) % 64);
+  pool::deallocate(p1, 1000);
+  void *p2 = pool::allocate(900);
+  EXPECT_EQ(p1, p2);
+  void *p3 = pool::allocate(1000);
+  EXPECT_NE(p2, p3);
+  pool::deallocate(p2, 900);
+  pool::deallocate(p3, 1000);
+
+  // Blocks freed by other threads are available through the shared pool
+  void *p4 = nullptr;
+  ::std::thread worker([&p4]() {
+      p4 = pool::allocate(5000);
+      pool::deallocate(p4, 5000);
+    });
+  worker.join();
+  void *p5 = pool::allocate(5000);
+  EXPECT_EQ(p4, p5);
+  pool::deallocate(p5, 5000);
+
+  // Blocks beyond the shared limit are returned to the system
+  ::std::size_t limit = pool::getLimit();
+  pool::setLimit(0);
+  EXPECT_EQ(0, pool::getLimit());
+  ::std::vector< void* > blocks;
+  for (int i = 0; i < 100; ++i) {
+    blocks.push_back(pool::allocate(64));
+  }
+  for (void *p : blocks) {
+    pool::deallocate(p, 64);
+  }
+  pool::setLimit(limit);
+  pool::release();
+}
+
+#undef TEST_ALL_TYPES
@@ -0,0 +1,141 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/storage.hpp"
+#include "thunder/storage/mapped_storage.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "thunder/exception.hpp"
+#include "thunder/serializer.hpp"
+#include "thunder/serializer/binary_protocol.hpp"
+#include "thunder/serializer/serializer.hpp"
+#include "thunder/serializer/static.hpp"
+#include "thunder/serializer/text_protocol.hpp"
+
+#include "thunder/serializer/binary_protocol-inl.hpp"
+#include "thunder/serializer/serializer-inl.hpp"
+#include "thunder/serializer/static-inl.hpp"
+#include "thunder/serializer/text_protocol-inl.hpp"
+#include "thunder/storage/mapped_storage-inl.hpp"
+#include "thunder/storage/storage-inl.hpp"
+
+#define TEST_ALL_TYPES(FUNC)                             \
+  TEST(MappedStorageTest, FUNC) {                        \
+    FUNC< double > ();                                   \
+    FUNC< float > ();                                    \
+    FUNC< int > ();                                      \
+  }
+
+template < typename T >
+void constructorTest() {
+  thunder::MappedStorage< T > default_storage;
+  EXPECT_EQ(0, default_storage.size());
+  EXPECT_EQ(nullptr, default_storage.data());
+  EXPECT_FALSE(default_storage.mapped());
+
+  thunder::MappedStorage< T > value_storage(5, 3);
+  EXPECT_EQ(5, value_storage.size());
+  EXPECT_FALSE(value_storage.mapped());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(3, value_storage[i]);
+  }
+
+  thunder::MappedStorage< T > init_storage({3, 4, 5, 6, 7});
+  thunder::MappedStorage< T > copy_storage(init_storage);
+  thunder::MappedStorage< T > move_storage(::std::move(copy_storage));
+  EXPECT_EQ(0, copy_storage.size());
+  EXPECT_EQ(5, move_storage.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(i + 3, move_storage[i]);
+  }
+}
+TEST_ALL_TYPES(constructorTest);
+
+template < typename T >
+void mapTest() {
+  // A file with a 3 byte header followed by 1000 elements
+  ::std::string file = "mapped_storage_test.bin";
+  {
+    ::std::ofstream stream(file, ::std::ios_base::binary);
+    stream.write("abc", 3);
+    for (int i = 0; i < 1000; ++i) {
+      T value = static_cast< T >(i * 2);
+      stream.write(reinterpret_cast< const char* >(&value), sizeof(T));
+    }
+  }
+
+  thunder::MappedStorage< T > s1(file, 3 + 10 * sizeof(T), 990);
+  EXPECT_TRUE(s1.mapped());
+  EXPECT_EQ(990, s1.size());
+  for (int i = 0; i < 990; ++i) {
+    EXPECT_EQ(static_cast< T >((i + 10) * 2), s1[i]);
+  }
+
+  // Copy-on-write changes are private to the storage
+  thunder::MappedStorage< T > s2(file, 3, 1000,
+                                 thunder::MappedStorage< T >::COPY_ON_WRITE);
+  s2[10] = 7;
+  EXPECT_EQ(7, s2[10]);
+  EXPECT_EQ(20, s1[0]);
+  thunder::MappedStorage< T > s3(file, 3, 1000);
+  EXPECT_EQ(20, s3[10]);
+
+  // Detaching copies read-only mappings to the heap
+  s2.detach();
+  EXPECT_TRUE(s2.mapped());
+  thunder::MappedStorage< T > s6(file, 3, 1000);
+  s6.detach();
+  EXPECT_FALSE(s6.mapped());
+  EXPECT_EQ(1000, s6.size());
+  s6[10] = 9;
+  EXPECT_EQ(9, s6[10]);
+  EXPECT_EQ(static_cast< T >(1998), s6[999]);
+  EXPECT_EQ(20, s3[10]);
+
+  // Copies and resizes move data to the heap
+  thunder::MappedStorage< T > s4(s3);
+  EXPECT_FALSE(s4.mapped());
+  EXPECT_EQ(20, s4[10]);
+  s3.resize(10, 1);
+  EXPECT_FALSE(s3.mapped());
+  EXPECT_EQ(1, s3[9]);
+
+  // The format is shared with Storage
+  ::thunder::StringBinarySerializer a1;
+  thunder::Storage< T > s5;
+  a1.save(s1);
+  a1.load(&s5);
+  EXPECT_EQ(s1.size(), s5.size());
+  for (int i = 0; i < s1.size(); ++i) {
+    EXPECT_EQ(s1[i], s5[i]);
+  }
+
+  EXPECT_THROW(thunder::MappedStorage< T >(file, 3, 1001),
+               thunder::runtime_error);
+  EXPECT_THROW(thunder::MappedStorage< T >(file + ".missing", 0, 1),
+               thunder::runtime_error);
+  ::std::remove(file.c_str());
+}
+TEST_ALL_TYPES(mapTest);
+
+#undef TEST_ALL_TYPES
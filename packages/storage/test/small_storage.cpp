@@ -0,0 +1,175 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/storage.hpp"
+#include "thunder/storage/small_storage.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "thunder/serializer.hpp"
+#include "thunder/serializer/binary_protocol.hpp"
+#include "thunder/serializer/serializer.hpp"
+#include "thunder/serializer/static.hpp"
+#include "thunder/serializer/text_protocol.hpp"
+
+#include "thunder/serializer/binary_protocol-inl.hpp"
+#include "thunder/serializer/serializer-inl.hpp"
+#include "thunder/serializer/static-inl.hpp"
+#include "thunder/serializer/text_protocol-inl.hpp"
+#include "thunder/storage/small_storage-inl.hpp"
+#include "thunder/storage/storage-inl.hpp"
+
+#define TEST_ALL_TYPES(FUNC)                             \
+  TEST(SmallStorageTest, FUNC) {                         \
+    FUNC< ::std::size_t > ();                            \
+    FUNC< ::std::ptrdiff_t > ();                         \
+    FUNC< double > ();                                   \
+    FUNC< int > ();                                      \
+  }
+
+template < typename T >
+void constructorTest() {
+  // Small sizes are stored inline
+  thunder::SmallStorage< T, 4 > default_storage;
+  EXPECT_EQ(0, default_storage.size());
+  thunder::SmallStorage< T, 4 > value_storage(3, 7);
+  EXPECT_EQ(3, value_storage.size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(7, value_storage[i]);
+  }
+  thunder::SmallStorage< T, 4 > init_storage({1, 2, 3, 4});
+  EXPECT_EQ(4, init_storage.size());
+  EXPECT_EQ(4, init_storage.end() - init_storage.begin());
+  EXPECT_EQ(&init_storage[0], init_storage.data());
+
+  // Larger sizes go to the heap
+  thunder::SmallStorage< T, 4 > large_storage({1, 2, 3, 4, 5, 6});
+  EXPECT_EQ(6, large_storage.size());
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(i + 1, large_storage[i]);
+  }
+
+  // Copies and moves work for both
+  thunder::SmallStorage< T, 4 > copy_storage(init_storage);
+  thunder::SmallStorage< T, 4 > move_storage(::std::move(copy_storage));
+  EXPECT_EQ(4, move_storage.size());
+  EXPECT_NE(init_storage.data(), move_storage.data());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(i + 1, move_storage[i]);
+  }
+  const T *large_data = large_storage.data();
+  thunder::SmallStorage< T, 4 > move_large_storage(::std::move(large_storage));
+  EXPECT_EQ(large_data, move_large_storage.data());
+  EXPECT_EQ(0, large_storage.size());
+
+  // Swapping mixes inline and heap storages
+  ::std::swap(move_storage, move_large_storage);
+  EXPECT_EQ(6, move_storage.size());
+  EXPECT_EQ(4, move_large_storage.size());
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(i + 1, move_storage[i]);
+  }
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(i + 1, move_large_storage[i]);
+  }
+}
+TEST_ALL_TYPES(constructorTest);
+
+template < typename T >
+void resizeTest() {
+  thunder::SmallStorage< T, 4 > s1;
+  s1.resize(9, 3);
+  EXPECT_EQ(9, s1.size());
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(3, s1[i]);
+  }
+  s1.resize(2, 5);
+  EXPECT_EQ(2, s1.size());
+  EXPECT_EQ(5, s1[0]);
+  EXPECT_EQ(5, s1[1]);
+
+  thunder::Storage< double > s2({1.0, 2.0, 3.0, 4.0, 5.0});
+  s1.copy(s2);
+  EXPECT_EQ(5, s1.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(static_cast< T >(i + 1), s1[i]);
+  }
+}
+TEST_ALL_TYPES(resizeTest);
+
+template < typename T >
+void conversionTest() {
+  // Conversions work both inline and on the heap
+  thunder::Storage< T > s1({1, 2, 3});
+  thunder::SmallStorage< T, 4 > s2 = s1;
+  EXPECT_EQ(3, s2.size());
+  thunder::Storage< T > s3({1, 2, 3, 4, 5, 6});
+  thunder::SmallStorage< T, 4 > s4 = s3;
+  EXPECT_EQ(6, s4.size());
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(static_cast< T >(i + 1), s4[i]);
+  }
+
+  thunder::Storage< T > s5 = s2;
+  EXPECT_EQ(3, s5.size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(static_cast< T >(i + 1), s5[i]);
+  }
+  s5 = s4;
+  EXPECT_EQ(6, s5.size());
+  EXPECT_EQ(static_cast< T >(6), s5[5]);
+}
+TEST_ALL_TYPES(conversionTest);
+
+template < typename T >
+void serializeTest() {
+  thunder::SmallStorage< T > s1({4, 5, 6});
+  thunder::SmallStorage< T > s2({4, 5, 6, 7, 8, 9, 10, 11, 12, 13});
+
+  // The format is shared with Storage
+  ::thunder::StringBinarySerializer a1;
+  thunder::Storage< T > s3;
+  thunder::SmallStorage< T > s4;
+  a1.save(s1);
+  a1.save(s2);
+  a1.load(&s3);
+  a1.load(&s4);
+  EXPECT_EQ(s1.size(), s3.size());
+  for (int i = 0; i < s1.size(); ++i) {
+    EXPECT_EQ(s1[i], s3[i]);
+  }
+  EXPECT_EQ(s2.size(), s4.size());
+  for (int i = 0; i < s2.size(); ++i) {
+    EXPECT_EQ(s2[i], s4[i]);
+  }
+
+  ::thunder::StringTextSerializer a2;
+  thunder::SmallStorage< T > s5;
+  a2.save(s2);
+  a2.load(&s5);
+  EXPECT_EQ(s2.size(), s5.size());
+  for (int i = 0; i < s2.size(); ++i) {
+    EXPECT_EQ(s2[i], s5[i]);
+  }
+}
+TEST_ALL_TYPES(serializeTest);
+
+#undef TEST_ALL_TYPES
@@ -191,6 +191,47 @@ void resizeTest() {
 }
 TEST_ALL_TYPES(resizeTest);
 
+template < typename T >
+void shareTest() {
+  thunder::Storage< T > s1(7);
+  for (int i = 0; i < 7; ++i) {
+    s1[i] = static_cast< T >(i + 1);
+  }
+  EXPECT_FALSE(s1.isShared());
+
+  // Shared data is copied by the storage that is detached
+  thunder::Storage< T > s2 = s1.share();
+  thunder::Storage< T > s3 = s1.share();
+  EXPECT_TRUE(s1.isShared());
+  EXPECT_EQ(s1.data(), s2.data());
+  EXPECT_EQ(s1.data(), s3.data());
+  s2.detach();
+  EXPECT_FALSE(s2.isShared());
+  EXPECT_NE(s1.data(), s2.data());
+  s2[0] = static_cast< T >(10);
+  EXPECT_EQ(static_cast< T >(1), s1[0]);
+  EXPECT_EQ(static_cast< T >(1), s3[0]);
+
+  // Resizing or copying stops the sharing as well
+  s3.resize(7, static_cast< T >(5));
+  EXPECT_FALSE(s1.isShared());
+  EXPECT_NE(s1.data(), s3.data());
+  EXPECT_EQ(static_cast< T >(1), s1[0]);
+  thunder::Storage< T > s4 = s1.share();
+  s4.copy(s3);
+  EXPECT_EQ(static_cast< T >(5), s4[6]);
+  EXPECT_EQ(static_cast< T >(7), s1[6]);
+
+  // Data outlives the storage it was shared from
+  thunder::Storage< T > *s5 = new thunder::Storage< T >(s1);
+  thunder::Storage< T > s6 = s5->share();
+  delete s5;
+  EXPECT_FALSE(s6.isShared());
+  s6.detach();
+  EXPECT_EQ(static_cast< T >(7), s6[6]);
+}
+TEST_ALL_TYPES(shareTest);
+
 template < typename T >
 void serializeTest() {
   // Create a storage of some size
@@ -26,7 +26,15 @@
 
 #include "thunder/storage.hpp"
 #include "thunder/serializer.hpp"
+#include "thunder/tensor/expression.hpp"
+#include "thunder/tensor/expression-inl.hpp"
+#include "thunder/tensor/fusion.hpp"
+#include "thunder/tensor/fusion-inl.hpp"
 #include "thunder/tensor/index_iterator.hpp"
+#include "thunder/tensor/mapped.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/tensor-inl-apply.hpp"
 
 namespace thunder {
 
@@ -44,6 +52,17 @@ DoubleComplexTensor;
 typedef ComplexTensor< float, ::std::allocator< ::std::complex< float > > >
 FloatComplexTensor;
 
+typedef Tensor< AlignedDoubleStorage > AlignedDoubleTensor;
+typedef Tensor< AlignedFloatStorage > AlignedFloatTensor;
+typedef Tensor< AlignedDoubleComplexStorage > AlignedDoubleComplexTensor;
+typedef Tensor< AlignedFloatComplexStorage > AlignedFloatComplexTensor;
+typedef Tensor< PoolDoubleStorage > PoolDoubleTensor;
+typedef Tensor< PoolFloatStorage > PoolFloatTensor;
+typedef Tensor< PoolDoubleComplexStorage > PoolDoubleComplexTensor;
+typedef Tensor< PoolFloatComplexStorage > PoolFloatComplexTensor;
+typedef Tensor< MappedDoubleStorage > MappedDoubleTensor;
+typedef Tensor< MappedFloatStorage > MappedFloatTensor;
+
 }  // namespace thunder
 
 
@@ -52,6 +71,7 @@ namespace tensor {
 
 // Index iterator instantiation
 extern template class IndexIterator< SizeStorage >;
+extern template class IndexIterator< SmallStorage< ::std::size_t > >;
 
 // Tensor instantiation
 extern template class Tensor< DoubleStorage >;
@@ -59,12 +79,25 @@ extern template class Tensor< FloatStorage >;
 extern template class Tensor< DoubleComplexStorage >;
 extern template class Tensor< FloatComplexStorage >;
 extern template class Tensor< SizeStorage >;
+extern template class Tensor< AlignedDoubleStorage >;
+extern template class Tensor< AlignedFloatStorage >;
+extern template class Tensor< AlignedDoubleComplexStorage >;
+extern template class Tensor< AlignedFloatComplexStorage >;
+extern template class Tensor< PoolDoubleStorage >;
+extern template class Tensor< PoolFloatStorage >;
+extern template class Tensor< PoolDoubleComplexStorage >;
+extern template class Tensor< PoolFloatComplexStorage >;
+extern template class Tensor< MappedDoubleStorage >;
+extern template class Tensor< MappedFloatStorage >;
+
+extern template Tensor< MappedDoubleStorage > loadMapped(
+    const ::std::string &file, ::std::size_t position,
+    MappedDoubleStorage::Mode mode);
+extern template Tensor< MappedFloatStorage > loadMapped(
+    const ::std::string &file, ::std::size_t position,
+    MappedFloatStorage::Mode mode);
 
 #define THUNDER_TENSOR_INSTANTIATE_UNARY(S)                             \
-  extern template Tensor< S > operator+(                                \
-      typename Tensor< S >::const_reference value, const Tensor< S > &x); \
-  extern template Tensor< S > operator-(                                \
-      typename Tensor< S >::const_reference value, const Tensor< S > &x); \
   extern template Tensor< S > operator==(                                \
       typename Tensor< S >::const_reference value, const Tensor< S > &x); \
   extern template Tensor< S > operator!=(                               \
@@ -83,7 +116,17 @@ extern template class Tensor< SizeStorage >;
   INSTANTIATE(FloatStorage);                            \
   INSTANTIATE(DoubleComplexStorage);                    \
   INSTANTIATE(FloatComplexStorage);                     \
-  INSTANTIATE(SizeStorage);
+  INSTANTIATE(SizeStorage);                             \
+  INSTANTIATE(AlignedDoubleStorage);                    \
+  INSTANTIATE(AlignedFloatStorage);                     \
+  INSTANTIATE(AlignedDoubleComplexStorage);             \
+  INSTANTIATE(AlignedFloatComplexStorage);              \
+  INSTANTIATE(PoolDoubleStorage);                       \
+  INSTANTIATE(PoolFloatStorage);                        \
+  INSTANTIATE(PoolDoubleComplexStorage);                \
+  INSTANTIATE(PoolFloatComplexStorage);                 \
+  INSTANTIATE(MappedDoubleStorage);                     \
+  INSTANTIATE(MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
 
@@ -95,14 +138,15 @@ THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
   extern template Tensor< S1 > Tensor< S1 >::viewAs(                    \
       const Tensor< S2 > &y, typename Tensor< S1 >::size_type os) const; \
   extern template Tensor< S1 > Tensor< S1 >::viewAs(                    \
-      const Tensor< S2 > &y, typename Tensor< S1 >::stride_storage st,  \
+      const Tensor< S2 > &y,                                            \
+      typename Tensor< S1 >::small_stride_storage st,                   \
       typename Tensor< S1 >::size_type os) const;                       \
   extern template Tensor< S1 > Tensor< S1 >::viewAs(                    \
       const Tensor< S1 > &x, const Tensor< S2 > &y,                     \
       typename Tensor< S1 >::size_type os);                             \
   extern template Tensor< S1 > Tensor< S1 >::viewAs(                    \
       const Tensor< S1 > &x, const Tensor< S2 > &y,                     \
-      typename Tensor< S1 >::stride_storage st,                         \
+      typename Tensor< S1 >::small_stride_storage st,                   \
       typename Tensor< S1 >::size_type os);                             \
   extern template const Tensor< S1 >& Tensor< S1 >::polar(              \
       typename Tensor< S2 >::const_reference r,                         \
@@ -163,7 +207,17 @@ THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
   INSTANTIATE(SizeStorage, DoubleStorage);                              \
   INSTANTIATE(SizeStorage, FloatStorage);                               \
   INSTANTIATE(SizeStorage, DoubleComplexStorage);                       \
-  INSTANTIATE(SizeStorage, FloatComplexStorage);
+  INSTANTIATE(SizeStorage, FloatComplexStorage);                        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleStorage);       \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatStorage);         \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleComplexStorage);             \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleStorage);             \
+  INSTANTIATE(PoolFloatStorage, PoolFloatComplexStorage);               \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatStorage);               \
+  INSTANTIATE(MappedDoubleStorage, MappedFloatStorage);                 \
+  INSTANTIATE(MappedFloatStorage, MappedDoubleStorage);
 
 THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
     THUNDER_TENSOR_INSTANTIATE_BINARY_INCOMPATIBLE);
@@ -171,6 +225,38 @@ THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
 #undef THUNDER_TENSOR_INSTANTIATE_BINARY_INCOMPATIBLE
 #undef THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE
 
+// Conversions between different storages of the same value type
+#define THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION(S1, S2)            \
+  extern template Tensor< S1 >::Tensor(const Tensor< S2 > &y);
+
+#define THUNDER_TENSOR_EXPAND_BINARY_CONVERSION(INSTANTIATE)            \
+  INSTANTIATE(AlignedDoubleStorage, DoubleStorage);                     \
+  INSTANTIATE(DoubleStorage, AlignedDoubleStorage);                     \
+  INSTANTIATE(AlignedFloatStorage, FloatStorage);                       \
+  INSTANTIATE(FloatStorage, AlignedFloatStorage);                       \
+  INSTANTIATE(AlignedDoubleComplexStorage, DoubleComplexStorage);       \
+  INSTANTIATE(DoubleComplexStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedFloatComplexStorage, FloatComplexStorage);         \
+  INSTANTIATE(FloatComplexStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(PoolDoubleStorage, DoubleStorage);                        \
+  INSTANTIATE(DoubleStorage, PoolDoubleStorage);                        \
+  INSTANTIATE(PoolFloatStorage, FloatStorage);                          \
+  INSTANTIATE(FloatStorage, PoolFloatStorage);                          \
+  INSTANTIATE(PoolDoubleComplexStorage, DoubleComplexStorage);          \
+  INSTANTIATE(DoubleComplexStorage, PoolDoubleComplexStorage);          \
+  INSTANTIATE(PoolFloatComplexStorage, FloatComplexStorage);            \
+  INSTANTIATE(FloatComplexStorage, PoolFloatComplexStorage);            \
+  INSTANTIATE(MappedDoubleStorage, DoubleStorage);                      \
+  INSTANTIATE(DoubleStorage, MappedDoubleStorage);                      \
+  INSTANTIATE(MappedFloatStorage, FloatStorage);                        \
+  INSTANTIATE(FloatStorage, MappedFloatStorage);
+
+THUNDER_TENSOR_EXPAND_BINARY_CONVERSION(
+    THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION);
+
+#undef THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION
+#undef THUNDER_TENSOR_EXPAND_BINARY_CONVERSION
+
 #define THUNDER_TENSOR_INSTANTIATE_BINARY_COMPATIBLE(S1, S2)            \
   extern template bool Tensor< S1 >::isSameSizeAs(                      \
       const Tensor< S2 > &y) const;                                     \
@@ -234,7 +320,47 @@ THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
   INSTANTIATE(SizeStorage, DoubleStorage);                              \
   INSTANTIATE(SizeStorage, FloatStorage);                               \
   INSTANTIATE(SizeStorage, DoubleComplexStorage);                       \
-  INSTANTIATE(SizeStorage, FloatComplexStorage);
+  INSTANTIATE(SizeStorage, FloatComplexStorage);                        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleStorage);              \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatStorage);                \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleComplexStorage);\
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatComplexStorage);  \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleStorage);                    \
+  INSTANTIATE(PoolFloatStorage, PoolFloatStorage);                      \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleComplexStorage);      \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatComplexStorage);        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleStorage);       \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatStorage);         \
+  INSTANTIATE(AlignedDoubleStorage, DoubleStorage);                     \
+  INSTANTIATE(DoubleStorage, AlignedDoubleStorage);                     \
+  INSTANTIATE(AlignedFloatStorage, FloatStorage);                       \
+  INSTANTIATE(FloatStorage, AlignedFloatStorage);                       \
+  INSTANTIATE(AlignedDoubleComplexStorage, DoubleComplexStorage);       \
+  INSTANTIATE(DoubleComplexStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedFloatComplexStorage, FloatComplexStorage);         \
+  INSTANTIATE(FloatComplexStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleComplexStorage);             \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleStorage);             \
+  INSTANTIATE(PoolFloatStorage, PoolFloatComplexStorage);               \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatStorage);               \
+  INSTANTIATE(PoolDoubleStorage, DoubleStorage);                        \
+  INSTANTIATE(DoubleStorage, PoolDoubleStorage);                        \
+  INSTANTIATE(PoolFloatStorage, FloatStorage);                          \
+  INSTANTIATE(FloatStorage, PoolFloatStorage);                          \
+  INSTANTIATE(PoolDoubleComplexStorage, DoubleComplexStorage);          \
+  INSTANTIATE(DoubleComplexStorage, PoolDoubleComplexStorage);          \
+  INSTANTIATE(PoolFloatComplexStorage, FloatComplexStorage);            \
+  INSTANTIATE(FloatComplexStorage, PoolFloatComplexStorage);            \
+  INSTANTIATE(MappedDoubleStorage, MappedDoubleStorage);                \
+  INSTANTIATE(MappedFloatStorage, MappedFloatStorage);                  \
+  INSTANTIATE(MappedDoubleStorage, MappedFloatStorage);                 \
+  INSTANTIATE(MappedFloatStorage, MappedDoubleStorage);                 \
+  INSTANTIATE(MappedDoubleStorage, DoubleStorage);                      \
+  INSTANTIATE(DoubleStorage, MappedDoubleStorage);                      \
+  INSTANTIATE(MappedFloatStorage, FloatStorage);                        \
+  INSTANTIATE(FloatStorage, MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_BINARY_COMPATIBLE(
     THUNDER_TENSOR_INSTANTIATE_BINARY_COMPATIBLE);
@@ -295,7 +421,17 @@ namespace serializer {
   INSTANTIATE(FloatStorage);                            \
   INSTANTIATE(DoubleComplexStorage);                    \
   INSTANTIATE(FloatComplexStorage);                     \
-  INSTANTIATE(SizeStorage);
+  INSTANTIATE(SizeStorage);                             \
+  INSTANTIATE(AlignedDoubleStorage);                    \
+  INSTANTIATE(AlignedFloatStorage);                     \
+  INSTANTIATE(AlignedDoubleComplexStorage);             \
+  INSTANTIATE(AlignedFloatComplexStorage);              \
+  INSTANTIATE(PoolDoubleStorage);                       \
+  INSTANTIATE(PoolFloatStorage);                        \
+  INSTANTIATE(PoolDoubleComplexStorage);                \
+  INSTANTIATE(PoolFloatComplexStorage);                 \
+  INSTANTIATE(MappedDoubleStorage);                     \
+  INSTANTIATE(MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_SERIALIZE(THUNDER_TENSOR_INSTANTIATE_SERIALIZE);
 
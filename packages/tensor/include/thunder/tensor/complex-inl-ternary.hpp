@@ -23,16 +23,74 @@
 #include "thunder/tensor/complex.hpp"
 #include "thunder/tensor/complex-inl.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <type_traits>
 
 #include "thunder/tensor/math.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 #include "thunder/tensor/tensor.hpp"
 
 namespace thunder {
 namespace tensor {
 namespace math {
 
+// Rotation exp(z * i) for a scalar angle, computed in double and rounded once
+// so that float results match correctly rounded complex< float > values
+template < typename D >
+::std::complex< D > rotation(const ::std::complex< D > &z) {
+  return static_cast< ::std::complex< D > >(::std::exp(
+      static_cast< ::std::complex< double > >(z) *
+      ::std::complex< double >(0, 1)));
+}
+
+// Rotation exp(z * i) for dense tensors of angles computed in double, in
+// chunks with the vectorized exp, sin and cos, and scaled by radius(i).
+// Rotations that are not finite are left to ::std::exp. Float computations
+// keep the scalar loops so that they round as complex< float > arithmetic.
+template < typename V, typename T, typename Radius, typename Angle >
+bool polarDense(const T &x, bool dense, Radius radius, Angle angle) {
+  if (!dense || !simd::isDense(x) ||
+      !::std::is_same< V, ::std::complex< double > >::value) {
+    return false;
+  }
+  typename T::pointer x_pointer = x.data();
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      const ::std::size_t chunk = 256;
+      double c[chunk], s[chunk], e[chunk];
+      for (; begin < end; begin += chunk) {
+        ::std::size_t n = ::std::min(chunk, end - begin);
+        bool real = true;
+        for (::std::size_t i = 0; i < n; ++i) {
+          ::std::complex< double > z = angle(begin + i);
+          c[i] = s[i] = ::std::real(z);
+          e[i] = -::std::imag(z);
+          real = real && e[i] == 0;
+        }
+        simd::unary(simd::COS, c, n);
+        simd::unary(simd::SIN, s, n);
+        if (real) {
+          ::std::fill(e, e + n, 1.0);
+        } else {
+          simd::unary(simd::EXP, e, n);
+        }
+        for (::std::size_t i = 0; i < n; ++i) {
+          ::std::complex< double > r(e[i] * c[i], e[i] * s[i]);
+          if (!::std::isfinite(r.real()) || !::std::isfinite(r.imag())) {
+            r = ::std::exp(angle(begin + i) * ::std::complex< double >(0, 1));
+          }
+          x_pointer[begin + i] = static_cast< typename T::value_type >(
+              radius(begin + i) * static_cast< V >(r));
+        }
+      }
+    });
+  return true;
+}
+
 template < typename D, typename A, typename T2 >
 const Tensor< Storage< ::std::complex< D >, A > >& polar(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
@@ -83,6 +141,15 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
   if (x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T2::pointer z_data = z.data();
+  if (polarDense< ::std::complex< D > >(
+          x, simd::isDense(z),
+          [&](::std::size_t) { return static_cast< D >(y); },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
     typename T1::pointer x_pointer = x.data();
@@ -117,6 +184,16 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
   if (x.length() != y.length() || x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T2::pointer y_data = y.data();
+  typename T2::pointer z_data = z.data();
+  if (polarDense< ::std::complex< D > >(
+          x, simd::isDense(y) && simd::isDense(z),
+          [&](::std::size_t i) { return static_cast< D >(y_data[i]); },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
@@ -152,7 +229,9 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
     typename Tensor< Storage< ::std::complex< D >, A > >::const_reference y,
     typename Tensor< Storage< ::std::complex< D >, A > >::const_reference z) {
   typedef Tensor< Storage< ::std::complex< D >, A > > T;
-  x.fill(y * ::std::exp(z * (typename T::value_type(0, 1))));
+  x.fill(static_cast< typename T::value_type >(
+      static_cast< ::std::complex< double > >(y) *
+      static_cast< ::std::complex< double > >(rotation(z))));
   return x;
 }
 
@@ -162,10 +241,19 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
     const Tensor< Storage< ::std::complex< D >, A > > &y,
     typename Tensor< Storage< ::std::complex< D >, A > >::const_reference z) {
   typedef Tensor< Storage< ::std::complex< D >, A > > T;
-  typename T::value_type z_exp = ::std::exp(z * (typename T::value_type(0, 1)));
+  typename T::value_type z_exp = rotation(z);
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  // Dense tensors are rotated by the complex multiplication kernels
+  if (simd::ComplexVectorizable< typename T::value_type >::value &&
+      simd::isDense(x) && simd::isDense(y)) {
+    if (x.data() != y.data()) {
+      ::std::copy(y.data(), y.data() + y.length(), x.data());
+    }
+    simd::binary(simd::MUL, x, z_exp);
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
@@ -196,6 +284,15 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
   if (x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T::pointer z_data = z.data();
+  if (polarDense< typename T::value_type >(
+          x, simd::isDense(z),
+          [&](::std::size_t) { return y; },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
@@ -229,6 +326,16 @@ const Tensor< Storage< ::std::complex< D >, A > >& polar(
   if (x.length() != y.length() || x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T::pointer y_data = y.data();
+  typename T::pointer z_data = z.data();
+  if (polarDense< typename T::value_type >(
+          x, simd::isDense(y) && simd::isDense(z),
+          [&](::std::size_t i) { return y_data[i]; },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
@@ -263,8 +370,9 @@ const Tensor< Storage< ::std::complex< D1 >, A1 > >& polar(
     typename Tensor< Storage< ::std::complex< D2 >, A2 > >::const_reference z) {
   typedef Tensor< Storage< ::std::complex< D1 >, A1 > > T1;
   typedef Tensor< Storage< ::std::complex< D2 >, A2 > > T2;
-  typename T2::value_type result =
-      y * ::std::exp(z * (typename T2::value_type(0, 1)));
+  typename T2::value_type result = static_cast< typename T2::value_type >(
+      static_cast< ::std::complex< double > >(y) *
+      static_cast< ::std::complex< double > >(rotation(z)));
   x.fill(typename T1::value_type(::std::real(result), ::std::imag(result)));
   return x;
 }
@@ -276,8 +384,7 @@ const Tensor< Storage< ::std::complex< D1 >, A1 > >& polar(
     typename Tensor< Storage< ::std::complex< D2 >, A2 > >::const_reference z) {
   typedef Tensor< Storage< ::std::complex< D1 >, A1 > > T1;
   typedef Tensor< Storage< ::std::complex< D2 >, A2 > > T2;
-  typename T2::value_type z_exp
-      = ::std::exp(z * (typename T2::value_type(0, 1)));
+  typename T2::value_type z_exp = rotation(z);
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
@@ -317,6 +424,15 @@ const Tensor< Storage< ::std::complex< D1 >, A1 > >& polar(
   if (x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T2::pointer z_data = z.data();
+  if (polarDense< typename T2::value_type >(
+          x, simd::isDense(z),
+          [&](::std::size_t) { return y; },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   typename T2::value_type result;
   if (x.partialContiguity(0, x.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
@@ -355,6 +471,16 @@ const Tensor< Storage< ::std::complex< D1 >, A1 > >& polar(
   if (x.length() != y.length() || x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  typename T2::pointer y_data = y.data();
+  typename T2::pointer z_data = z.data();
+  if (polarDense< typename T2::value_type >(
+          x, simd::isDense(y) && simd::isDense(z),
+          [&](::std::size_t i) { return y_data[i]; },
+          [&](::std::size_t i) {
+            return ::std::complex< double >(z_data[i]);
+          })) {
+    return x;
+  }
   typename T2::value_type result;
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1) &&
@@ -393,6 +519,9 @@ const Tensor< Storage< ::std::complex< D >, A > >& fma(
     typename Tensor< Storage< ::std::complex< D >, A > >::const_reference y,
     typename Tensor< Storage< ::std::complex< D >, A > >::const_reference z) {
   typedef Tensor< Storage< ::std::complex< D >, A > > T;
+  if (simd::fma(x, y, z)) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
     typename T::difference_type x_step = x.stride(x.dimension() - 1);
@@ -419,6 +548,9 @@ const Tensor< Storage< ::std::complex< D >, A > >& fma(
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  if (simd::fma(x, y, z)) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
@@ -450,6 +582,9 @@ const Tensor< Storage< ::std::complex< D >, A > >& fma(
   if (x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  if (simd::fma(x, y, z)) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
@@ -481,6 +616,9 @@ const Tensor< Storage< ::std::complex< D >, A > >& fma(
   if (x.length() != y.length() || x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
+  if (simd::fma(x, y, z)) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1) &&
       y.partialContiguity(0, y.dimension() - 1) &&
       z.partialContiguity(0, z.dimension() - 1)) {
@@ -46,7 +46,7 @@ T1 extract(const T1 &x, const Tensor< Storage< ::std::complex< D >, A > > &y) {
       throw out_of_range("Size does not match.");
     }
   }
-  typename T1::size_storage sz(x.dimension() - y_dimension + 1);
+  typename T1::small_size_storage sz(x.dimension() - y_dimension + 1);
   for (typename T1::dim_type i = y_dimension; i < x.dimension(); ++i) {
     sz[i - y_dimension + 1] = x.size(i);
   }
@@ -88,16 +88,15 @@ T1 extract(const T1 &x, const Tensor< Storage< ::std::complex< D >, A > > &y) {
       }
     }
   } else {
-    typename T1::size_storage y_size(y.dimension());
+    typename T1::small_size_storage y_size(y.dimension());
     for (typename T1::dim_type i = 0; i < y_size.size(); ++i) {
       y_size[i] = y.size(i);
     }
     typename T1::size_type pos = 0;
-    IndexIterator< typename T1::size_storage > t_begin =
-        IndexIterator< typename T1::size_storage>::begin(y_size);
-    for (IndexIterator< typename T2::size_storage > begin =
-             IndexIterator< typename T2::size_storage >::begin(y.size()),
-             end = IndexIterator< typename T2::size_storage >::end(y.size());
+    IndexIterator< typename T1::small_size_storage > t_begin =
+        IndexIterator< typename T1::small_size_storage>::begin(y_size);
+    typedef IndexIterator< typename T2::small_size_storage > Y;
+    for (Y begin = Y::begin(y.size()), end = Y::end(y.size());
          begin != end; ++begin, ++t_begin) {
       if (static_cast< bool >(::std::real(y[*begin]())) == true) {
         t[pos++].copy(x[*t_begin]);
@@ -116,7 +115,7 @@ T1 shuffle(const T1 &x, const Tensor< Storage< ::std::complex< D >, A > > &y) {
   }
   if (y.dimension() == 1) {
     T1 t;
-    typename T1::size_storage ind(x.dimension());
+    typename T1::small_size_storage ind(x.dimension());
     for (typename T2::dim_type i = 0; i < y.size(0); ++i) {
       ind[i] = static_cast< typename T1::size_type >(::std::real(y(i)));
       if (ind[i] >= x.size(i)) {
@@ -126,15 +125,15 @@ T1 shuffle(const T1 &x, const Tensor< Storage< ::std::complex< D >, A > > &y) {
     t() = x(ind);
     return t;
   }
-  typename T1::size_storage sz(y.dimension() - 1);
+  typename T1::small_size_storage sz(y.dimension() - 1);
   for (typename T1::dim_type i = 0; i < sz.size(); ++i) {
     sz[i] = y.size(i);
   }
   T1 t(sz);
-  typename T1::size_storage ind(x.dimension());
-  for (IndexIterator< typename T1::size_storage > begin =
-           IndexIterator< typename T1::size_storage >::begin(sz),
-           end = IndexIterator< typename T1::size_storage >::end(sz);
+  typename T1::small_size_storage ind(x.dimension());
+  for (IndexIterator< typename T1::small_size_storage > begin =
+           IndexIterator< typename T1::small_size_storage >::begin(sz),
+           end = IndexIterator< typename T1::small_size_storage >::end(sz);
        begin != end; ++begin) {
     for (typename T1::dim_type i = 0; i < ind.size(); ++i) {
       ind[i] = static_cast< typename T1::size_type >(::std::real(y[*begin](i)));
@@ -28,6 +28,8 @@
 #include <limits>
 
 #include "thunder/tensor/math.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -120,6 +122,9 @@ template < typename D, typename A >
 const Tensor< Storage< ::std::complex< D >, A > >& conj(
     const Tensor< Storage < ::std::complex< D >, A > > &x) {
   typedef Tensor< Storage< ::std::complex< D >, A > > T;
+  if (simd::conj(x)) {
+    return x;
+  }
   if (x.partialContiguity(0, x.dimension() - 1)) {
     typename T::pointer x_pointer = x.data();
     typename T::difference_type x_step = x.stride(x.dimension() - 1);
@@ -354,21 +354,18 @@ template < typename D, typename A >
 typename Tensor< Storage< ::std::complex< D >, A > >::value_type max(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
     Tensor< typename Tensor< Storage< ::std::complex< D >, A > >
-    ::size_storage> *pos);
+    ::size_storage > *pos);
 template < typename D, typename A >
 typename Tensor< Storage< ::std::complex< D >, A > >::value_type min(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
     Tensor< typename Tensor< Storage< ::std::complex< D >, A > >
-    ::size_storage> *pos);
+    ::size_storage > *pos);
 template < typename D, typename A >
 typename Tensor< Storage< ::std::complex< D >, A > >::value_type max(
     const Tensor< Storage< ::std::complex< D >, A > > &x);
 template < typename D, typename A >
 typename Tensor< Storage< ::std::complex< D >, A > >::value_type min(
     const Tensor< Storage< ::std::complex< D >, A > > &x);
-template < typename D, typename A >
-typename Tensor< Storage< ::std::complex< D >, A > >::value_type var(
-    const Tensor< Storage< ::std::complex< D >, A > > &x);
 
 // Reduction functions along a dimension
 template < typename D, typename A >
@@ -376,13 +373,13 @@ Tensor< Storage< ::std::complex< D >, A > > max(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
     typename Tensor< Storage< ::std::complex< D >, A > >::dim_type d,
     Tensor< typename Tensor< Storage< ::std::complex< D >, A > >
-    ::size_storage> *pos);
+    ::size_storage > *pos);
 template < typename D, typename A >
 Tensor< Storage< ::std::complex< D >, A > > min(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
     typename Tensor< Storage< ::std::complex< D >, A > >::dim_type d,
     Tensor< typename Tensor< Storage< ::std::complex< D >, A > >
-    ::size_storage> *pos);
+    ::size_storage > *pos);
 template < typename D, typename A >
 Tensor< Storage< ::std::complex< D >, A > > max(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
@@ -391,10 +388,6 @@ template < typename D, typename A >
 Tensor< Storage< ::std::complex< D >, A > > min(
     const Tensor< Storage< ::std::complex< D >, A > > &x,
     typename Tensor< Storage< ::std::complex< D >, A > >::dim_type d);
-template < typename D, typename A >
-Tensor< Storage< ::std::complex< D >, A > > var(
-    const Tensor< Storage< ::std::complex< D >, A > > &x,
-    typename Tensor< Storage< ::std::complex< D >, A > >::dim_type d);
 
 }  // namespace math
 }  // namespace tensor
@@ -0,0 +1,372 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_EXPRESSION_INL_HPP_
+#define THUNDER_TENSOR_EXPRESSION_INL_HPP_
+
+#include "thunder/tensor/expression.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include "thunder/exception.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/strided.hpp"
+#include "thunder/tensor/strided-inl.hpp"
+#include "thunder/tensor/tensor.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace expression {
+
+template < typename D >
+D Add::apply(const D &a, const D &b) {
+  return a + b;
+}
+
+template < typename D >
+D Sub::apply(const D &a, const D &b) {
+  return a - b;
+}
+
+template < typename D >
+D Mul::apply(const D &a, const D &b) {
+  return a * b;
+}
+
+template < typename D >
+D Div::apply(const D &a, const D &b) {
+  return a / b;
+}
+
+template < typename T >
+Leaf< T >::cursor::cursor(const Leaf &x, size_type index)
+    : cursor_(x.x_, index), data_(cursor_.data()), step_(cursor_.step()) {}
+
+template < typename T >
+typename Leaf< T >::value_type Leaf< T >::cursor::get(size_type i) const {
+  return data_[i * step_];
+}
+
+template < typename T >
+typename Leaf< T >::value_type Leaf< T >::cursor::unit(size_type i) const {
+  return data_[i];
+}
+
+template < typename T >
+bool Leaf< T >::cursor::contiguous() const {
+  return step_ == 1;
+}
+
+template < typename T >
+typename Leaf< T >::size_type Leaf< T >::cursor::run() const {
+  return cursor_.run();
+}
+
+template < typename T >
+void Leaf< T >::cursor::advance(size_type n) {
+  cursor_.advance(n);
+  data_ = cursor_.data();
+  step_ = cursor_.step();
+}
+
+template < typename T >
+Leaf< T >::Leaf(const T &x) : x_(x) {}
+
+template < typename T >
+const T* Leaf< T >::shape() const {
+  return &x_;
+}
+
+template < typename T >
+void Leaf< T >::check(size_type length) const {
+  if (x_.length() != length) {
+    throw out_of_range("Tensors have different length.");
+  }
+}
+
+template < typename T >
+bool Leaf< T >::overlaps(const T &x) const {
+  if (x_.storage() != x.storage()) {
+    return false;
+  }
+  if (x_.data() != x.data() || x_.dimension() != x.dimension()) {
+    return true;
+  }
+  for (typename T::dim_type i = 0; i < x.dimension(); ++i) {
+    if (x_.size(i) != x.size(i) || x_.stride(i) != x.stride(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template < typename T >
+Scalar< T >::cursor::cursor(const Scalar &x, size_type)
+    : value_(x.value_) {}
+
+template < typename T >
+typename Scalar< T >::value_type Scalar< T >::cursor::get(size_type) const {
+  return value_;
+}
+
+template < typename T >
+typename Scalar< T >::value_type Scalar< T >::cursor::unit(size_type) const {
+  return value_;
+}
+
+template < typename T >
+bool Scalar< T >::cursor::contiguous() const {
+  return true;
+}
+
+template < typename T >
+typename Scalar< T >::size_type Scalar< T >::cursor::run() const {
+  return ::std::numeric_limits< size_type >::max();
+}
+
+template < typename T >
+void Scalar< T >::cursor::advance(size_type) {}
+
+template < typename T >
+Scalar< T >::Scalar(const value_type &value) : value_(value) {}
+
+template < typename T >
+const T* Scalar< T >::shape() const {
+  return nullptr;
+}
+
+template < typename T >
+void Scalar< T >::check(size_type) const {}
+
+template < typename T >
+bool Scalar< T >::overlaps(const T &) const {
+  return false;
+}
+
+template < typename O, typename L, typename R >
+Expression< O, L, R >::cursor::cursor(const Expression &x, size_type index)
+    : left_(x.left_, index), right_(x.right_, index) {}
+
+template < typename O, typename L, typename R >
+typename Expression< O, L, R >::value_type
+Expression< O, L, R >::cursor::get(size_type i) const {
+  return O::apply(left_.get(i), right_.get(i));
+}
+
+template < typename O, typename L, typename R >
+typename Expression< O, L, R >::value_type
+Expression< O, L, R >::cursor::unit(size_type i) const {
+  return O::apply(left_.unit(i), right_.unit(i));
+}
+
+template < typename O, typename L, typename R >
+bool Expression< O, L, R >::cursor::contiguous() const {
+  return left_.contiguous() && right_.contiguous();
+}
+
+template < typename O, typename L, typename R >
+typename Expression< O, L, R >::size_type
+Expression< O, L, R >::cursor::run() const {
+  return ::std::min(left_.run(), right_.run());
+}
+
+template < typename O, typename L, typename R >
+void Expression< O, L, R >::cursor::advance(size_type n) {
+  left_.advance(n);
+  right_.advance(n);
+}
+
+template < typename O, typename L, typename R >
+Expression< O, L, R >::Expression(const L &left, const R &right)
+    : left_(left), right_(right) {}
+
+template < typename O, typename L, typename R >
+typename Expression< O, L, R >::tensor_type
+Expression< O, L, R >::eval() const {
+  return tensor_type(*this);
+}
+
+template < typename O, typename L, typename R >
+const typename Expression< O, L, R >::tensor_type*
+Expression< O, L, R >::shape() const {
+  return left_.shape() != nullptr ? left_.shape() : right_.shape();
+}
+
+template < typename O, typename L, typename R >
+void Expression< O, L, R >::check(size_type length) const {
+  left_.check(length);
+  right_.check(length);
+}
+
+template < typename O, typename L, typename R >
+bool Expression< O, L, R >::overlaps(const tensor_type &x) const {
+  return left_.overlaps(x) || right_.overlaps(x);
+}
+
+// Runs on which every operand has unit stride are plain array loops
+template < typename T, typename O, typename L, typename R >
+const T& evaluate(const T &x, const Expression< O, L, R > &e) {
+  typedef Expression< O, L, R > E;
+  e.check(x.length());
+  if (e.overlaps(x)) {
+    return x.copy(T(e));
+  }
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      StridedCursor< T > x_cursor(x, begin);
+      typename E::cursor e_cursor(e, begin);
+      while (begin < end) {
+        ::std::size_t n = ::std::min< ::std::size_t >(
+            end - begin, ::std::min< ::std::size_t >(
+                x_cursor.run(), e_cursor.run()));
+        typename T::pointer x_pointer = x_cursor.data();
+        typename T::difference_type x_step = x_cursor.step();
+        if (x_step == 1 && e_cursor.contiguous()) {
+          for (::std::size_t i = 0; i < n; ++i) {
+            x_pointer[i] = static_cast< typename T::value_type >(
+                e_cursor.unit(i));
+          }
+        } else {
+          for (::std::size_t i = 0; i < n; ++i) {
+            x_pointer[i * x_step] = static_cast< typename T::value_type >(
+                e_cursor.get(i));
+          }
+        }
+        x_cursor.advance(n);
+        e_cursor.advance(n);
+        begin += n;
+      }
+    });
+  return x;
+}
+
+}  // namespace expression
+
+template < typename X, typename Y >
+typename expression::Result< expression::Add, X, Y >::type operator+(
+    const X &x, const Y &y) {
+  return typename expression::Result< expression::Add, X, Y >::type(x, y);
+}
+
+template < typename X, typename Y >
+typename expression::Result< expression::Sub, X, Y >::type operator-(
+    const X &x, const Y &y) {
+  return typename expression::Result< expression::Sub, X, Y >::type(x, y);
+}
+
+template < typename X, typename Y >
+typename expression::Result< expression::Mul, X, Y >::type operator*(
+    const X &x, const Y &y) {
+  return typename expression::Result< expression::Mul, X, Y >::type(x, y);
+}
+
+template < typename X, typename Y >
+typename expression::Result< expression::Div, X, Y >::type operator/(
+    const X &x, const Y &y) {
+  return typename expression::Result< expression::Div, X, Y >::type(x, y);
+}
+
+#define THUNDER_TENSOR_EXPRESSION_SCALAR(OPERATOR, OPERATION)           \
+  template < typename X >                                               \
+  expression::Expression<                                               \
+    expression::OPERATION, typename expression::Operand< X >::type,     \
+    expression::Scalar< typename expression::Operand< X >::tensor_type > > \
+  operator OPERATOR(                                                    \
+      const X &x, const typename expression::Operand< X >::value_type &y) { \
+    return expression::Expression<                                      \
+      expression::OPERATION, typename expression::Operand< X >::type,   \
+      expression::Scalar< typename expression::Operand< X >::tensor_type > \
+      >(x, y);                                                          \
+  }                                                                     \
+  template < typename Y >                                               \
+  expression::Expression<                                               \
+    expression::OPERATION,                                              \
+    expression::Scalar< typename expression::Operand< Y >::tensor_type >, \
+    typename expression::Operand< Y >::type >                           \
+  operator OPERATOR(                                                    \
+      const typename expression::Operand< Y >::value_type &x, const Y &y) { \
+    return expression::Expression<                                      \
+      expression::OPERATION,                                            \
+      expression::Scalar< typename expression::Operand< Y >::tensor_type >, \
+      typename expression::Operand< Y >::type >(x, y);                  \
+  }
+
+THUNDER_TENSOR_EXPRESSION_SCALAR(+, Add);
+THUNDER_TENSOR_EXPRESSION_SCALAR(-, Sub);
+THUNDER_TENSOR_EXPRESSION_SCALAR(*, Mul);
+THUNDER_TENSOR_EXPRESSION_SCALAR(/, Div);
+
+#undef THUNDER_TENSOR_EXPRESSION_SCALAR
+
+template < typename S >
+template < typename O, typename L, typename R >
+Tensor< S >::Tensor(const expression::Expression< O, L, R > &e)
+    : Tensor(e.shape()->size()) {
+  expression::evaluate(*this, e);
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+const Tensor< S >& Tensor< S >::copy(
+    const expression::Expression< O, L, R > &e) const {
+  detach();
+  return expression::evaluate(*this, e);
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+Tensor< S >& Tensor< S >::copy(const expression::Expression< O, L, R > &e) {
+  detach();
+  return const_cast< Tensor& >(expression::evaluate(*this, e));
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+const Tensor< S >& Tensor< S >::operator+=(
+    const expression::Expression< O, L, R > &e) const {
+  return copy(*this + e);
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+const Tensor< S >& Tensor< S >::operator-=(
+    const expression::Expression< O, L, R > &e) const {
+  return copy(*this - e);
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+Tensor< S >& Tensor< S >::operator+=(
+    const expression::Expression< O, L, R > &e) {
+  return copy(*this + e);
+}
+
+template < typename S >
+template < typename O, typename L, typename R >
+Tensor< S >& Tensor< S >::operator-=(
+    const expression::Expression< O, L, R > &e) {
+  return copy(*this - e);
+}
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_EXPRESSION_INL_HPP_
@@ -0,0 +1,238 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_EXPRESSION_HPP_
+#define THUNDER_TENSOR_EXPRESSION_HPP_
+
+#include <type_traits>
+
+#include "thunder/tensor/strided.hpp"
+
+namespace thunder {
+namespace tensor {
+
+template < typename S >
+class Tensor;
+
+namespace expression {
+
+// Element-wise operations of expression nodes
+struct Add {
+  template < typename D >
+  static D apply(const D &a, const D &b);
+};
+struct Sub {
+  template < typename D >
+  static D apply(const D &a, const D &b);
+};
+struct Mul {
+  template < typename D >
+  static D apply(const D &a, const D &b);
+};
+struct Div {
+  template < typename D >
+  static D apply(const D &a, const D &b);
+};
+
+// Operands are held by value, so that expressions built from temporaries
+// stay valid. Copies of tensors share their storage. Each operand provides a
+// cursor, which walks its elements in strided runs from a linear index.
+template < typename T >
+class Leaf {
+ public:
+  typedef T tensor_type;
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+
+  class cursor {
+   public:
+    cursor(const Leaf &x, size_type index);
+    value_type get(size_type i) const;
+    value_type unit(size_type i) const;
+    bool contiguous() const;
+    size_type run() const;
+    void advance(size_type n);
+
+   private:
+    StridedCursor< T > cursor_;
+    typename T::pointer data_;
+    typename T::difference_type step_;
+  };
+
+  Leaf(const T &x);
+
+  // Tensor that gives the shape of the result, or nullptr for scalars
+  const T* shape() const;
+  void check(size_type length) const;
+
+  // Whether writing to x may change elements read later, which is the case
+  // when x shares the storage in any other view than the operand's own
+  bool overlaps(const T &x) const;
+
+ private:
+  T x_;
+};
+
+template < typename T >
+class Scalar {
+ public:
+  typedef T tensor_type;
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+
+  class cursor {
+   public:
+    cursor(const Scalar &x, size_type index);
+    value_type get(size_type i) const;
+    value_type unit(size_type i) const;
+    bool contiguous() const;
+    size_type run() const;
+    void advance(size_type n);
+
+   private:
+    value_type value_;
+  };
+
+  Scalar(const value_type &value);
+
+  const T* shape() const;
+  void check(size_type length) const;
+  bool overlaps(const T &x) const;
+
+ private:
+  value_type value_;
+};
+
+// Lazy element-wise operation O on operands L and R. Nothing is computed
+// until the expression is converted or copied to a tensor, or eval() is
+// called, which evaluates the whole tree in a single pass without
+// intermediate storage. Expressions have no tensor methods, so (a + b).sum()
+// is written (a + b).eval().sum(). Since operands share the storage of their
+// tensors, an expression kept with auto reads their values at evaluation:
+// after auto e = a + 1 and a.fill(10), T(e) is 11 everywhere. Keep
+// (a + 1).eval() instead to compute the result immediately.
+template < typename O, typename L, typename R >
+class Expression {
+ public:
+  typedef typename L::tensor_type tensor_type;
+  typedef typename L::value_type value_type;
+  typedef typename L::size_type size_type;
+
+  class cursor {
+   public:
+    cursor(const Expression &x, size_type index);
+    value_type get(size_type i) const;
+    value_type unit(size_type i) const;
+    bool contiguous() const;
+    size_type run() const;
+    void advance(size_type n);
+
+   private:
+    typename L::cursor left_;
+    typename R::cursor right_;
+  };
+
+  Expression(const L &left, const R &right);
+
+  // Evaluate into a new contiguous tensor
+  tensor_type eval() const;
+
+  const tensor_type* shape() const;
+  void check(size_type length) const;
+  bool overlaps(const tensor_type &x) const;
+
+ private:
+  L left_;
+  R right_;
+};
+
+// Operand types of tensors and expressions
+template < typename X >
+struct Operand {};
+template < typename S >
+struct Operand< Tensor< S > > {
+  typedef Leaf< Tensor< S > > type;
+  typedef Tensor< S > tensor_type;
+  typedef typename Tensor< S >::value_type value_type;
+};
+template < typename O, typename L, typename R >
+struct Operand< Expression< O, L, R > > {
+  typedef Expression< O, L, R > type;
+  typedef typename Expression< O, L, R >::tensor_type tensor_type;
+  typedef typename Expression< O, L, R >::value_type value_type;
+};
+
+// Expression types of operations between operands of the same tensor type
+template < typename O, typename X, typename Y, typename = void >
+struct Result {};
+template < typename O, typename X, typename Y >
+struct Result< O, X, Y, typename ::std::enable_if< ::std::is_same<
+  typename Operand< X >::tensor_type,
+  typename Operand< Y >::tensor_type >::value >::type > {
+  typedef Expression<
+    O, typename Operand< X >::type, typename Operand< Y >::type > type;
+};
+
+// Evaluate e into x, which has the same length. Expressions reading x in
+// another view than its own go through a temporary.
+template < typename T, typename O, typename L, typename R >
+const T& evaluate(const T &x, const Expression< O, L, R > &e);
+
+}  // namespace expression
+
+// Arithmetic operators between tensors, expressions and values
+template < typename X, typename Y >
+typename expression::Result< expression::Add, X, Y >::type operator+(
+    const X &x, const Y &y);
+template < typename X, typename Y >
+typename expression::Result< expression::Sub, X, Y >::type operator-(
+    const X &x, const Y &y);
+template < typename X, typename Y >
+typename expression::Result< expression::Mul, X, Y >::type operator*(
+    const X &x, const Y &y);
+template < typename X, typename Y >
+typename expression::Result< expression::Div, X, Y >::type operator/(
+    const X &x, const Y &y);
+
+#define THUNDER_TENSOR_EXPRESSION_SCALAR(OPERATOR, OPERATION)           \
+  template < typename X >                                               \
+  expression::Expression<                                               \
+    expression::OPERATION, typename expression::Operand< X >::type,     \
+    expression::Scalar< typename expression::Operand< X >::tensor_type > > \
+  operator OPERATOR(                                                    \
+      const X &x, const typename expression::Operand< X >::value_type &y); \
+  template < typename Y >                                               \
+  expression::Expression<                                               \
+    expression::OPERATION,                                              \
+    expression::Scalar< typename expression::Operand< Y >::tensor_type >, \
+    typename expression::Operand< Y >::type >                           \
+  operator OPERATOR(                                                    \
+      const typename expression::Operand< Y >::value_type &x, const Y &y);
+
+THUNDER_TENSOR_EXPRESSION_SCALAR(+, Add);
+THUNDER_TENSOR_EXPRESSION_SCALAR(-, Sub);
+THUNDER_TENSOR_EXPRESSION_SCALAR(*, Mul);
+THUNDER_TENSOR_EXPRESSION_SCALAR(/, Div);
+
+#undef THUNDER_TENSOR_EXPRESSION_SCALAR
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_EXPRESSION_HPP_
@@ -0,0 +1,206 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_FUSION_INL_HPP_
+#define THUNDER_TENSOR_FUSION_INL_HPP_
+
+#include "thunder/tensor/fusion.hpp"
+
+#include <cmath>
+#include <complex>
+
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace fusion {
+
+template < typename D >
+D Identity::operator()(const D &v) const {
+  return v;
+}
+
+template < typename F, typename G >
+Chain< F, G >::Chain(const F &f, const G &g) : first(f), second(g) {}
+
+template < typename F, typename G >
+template < typename D >
+D Chain< F, G >::operator()(const D &v) const {
+  return second(first(v));
+}
+
+#define THUNDER_TENSOR_FUSION_DEFINE_BINARY(name, expression)   \
+  template < typename D >                                       \
+  name< D >::name(const D &value) : y(value) {}                 \
+  template < typename D >                                       \
+  D name< D >::operator()(const D &v) const {                   \
+    return static_cast< D >(expression);                        \
+  }
+
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Add, v + y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Sub, v - y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Mul, v * y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Div, v / y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Fmod, ::std::fmod(v, y));
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Remainder, ::std::remainder(v, y));
+// Selections replace calls of fmax and fmin, which are not inlined. A NaN
+// element gives y, and a NaN value y gives the element.
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Fmax, v > y || y != y ? v : y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Fmin, v < y || y != y ? v : y);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Fdim, ::std::fdim(v, y));
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Pow, ::std::pow(v, y));
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Hypot, ::std::hypot(v, y));
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Atan2, ::std::atan2(v, y));
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(Copysign, ::std::copysign(v, y));
+
+#undef THUNDER_TENSOR_FUSION_DEFINE_BINARY
+
+#define THUNDER_TENSOR_FUSION_DEFINE_UNARY(name, func)  \
+  template < typename D >                               \
+  D name::operator()(const D &v) const {                \
+    return static_cast< D >(::std::func(v));            \
+  }
+
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Abs, abs);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Fabs, fabs);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Exp, exp);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Exp2, exp2);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Expm1, expm1);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Log, log);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Log10, log10);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Log2, log2);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Log1p, log1p);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Sqrt, sqrt);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Cbrt, cbrt);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Sin, sin);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Cos, cos);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Tan, tan);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Asin, asin);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Acos, acos);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Atan, atan);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Sinh, sinh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Cosh, cosh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Tanh, tanh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Asinh, asinh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Acosh, acosh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Atanh, atanh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Erf, erf);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Erfc, erfc);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Ceil, ceil);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Floor, floor);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Trunc, trunc);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(Round, round);
+
+#undef THUNDER_TENSOR_FUSION_DEFINE_UNARY
+
+template < typename T, typename F >
+Pipeline< T, F >::Pipeline(const T &x, const F &f) : x_(x), f_(f) {}
+
+#define THUNDER_TENSOR_FUSION_DEFINE_BINARY(func, name)                 \
+  template < typename T, typename F >                                   \
+  Pipeline< T, Chain< F, name< typename T::value_type > > >             \
+  Pipeline< T, F >::func(const_reference y) const {                     \
+    return Pipeline< T, Chain< F, name< value_type > > >(               \
+        x_, Chain< F, name< value_type > >(f_, name< value_type >(y))); \
+  }
+
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(add, Add);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(sub, Sub);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(mul, Mul);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(div, Div);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(fmod, Fmod);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(remainder, Remainder);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(fmax, Fmax);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(fmin, Fmin);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(fdim, Fdim);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(pow, Pow);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(hypot, Hypot);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(atan2, Atan2);
+THUNDER_TENSOR_FUSION_DEFINE_BINARY(copysign, Copysign);
+
+#undef THUNDER_TENSOR_FUSION_DEFINE_BINARY
+
+#define THUNDER_TENSOR_FUSION_DEFINE_UNARY(func, name)                  \
+  template < typename T, typename F >                                   \
+  Pipeline< T, Chain< F, name > > Pipeline< T, F >::func() const {      \
+    return Pipeline< T, Chain< F, name > >(                             \
+        x_, Chain< F, name >(f_, name()));                              \
+  }
+
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(abs, Abs);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(fabs, Fabs);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(exp, Exp);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(exp2, Exp2);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(expm1, Expm1);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(log, Log);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(log10, Log10);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(log2, Log2);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(log1p, Log1p);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(sqrt, Sqrt);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(cbrt, Cbrt);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(sin, Sin);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(cos, Cos);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(tan, Tan);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(asin, Asin);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(acos, Acos);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(atan, Atan);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(sinh, Sinh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(cosh, Cosh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(tanh, Tanh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(asinh, Asinh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(acosh, Acosh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(atanh, Atanh);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(erf, Erf);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(erfc, Erfc);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(ceil, Ceil);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(floor, Floor);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(trunc, Trunc);
+THUNDER_TENSOR_FUSION_DEFINE_UNARY(round, Round);
+
+#undef THUNDER_TENSOR_FUSION_DEFINE_UNARY
+
+template < typename T, typename F >
+template < typename G >
+Pipeline< T, Chain< F, G > > Pipeline< T, F >::apply(const G &g) const {
+  return Pipeline< T, Chain< F, G > >(x_, Chain< F, G >(f_, g));
+}
+
+// The composed stage is inlined into the strided runs of forEach
+template < typename T, typename F >
+T Pipeline< T, F >::run() const {
+  const F &f = f_;
+  x_.detach();
+  parallel::forEach(x_, [&f](typename T::reference x_ref) {
+      x_ref = static_cast< typename T::value_type >(f(x_ref));
+    });
+  return x_;
+}
+
+}  // namespace fusion
+
+template < typename T >
+fusion::Pipeline< T > fuse(const T &x) {
+  return fusion::Pipeline< T >(x);
+}
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_FUSION_INL_HPP_
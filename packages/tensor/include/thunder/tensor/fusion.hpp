@@ -0,0 +1,192 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_FUSION_HPP_
+#define THUNDER_TENSOR_FUSION_HPP_
+
+namespace thunder {
+namespace tensor {
+namespace fusion {
+
+// Stages are element functors. Chain< F, G > applies G after F.
+struct Identity {
+  template < typename D >
+  D operator()(const D &v) const;
+};
+
+template < typename F, typename G >
+struct Chain {
+  Chain(const F &f, const G &g);
+  template < typename D >
+  D operator()(const D &v) const;
+  F first;
+  G second;
+};
+
+// Stages with a value, where v is the element and y the value
+#define THUNDER_TENSOR_FUSION_DECLARE_BINARY(name)      \
+  template < typename D >                               \
+  struct name {                                         \
+    explicit name(const D &value);                      \
+    D operator()(const D &v) const;                     \
+    D y;                                                \
+  };
+
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Add);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Sub);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Mul);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Div);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Fmod);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Remainder);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Fmax);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Fmin);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Fdim);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Pow);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Hypot);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Atan2);
+THUNDER_TENSOR_FUSION_DECLARE_BINARY(Copysign);
+
+#undef THUNDER_TENSOR_FUSION_DECLARE_BINARY
+
+// Stages of standard library functions
+#define THUNDER_TENSOR_FUSION_DECLARE_UNARY(name)       \
+  struct name {                                         \
+    template < typename D >                             \
+    D operator()(const D &v) const;                     \
+  };
+
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Abs);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Fabs);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Exp);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Exp2);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Expm1);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Log);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Log10);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Log2);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Log1p);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Sqrt);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Cbrt);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Sin);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Cos);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Tan);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Asin);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Acos);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Atan);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Sinh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Cosh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Tanh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Asinh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Acosh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Atanh);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Erf);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Erfc);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Ceil);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Floor);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Trunc);
+THUNDER_TENSOR_FUSION_DECLARE_UNARY(Round);
+
+#undef THUNDER_TENSOR_FUSION_DECLARE_UNARY
+
+// A chain of in-place element-wise operations on x, which are composed into
+// the stage F and applied in a single traversal by run(). The operations
+// have the same meaning as the tensor methods of the same names.
+template < typename T, typename F = Identity >
+class Pipeline {
+ public:
+  typedef T tensor_type;
+  typedef F stage_type;
+  typedef typename T::value_type value_type;
+  typedef typename T::const_reference const_reference;
+
+  explicit Pipeline(const T &x, const F &f = F());
+
+  Pipeline< T, Chain< F, Add< value_type > > > add(const_reference y) const;
+  Pipeline< T, Chain< F, Sub< value_type > > > sub(const_reference y) const;
+  Pipeline< T, Chain< F, Mul< value_type > > > mul(const_reference y) const;
+  Pipeline< T, Chain< F, Div< value_type > > > div(const_reference y) const;
+  Pipeline< T, Chain< F, Fmod< value_type > > > fmod(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Remainder< value_type > > > remainder(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Fmax< value_type > > > fmax(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Fmin< value_type > > > fmin(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Fdim< value_type > > > fdim(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Pow< value_type > > > pow(const_reference y) const;
+  Pipeline< T, Chain< F, Hypot< value_type > > > hypot(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Atan2< value_type > > > atan2(
+      const_reference y) const;
+  Pipeline< T, Chain< F, Copysign< value_type > > > copysign(
+      const_reference y) const;
+
+  Pipeline< T, Chain< F, Abs > > abs() const;
+  Pipeline< T, Chain< F, Fabs > > fabs() const;
+  Pipeline< T, Chain< F, Exp > > exp() const;
+  Pipeline< T, Chain< F, Exp2 > > exp2() const;
+  Pipeline< T, Chain< F, Expm1 > > expm1() const;
+  Pipeline< T, Chain< F, Log > > log() const;
+  Pipeline< T, Chain< F, Log10 > > log10() const;
+  Pipeline< T, Chain< F, Log2 > > log2() const;
+  Pipeline< T, Chain< F, Log1p > > log1p() const;
+  Pipeline< T, Chain< F, Sqrt > > sqrt() const;
+  Pipeline< T, Chain< F, Cbrt > > cbrt() const;
+  Pipeline< T, Chain< F, Sin > > sin() const;
+  Pipeline< T, Chain< F, Cos > > cos() const;
+  Pipeline< T, Chain< F, Tan > > tan() const;
+  Pipeline< T, Chain< F, Asin > > asin() const;
+  Pipeline< T, Chain< F, Acos > > acos() const;
+  Pipeline< T, Chain< F, Atan > > atan() const;
+  Pipeline< T, Chain< F, Sinh > > sinh() const;
+  Pipeline< T, Chain< F, Cosh > > cosh() const;
+  Pipeline< T, Chain< F, Tanh > > tanh() const;
+  Pipeline< T, Chain< F, Asinh > > asinh() const;
+  Pipeline< T, Chain< F, Acosh > > acosh() const;
+  Pipeline< T, Chain< F, Atanh > > atanh() const;
+  Pipeline< T, Chain< F, Erf > > erf() const;
+  Pipeline< T, Chain< F, Erfc > > erfc() const;
+  Pipeline< T, Chain< F, Ceil > > ceil() const;
+  Pipeline< T, Chain< F, Floor > > floor() const;
+  Pipeline< T, Chain< F, Trunc > > trunc() const;
+  Pipeline< T, Chain< F, Round > > round() const;
+
+  // User-supplied stage, which maps a value to a value
+  template < typename G >
+  Pipeline< T, Chain< F, G > > apply(const G &g) const;
+
+  // Apply the stages to each element of x in one traversal, and return x
+  T run() const;
+
+ private:
+  T x_;
+  F f_;
+};
+
+}  // namespace fusion
+
+// Start a pipeline on x
+template < typename T >
+fusion::Pipeline< T > fuse(const T &x);
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_FUSION_HPP_
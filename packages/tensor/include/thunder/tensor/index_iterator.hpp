@@ -33,7 +33,6 @@ class IndexIterator {
 
   // Typedefs from S
   typedef S storage_type;
-  typedef typename S::allocator_type allocator_type;
   typedef typename S::value_type value_type;
   typedef typename S::reference reference;
   typedef typename S::const_reference const_reference;
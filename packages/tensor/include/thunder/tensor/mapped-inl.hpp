@@ -0,0 +1,86 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_MAPPED_INL_HPP_
+#define THUNDER_TENSOR_MAPPED_INL_HPP_
+
+#include "thunder/tensor/mapped.hpp"
+
+#include <cstddef>
+#include <ios>
+#include <memory>
+#include <string>
+
+#include "thunder/exception.hpp"
+#include "thunder/serializer.hpp"
+
+namespace thunder {
+namespace tensor {
+
+template < typename T >
+T loadMapped(const ::std::string &file, ::std::size_t position,
+             typename T::storage_type::Mode mode) {
+  typedef typename T::storage_type S;
+  FileBinarySerializer s(file, ::std::ios_base::in | ::std::ios_base::binary);
+  typename FileBinarySerializer::stream_type &stream = s.protocol().stream();
+  if (!stream) {
+    throw runtime_error("Cannot open file " + file + ".");
+  }
+  stream.seekg(static_cast< ::std::streamoff >(position));
+
+  // Header written by the tensor serializer up to the storage data
+  typename T::small_size_storage size;
+  s.load(&size);
+  typename T::small_stride_storage stride;
+  s.load(&stride);
+  unsigned int key;
+  s.load(&key);
+  if (key == 0) {
+    s.load(&key);
+  }
+  typename S::size_type count;
+  s.load(&count);
+  ::std::streamoff data = stream.tellg();
+  if (!stream) {
+    throw runtime_error("Cannot read tensor header from file " + file + ".");
+  }
+
+  typename T::storage_pointer storage;
+  if (data % alignof(typename T::value_type) == 0) {
+    storage = ::std::make_shared< S >(
+        file, static_cast< ::std::size_t >(data), count, mode);
+    stream.seekg(static_cast< ::std::streamoff >(
+        count * sizeof(typename T::value_type)), ::std::ios_base::cur);
+  } else {
+    storage = ::std::make_shared< S >(count);
+    s.loadArray(storage->data(), count);
+  }
+  typename T::size_type offset;
+  s.load(&offset);
+  if (!stream) {
+    throw runtime_error("Cannot read tensor from file " + file + ".");
+  }
+
+  return T(size, stride, storage, offset);
+}
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_MAPPED_INL_HPP_
@@ -0,0 +1,43 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_MAPPED_HPP_
+#define THUNDER_TENSOR_MAPPED_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace thunder {
+namespace tensor {
+
+// Load a tensor saved by FileBinarySerializer at byte position of file, by
+// mapping its data instead of reading it. T must be a tensor of
+// MappedStorage. The file must hold the first record of the storage, and the
+// data must be aligned for the element type. Otherwise the data is read.
+// Mutating methods copy read-only data to the heap first, but writes through
+// data(), get(), operator() or reference iterators must be preceded by
+// detach(). Copy-on-write mappings only copy the pages that are written.
+template < typename T >
+T loadMapped(const ::std::string &file, ::std::size_t position = 0,
+             typename T::storage_type::Mode mode = T::storage_type::READ_ONLY);
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_MAPPED_HPP_
@@ -22,6 +22,10 @@
 
 #include "thunder/tensor/math.hpp"
 #include "thunder/tensor/math-inl.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 
 #include <cmath>
 #include <complex>
@@ -34,19 +38,12 @@ namespace math {
 
 template < typename T >
 const T& add(const T &x, typename T::const_reference y) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] + y;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = (*x_begin) + y;
-    }
+  if (simd::binary(simd::ADD, x, y)) {
+    return x;
   }
+  parallel::forEach(x, [&y](typename T::reference x_ref) {
+      x_ref = x_ref + y;
+    });
   return x;
 }
 template < typename T >
@@ -54,41 +51,24 @@ const T& add(const T &x, const T &y) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-        y.partialContiguity(0, y.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] + y_pointer[i * y_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = (*x_begin) + (*y_begin);
-    }
+  if (simd::binary(simd::ADD, x, y)) {
+    return x;
   }
+  parallel::forEach(x, y, [](typename T::reference x_ref,
+                             typename T::reference y_ref) {
+      x_ref = x_ref + y_ref;
+    });
   return x;
 }
 
 template < typename T >
 const T& sub(const T &x, typename T::const_reference y) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] - y;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = (*x_begin) - y;
-    }
+  if (simd::binary(simd::SUB, x, y)) {
+    return x;
   }
+  parallel::forEach(x, [&y](typename T::reference x_ref) {
+      x_ref = x_ref - y;
+    });
   return x;
 }
 template < typename T >
@@ -96,41 +76,24 @@ const T& sub(const T &x, const T &y) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-        y.partialContiguity(0, y.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] - y_pointer[i * y_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = (*x_begin) - (*y_begin);
-    }
+  if (simd::binary(simd::SUB, x, y)) {
+    return x;
   }
+  parallel::forEach(x, y, [](typename T::reference x_ref,
+                             typename T::reference y_ref) {
+      x_ref = x_ref - y_ref;
+    });
   return x;
 }
 
 template < typename T >
 const T& mul(const T &x, typename T::const_reference y) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] * y;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = (*x_begin) * y;
-    }
+  if (simd::binary(simd::MUL, x, y)) {
+    return x;
   }
+  parallel::forEach(x, [&y](typename T::reference x_ref) {
+      x_ref = x_ref * y;
+    });
   return x;
 }
 template < typename T >
@@ -138,41 +101,24 @@ const T& mul(const T &x, const T &y) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-        y.partialContiguity(0, y.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] * y_pointer[i * y_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = (*x_begin) * (*y_begin);
-    }
+  if (simd::binary(simd::MUL, x, y)) {
+    return x;
   }
+  parallel::forEach(x, y, [](typename T::reference x_ref,
+                             typename T::reference y_ref) {
+      x_ref = x_ref * y_ref;
+    });
   return x;
 }
 
 template < typename T >
 const T& div(const T &x, typename T::const_reference y) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] / y;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = (*x_begin) / y;
-    }
+  if (simd::binary(simd::DIV, x, y)) {
+    return x;
   }
+  parallel::forEach(x, [&y](typename T::reference x_ref) {
+      x_ref = x_ref / y;
+    });
   return x;
 }
 template < typename T >
@@ -180,44 +126,48 @@ const T& div(const T &x, const T &y) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-        y.partialContiguity(0, y.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = x_pointer[i * x_step] / y_pointer[i * y_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = (*x_begin) / (*y_begin);
-    }
+  if (simd::binary(simd::DIV, x, y)) {
+    return x;
   }
+  parallel::forEach(x, y, [](typename T::reference x_ref,
+                             typename T::reference y_ref) {
+      x_ref = x_ref / y_ref;
+    });
   return x;
 }
 
 #define THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(func)                     \
   template < typename T >                                               \
   const T& func(const T &x, typename T::const_reference y) {            \
-    if (x.partialContiguity(0, x.dimension() - 1)) {                    \
-      typename T::pointer x_pointer = x.data();                         \
-      typename T::difference_type x_step = x.stride(x.dimension() - 1); \
-      typename T::size_type x_length = x.length();                      \
-      for (typename T::size_type i = 0; i < x_length; ++i) {            \
-        x_pointer[i * x_step] = static_cast< typename T::value_type >(  \
-            ::std::func(x_pointer[i * x_step], y));                     \
-      }                                                                 \
-    } else {                                                            \
-      for (typename T::reference_iterator x_begin = x.reference_begin(), \
-               x_end = x.reference_end(); x_begin != x_end; ++x_begin) { \
-        *x_begin = static_cast< typename T::value_type >(               \
-            ::std::func(*x_begin, y));                                  \
-      }                                                                 \
+    parallel::forEach(x, [&y](typename T::reference x_ref) {            \
+        x_ref = static_cast< typename T::value_type >(                  \
+            ::std::func(x_ref, y));                                     \
+      });                                                               \
+    return x;                                                           \
+  }                                                                     \
+  template < typename T >                                               \
+  const T& func(const T &x, const T &y) {                               \
+    if (x.length() != y.length()) {                                     \
+      throw out_of_range("Tensors have different length.");              \
     }                                                                   \
+    parallel::forEach(x, y, [](typename T::reference x_ref,             \
+                               typename T::reference y_ref) {           \
+        x_ref = static_cast< typename T::value_type >(                  \
+            ::std::func(x_ref, y_ref));                                 \
+      });                                                               \
+    return x;                                                           \
+  }
+
+#define THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(func, op)                \
+  template < typename T >                                               \
+  const T& func(const T &x, typename T::const_reference y) {            \
+    if (simd::binary(simd::op, x, y)) {                                 \
+      return x;                                                         \
+    }                                                                   \
+    parallel::forEach(x, [&y](typename T::reference x_ref) {            \
+        x_ref = static_cast< typename T::value_type >(                  \
+            ::std::func(x_ref, y));                                     \
+      });                                                               \
     return x;                                                           \
   }                                                                     \
   template < typename T >                                               \
@@ -225,32 +175,21 @@ const T& div(const T &x, const T &y) {
     if (x.length() != y.length()) {                                     \
       throw out_of_range("Tensors have different length.");              \
     }                                                                   \
-    if (x.partialContiguity(0, x.dimension() - 1) &&                    \
-        y.partialContiguity(0, y.dimension() - 1)) {                    \
-      typename T::pointer x_pointer = x.data();                         \
-      typename T::difference_type x_step = x.stride(x.dimension() - 1); \
-      typename T::size_type x_length = x.length();                      \
-      typename T::pointer y_pointer = y.data();                         \
-      typename T::difference_type y_step = y.stride(y.dimension() - 1); \
-      for (typename T::size_type i = 0; i < x_length; ++i) {            \
-        x_pointer[i * x_step] = static_cast< typename T::value_type >(  \
-            ::std::func(x_pointer[i * x_step], y_pointer[i * y_step])); \
-      }                                                                 \
-    } else {                                                            \
-      for (typename T::reference_iterator x_begin = x.reference_begin(), \
-               x_end = x.reference_end(), y_begin = y.reference_begin(); \
-           x_begin != x_end; ++x_begin, ++y_begin) {                    \
-        *x_begin = static_cast< typename T::value_type > (              \
-            ::std::func(*x_begin, *y_begin));                           \
-      }                                                                 \
+    if (simd::binary(simd::op, x, y)) {                                 \
+      return x;                                                         \
     }                                                                   \
+    parallel::forEach(x, y, [](typename T::reference x_ref,             \
+                               typename T::reference y_ref) {           \
+        x_ref = static_cast< typename T::value_type >(                  \
+            ::std::func(x_ref, y_ref));                                 \
+      });                                                               \
     return x;                                                           \
   }
 
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(fmod);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(remainder);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(fmax);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(fmin);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(fmax, FMAX);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(fmin, FMIN);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(fdim);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(pow);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(hypot);
@@ -261,30 +200,21 @@ THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(scalbln);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(nextafter);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(nexttoward);
 THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(copysign);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(isgreater);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(isgreaterequal);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(isless);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(islessequal);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(islessgreater);
-THUNDER_TENSOR_MATH_DEFINE_STD_BINARY(isunordered);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(isgreater, ISGREATER);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(isgreaterequal, ISGREATEREQUAL);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(isless, ISLESS);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(islessequal, ISLESSEQUAL);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(islessgreater, ISLESSGREATER);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY(isunordered, ISUNORDERED);
 
 #undef THUNDER_TENSOR_MATH_DEFINE_STD_BINARY
+#undef THUNDER_TENSOR_MATH_DEFINE_SIMD_BINARY
 
 template < typename T >
 const T& fill(const T &x, typename T::const_reference y) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = y;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = y;
-    }
-  }
+  parallel::forEach(x, [&y](typename T::reference x_ref) {
+      x_ref = y;
+    });
   return x;
 }
 
@@ -293,21 +223,14 @@ const T1& copy(const T1 &x, const T2 &y) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.isContiguous() && y.isContiguous()) {
-    typename T1::size_type x_length = x.length();
-    typename T1::pointer x_data = x.data();
-    typename T2::pointer y_data = y.data();
-    for (typename T1::size_type i = 0; i < x_length; ++i) {
-      x_data[i] = static_cast< typename T1::value_type >(y_data[i]);
-    }
-  } else {
-    typename T2::reference_iterator y_begin = y.reference_begin();
-    for (typename T1::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = static_cast< typename T1::value_type>(*y_begin);
-    }
+  // Layouts contiguous in different dimensions are copied in blocks
+  if (simd::transpose(x, y)) {
+    return x;
   }
+  parallel::forEach(x, y, [](typename T1::reference x_ref,
+                             typename T2::reference y_ref) {
+      x_ref = static_cast< typename T1::value_type >(y_ref);
+    });
   return x;
 }
 
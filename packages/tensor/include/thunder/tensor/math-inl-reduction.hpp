@@ -24,10 +24,17 @@
 #include "thunder/tensor/math-inl.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "thunder/exception.hpp"
 #include "thunder/tensor/index_iterator.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/reduction.hpp"
+#include "thunder/tensor/reduction-inl.hpp"
 #include "thunder/tensor/tensor.hpp"
 
 namespace thunder {
@@ -42,35 +49,22 @@ const typename T::value_type max(
   if (pos->size(0) != x.dimension()) {
     pos->resize(x.dimension());
   }
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    typename T::size_type position = 0;
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      if (x_pointer[i * x_step] > max_value) {
-        max_value = x_pointer[i * x_step];
-        position = i;
+  pos->detach();
+  typename T::size_type index = 0;
+  typename T::size_type position = 0;
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      if (x_value > max_value) {
+        max_value = x_value;
+        position = index;
       }
-    }
-    for (typename T::dim_type i = x.dimension() - 1; i > 0; --i) {
-      (*pos)(i) = position % x.size(i);
-      position /= x.size(i);
-    }
-    (*pos)(0) = position;
-  } else {
-    typename T::size_storage position;
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      if (*x_begin > max_value) {
-        max_value = *x_begin;
-        position = x_begin.position();
-      }
-    }
-    for (typename T::dim_type i = 0; i < x.dimension(); ++i) {
-      (*pos)(i) = position[i];
-    }
+      ++index;
+    });
+  for (typename T::dim_type i = x.dimension() - 1; i > 0; --i) {
+    (*pos)(i) = position % x.size(i);
+    position /= x.size(i);
   }
+  (*pos)(0) = position;
   return max_value;
 }
 
@@ -82,35 +76,22 @@ const typename T::value_type min(
   if (pos->size(0) != x.dimension()) {
     pos->resize(x.dimension());
   }
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    typename T::size_type position = 0;
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      if (x_pointer[i * x_step] < min_value) {
-        min_value = x_pointer[i * x_step];
-        position = i;
-      }
-    }
-    for (typename T::dim_type i = x.dimension() - 1; i > 0; --i) {
-      (*pos)(i) = position % x.size(i);
-      position /= x.size(i);
-    }
-    (*pos)(0) = position;
-  } else {
-    typename T::size_storage position;
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      if (*x_begin < min_value) {
-        min_value = *x_begin;
-        position = x_begin.position();
+  pos->detach();
+  typename T::size_type index = 0;
+  typename T::size_type position = 0;
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      if (x_value < min_value) {
+        min_value = x_value;
+        position = index;
       }
-    }
-    for (typename T::dim_type i = 0; i < x.dimension(); ++i) {
-      (*pos)(i) = position[i];
-    }
+      ++index;
+    });
+  for (typename T::dim_type i = x.dimension() - 1; i > 0; --i) {
+    (*pos)(i) = position % x.size(i);
+    position /= x.size(i);
   }
+  (*pos)(0) = position;
   return min_value;
 }
 
@@ -118,23 +99,12 @@ template < typename T >
 const typename T::value_type max(const T &x) {
   typename T::value_type max_value =
       ::std::numeric_limits< typename T::value_type >::lowest();
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      if (x_pointer[i * x_step] > max_value) {
-        max_value = x_pointer[i * x_step];
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      if (x_value > max_value) {
+        max_value = x_value;
       }
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      if (*x_begin > max_value) {
-        max_value = *x_begin;
-      }
-    }
-  }
+    });
   return max_value;
 }
 
@@ -142,61 +112,32 @@ template < typename T >
 const typename T::value_type min(const T &x) {
   typename T::value_type min_value =
       ::std::numeric_limits< typename T::value_type >::max();
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      if (x_pointer[i * x_step] < min_value) {
-        min_value = x_pointer[i * x_step];
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      if (x_value < min_value) {
+        min_value = x_value;
       }
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      if (*x_begin < min_value) {
-        min_value = *x_begin;
-      }
-    }
-  }
+    });
   return min_value;
 }
 
 template < typename T >
 const typename T::value_type sum(const T &x) {
   typename T::value_type sum_value = 0;
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      sum_value += x_pointer[i * x_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      sum_value += *x_begin;
-    }
-  }
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      sum_value += x_value;
+    });
   return sum_value;
 }
 
 template < typename T >
 const typename T::value_type prod(const T &x) {
   typename T::value_type prod_value = 1;
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      prod_value *= x_pointer[i * x_step];
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      prod_value *= *x_begin;
-    }
-  }
+  parallel::forEach(parallel::sequential, x, [&](
+      typename T::const_reference x_value) {
+      prod_value *= x_value;
+    });
   return prod_value;
 }
 
@@ -206,24 +147,46 @@ const typename T::value_type mean(const T &x) {
 }
 
 template < typename T >
-const typename T::value_type var(const T &x) {
-  typename T::value_type sum_value = 0;
-  typename T::value_type mean_value = x.mean();
-  typename T::size_type x_length = x.length();
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::pointer x_pointer = x.data();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      sum_value += (x_pointer[i * x_step] - mean_value) *
-          (x_pointer[i * x_step] - mean_value);
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      sum_value += (*x_begin - mean_value) * (*x_begin - mean_value);
-    }
+const typename T::value_type sum(const T &x, reduction::Summation summation) {
+  typedef typename T::value_type value_type;
+  if (summation == reduction::SEQUENTIAL) {
+    return x.sum();
+  }
+  ::std::size_t chunks =
+      (x.length() + reduction::chunk - 1) / reduction::chunk;
+  if (summation == reduction::PAIRWISE) {
+    ::std::vector< value_type > partial(chunks);
+    reduction::forChunks(x, [&](::std::size_t c, const value_type *x_pointer,
+                                ::std::size_t n) {
+        partial[c] = reduction::pairwiseSum(x_pointer, n);
+      });
+    return reduction::pairwiseSum(partial.data(), chunks);
+  }
+  ::std::vector< value_type > partial(chunks, 0);
+  ::std::vector< value_type > compensation(chunks, 0);
+  reduction::forChunks(x, [&](::std::size_t c, const value_type *x_pointer,
+                              ::std::size_t n) {
+      reduction::kahanSum(x_pointer, n, &partial[c], &compensation[c]);
+    });
+  value_type sum_value = 0;
+  value_type sum_compensation = 0;
+  for (::std::size_t c = 0; c < chunks; ++c) {
+    compensation[c] = -compensation[c];
   }
-  return sum_value / static_cast< typename T::value_type >(x_length);
+  reduction::kahanSum(partial.data(), chunks, &sum_value, &sum_compensation);
+  reduction::kahanSum(compensation.data(), chunks, &sum_value,
+                      &sum_compensation);
+  return sum_value - sum_compensation;
+}
+
+template < typename T >
+const typename T::value_type mean(const T &x, reduction::Summation summation) {
+  return sum(x, summation) / static_cast< typename T::value_type >(x.length());
+}
+
+template < typename T >
+const typename T::value_type var(const T &x) {
+  return meanVar(x).second;
 }
 
 template < typename T >
@@ -231,87 +194,51 @@ const typename T::value_type std(const T &x) {
   return ::std::sqrt(x.var());
 }
 
+template < typename T >
+const ::std::pair< typename T::value_type, typename T::value_type > meanVar(
+    const T &x) {
+  typedef typename T::value_type value_type;
+  ::std::pair< value_type, value_type > result;
+  reduction::moments(x, [&](value_type mean_value, value_type m2_value) {
+      result.first = mean_value;
+      result.second = m2_value / static_cast< value_type >(x.length());
+    });
+  return result;
+}
+
 template < typename T >
 T max(const T &x, typename T::dim_type d,
       Tensor< typename T::size_storage > *pos) {
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
   pos->resizeAs(t);
-  if (x.partialContiguity(0, d) && x.partialContiguity(d + 1, x.dimension() - 1)
-      && pos->partialContiguity(0, d)
-      && pos->partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    typename Tensor< typename T::size_storage >::pointer p_data = pos->data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::difference_type p_left_step = d > 0 ? pos->stride(d - 1) : 0;
-    typename T::difference_type p_right_step =
-        pos->stride(pos->dimension() - 1);
-    // Run the loop
-    typename T::value_type max_value =
-        ::std::numeric_limits< typename T::value_type >::lowest();
-    typename T::size_type pos_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        max_value = ::std::numeric_limits< typename T::value_type >::lowest();
-        pos_value = 0;
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          typename T::value_type current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-          if (current_value > max_value) {
-            max_value = current_value;
-            pos_value = k;
-          }
+  pos->detach();
+  // Positions are written to a contiguous tensor first
+  typedef Tensor< typename T::size_storage > P;
+  P p = pos->isContiguous() ? *pos : P(t.size());
+  typename T::pointer t_data = t.data();
+  typename P::pointer p_data = p.data();
+  typedef ::std::pair< typename T::value_type, typename T::size_type > A;
+  reduction::reduce< A >(
+      x, d, [](typename T::size_type) {
+        return A(::std::numeric_limits< typename T::value_type >::lowest(), 0);
+      },
+      [](A &acc, typename T::value_type value, typename T::size_type k) {
+        if (value > acc.first) {
+          acc.first = value;
+          acc.second = k;
         }
-        t_data[i * t_left_step + j * t_right_step] = max_value;
-        p_data[i * p_left_step + j * p_right_step] = pos_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type max_value =
-        ::std::numeric_limits< typename T::value_type >::lowest();
-    typename T::size_type pos_value = 0;
-    typename Tensor< typename T::size_storage >::reference_iterator p_begin =
-        pos->reference_begin();
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end();
-         t_begin != t_end; ++t_begin, ++p_begin) {
-      max_value = ::std::numeric_limits< typename T::value_type >::lowest();
-      pos_value = 0;
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        typename T::value_type current_value = x(position);
-        if (current_value > max_value) {
-          max_value = current_value;
-          pos_value = i;
-        }
-      }
-      *t_begin = max_value;
-      *p_begin = pos_value;
-    }
+      },
+      [&](typename T::size_type i, const A &acc) {
+        t_data[i] = acc.first;
+        p_data[i] = acc.second;
+      });
+  if (p_data != pos->data()) {
+    pos->copy(p);
   }
   return t;
 }
@@ -322,83 +249,33 @@ T min(const T &x, typename T::dim_type d,
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
   pos->resizeAs(t);
-  if (x.partialContiguity(0, d) && x.partialContiguity(d + 1, x.dimension() - 1)
-      && pos->partialContiguity(0, d)
-      && pos->partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    typename Tensor< typename T::size_storage >::pointer p_data = pos->data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::difference_type p_left_step = d > 0 ? pos->stride(d - 1) : 0;
-    typename T::difference_type p_right_step =
-        pos->stride(pos->dimension() - 1);
-    // Run the loop
-    typename T::value_type min_value =
-        ::std::numeric_limits< typename T::value_type >::max();
-    typename T::size_type pos_value = 0;
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        min_value = ::std::numeric_limits< typename T::value_type >::max();
-        pos_value = 0;
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-          if (current_value < min_value) {
-            min_value = current_value;
-            pos_value = k;
-          }
-        }
-        t_data[i * t_left_step + j * t_right_step] = min_value;
-        p_data[i * p_left_step + j * p_right_step] = pos_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type min_value =
-        ::std::numeric_limits< typename T::value_type >::max();
-    typename T::size_type pos_value = 0;
-    typename Tensor< typename T::size_storage >::reference_iterator p_begin =
-        pos->reference_begin();
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end();
-         t_begin != t_end; ++t_begin, ++p_begin) {
-      min_value = ::std::numeric_limits< typename T::value_type >::max();
-      pos_value = 0;
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        if (current_value < min_value) {
-          min_value = current_value;
-          pos_value = i;
+  pos->detach();
+  // Positions are written to a contiguous tensor first
+  typedef Tensor< typename T::size_storage > P;
+  P p = pos->isContiguous() ? *pos : P(t.size());
+  typename T::pointer t_data = t.data();
+  typename P::pointer p_data = p.data();
+  typedef ::std::pair< typename T::value_type, typename T::size_type > A;
+  reduction::reduce< A >(
+      x, d, [](typename T::size_type) {
+        return A(::std::numeric_limits< typename T::value_type >::max(), 0);
+      },
+      [](A &acc, typename T::value_type value, typename T::size_type k) {
+        if (value < acc.first) {
+          acc.first = value;
+          acc.second = k;
         }
-      }
-      *t_begin = min_value;
-      *p_begin = pos_value;
-    }
+      },
+      [&](typename T::size_type i, const A &acc) {
+        t_data[i] = acc.first;
+        p_data[i] = acc.second;
+      });
+  if (p_data != pos->data()) {
+    pos->copy(p);
   }
   return t;
 }
@@ -408,66 +285,23 @@ T max(const T &x, typename T::dim_type d) {
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
-  if (x.partialContiguity(0, d)
-      && x.partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::value_type max_value =
-        ::std::numeric_limits< typename T::value_type >::lowest();
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        max_value = ::std::numeric_limits< typename T::value_type >::lowest();
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-          if (current_value > max_value) {
-            max_value = current_value;
-          }
-        }
-        t_data[i * t_left_step + j * t_right_step] = max_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type max_value =
-        ::std::numeric_limits< typename T::value_type >::lowest();
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      max_value = ::std::numeric_limits< typename T::value_type >::lowest();
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        if (current_value > max_value) {
-          max_value = current_value;
+  typename T::pointer t_data = t.data();
+  reduction::reduce< typename T::value_type >(
+      x, d, [](typename T::size_type) {
+        return ::std::numeric_limits< typename T::value_type >::lowest();
+      },
+      [](typename T::reference acc, typename T::value_type value,
+         typename T::size_type) {
+        if (value > acc) {
+          acc = value;
         }
-      }
-      *t_begin = max_value;
-    }
-  }
+      },
+      [&](typename T::size_type i, typename T::const_reference acc) {
+        t_data[i] = acc;
+      });
   return t;
 }
 
@@ -476,66 +310,23 @@ T min(const T &x, typename T::dim_type d) {
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
-  if (x.partialContiguity(0, d)
-      && x.partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::value_type min_value =
-        ::std::numeric_limits< typename T::value_type >::max();
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        min_value = ::std::numeric_limits< typename T::value_type >::max();
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-          if (current_value < min_value) {
-            min_value = current_value;
-          }
-        }
-        t_data[i * t_left_step + j * t_right_step] = min_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type min_value =
-        ::std::numeric_limits< typename T::value_type >::max();
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      min_value = ::std::numeric_limits< typename T::value_type >::max();
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        if (current_value < min_value) {
-          min_value = current_value;
+  typename T::pointer t_data = t.data();
+  reduction::reduce< typename T::value_type >(
+      x, d, [](typename T::size_type) {
+        return ::std::numeric_limits< typename T::value_type >::max();
+      },
+      [](typename T::reference acc, typename T::value_type value,
+         typename T::size_type) {
+        if (value < acc) {
+          acc = value;
         }
-      }
-      *t_begin = min_value;
-    }
-  }
+      },
+      [&](typename T::size_type i, typename T::const_reference acc) {
+        t_data[i] = acc;
+      });
   return t;
 }
 
@@ -544,60 +335,21 @@ T sum(const T &x, typename T::dim_type d) {
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
-  if (x.partialContiguity(0, d)
-      && x.partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::value_type sum_value = 0;
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        sum_value = 0;
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-            sum_value += current_value;
-        }
-        t_data[i * t_left_step + j * t_right_step] = sum_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type sum_value = 0;
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      sum_value = 0;
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        sum_value += current_value;
-      }
-      *t_begin = sum_value;
-    }
-  }
+  typename T::pointer t_data = t.data();
+  reduction::reduce< typename T::value_type >(
+      x, d, [](typename T::size_type) {
+        return static_cast< typename T::value_type >(0);
+      },
+      [](typename T::reference acc, typename T::value_type value,
+         typename T::size_type) {
+        acc += value;
+      },
+      [&](typename T::size_type i, typename T::const_reference acc) {
+        t_data[i] = acc;
+      });
   return t;
 }
 
@@ -606,60 +358,21 @@ T prod(const T &x, typename T::dim_type d) {
   if (d >= x.dimension()) {
     throw out_of_range("Dimension exceeds limit.");
   }
-  typename T::size_storage sz = x.size();
+  typename T::small_size_storage sz = x.size();
   sz[d] = 1;
   T t(sz);
-  if (x.partialContiguity(0, d)
-      && x.partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    typename T::value_type prod_value = 1;
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        prod_value = 1;
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-            prod_value *= current_value;
-        }
-        t_data[i * t_left_step + j * t_right_step] = prod_value;
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type prod_value = 1;
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      prod_value = 1;
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        prod_value *= current_value;
-      }
-      *t_begin = prod_value;
-    }
-  }
+  typename T::pointer t_data = t.data();
+  reduction::reduce< typename T::value_type >(
+      x, d, [](typename T::size_type) {
+        return static_cast< typename T::value_type >(1);
+      },
+      [](typename T::reference acc, typename T::value_type value,
+         typename T::size_type) {
+        acc *= value;
+      },
+      [&](typename T::size_type i, typename T::const_reference acc) {
+        t_data[i] = acc;
+      });
   return t;
 }
 
@@ -675,70 +388,7 @@ T mean(const T &x, typename T::dim_type d) {
 
 template < typename T >
 T var(const T &x, typename T::dim_type d) {
-  if (d >= x.dimension()) {
-    throw out_of_range("Dimension exceeds limit.");
-  }
-  T t = x.mean(d);
-  if (x.partialContiguity(0, d)
-      && x.partialContiguity(d + 1, x.dimension() - 1)) {
-    // Get data pointers
-    typename T::pointer x_data = x.data();
-    typename T::pointer t_data = t.data();
-    // Determine left and right size
-    typename T::size_type x_left_length = 1;
-    for (typename T::dim_type i = 0; i < d; ++i) {
-      x_left_length *= x.size(i);
-    }
-    typename T::size_type x_length = x.size(d);
-    typename T::size_type x_right_length = 1;
-    for (typename T::dim_type i = d + 1; i < x.dimension(); ++i) {
-      x_right_length *= x.size(i);
-    }
-    // Determine left and right step
-    typename T::difference_type x_left_step = d > 0 ? x.stride(d - 1) : 0;
-    typename T::difference_type x_step = x.stride(d);
-    typename T::difference_type x_right_step = x.stride(x.dimension() - 1);
-    typename T::difference_type t_left_step = d > 0 ? t.stride(d - 1) : 0;
-    typename T::difference_type t_right_step = t.stride(t.dimension() - 1);
-    // Run the loop
-    typename T::value_type sum_value = 0;
-    typename T::value_type mean_value = 0;
-    typename T::value_type current_value = 0;
-    for (typename T::size_type i = 0; i < x_left_length; ++i) {
-      for (typename T::size_type j = 0; j < x_right_length; ++j) {
-        sum_value = 0;
-        mean_value = t_data[i * t_left_step + j * t_right_step];
-        for (typename T::size_type k = 0; k < x_length; ++k) {
-          current_value =
-              x_data[i * x_left_step + j * x_right_step + k * x_step];
-          sum_value +=
-              (current_value - mean_value) * (current_value - mean_value);
-        }
-        t_data[i * t_left_step + j * t_right_step] =
-            sum_value / static_cast< typename T::value_type >(x_length);
-      }
-    }
-  } else {
-    typename T::size_storage position;
-    typename T::size_type size_d = x.size(d);
-    typename T::value_type sum_value = 0;
-    typename T::value_type mean_value = 0;
-    typename T::value_type current_value = 0;
-    for (typename T::reference_iterator t_begin = t.reference_begin(),
-             t_end = t.reference_end(); t_begin != t_end; ++t_begin) {
-      sum_value = 0;
-      mean_value = *t_begin;
-      position = t_begin.position();
-      for (typename T::size_type i = 0; i < size_d; ++i) {
-        position[d] = i;
-        current_value = x(position);
-        sum_value +=
-            (current_value - mean_value) * (current_value - mean_value);
-      }
-      *t_begin = sum_value / static_cast< typename T::value_type >(size_d);
-    }
-  }
-  return t;
+  return meanVar(x, d).second;
 }
 
 template < typename T >
@@ -750,6 +400,28 @@ T std(const T &x, typename T::dim_type d) {
   return t.sqrt();
 }
 
+template < typename T >
+::std::pair< T, T > meanVar(const T &x, typename T::dim_type d) {
+  if (d >= x.dimension()) {
+    throw out_of_range("Dimension exceeds limit.");
+  }
+  typedef typename T::value_type value_type;
+  typename T::small_size_storage sz = x.size();
+  sz[d] = 1;
+  T m(sz);
+  T v(sz);
+  typename T::pointer m_data = m.data();
+  typename T::pointer v_data = v.data();
+  value_type x_length = static_cast< value_type >(x.size(d));
+  reduction::moments(
+      x, d, [&](typename T::size_type i, value_type mean_value,
+                value_type m2_value) {
+        m_data[i] = mean_value;
+        v_data[i] = m2_value / x_length;
+      });
+  return ::std::make_pair(m, v);
+}
+
 }  // namespace math
 }  // namespace tensor
 }  // namespace thunder
@@ -22,6 +22,10 @@
 
 #include "thunder/tensor/math.hpp"
 #include "thunder/tensor/math-inl.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 
 #include <cmath>
 #include <complex>
@@ -51,21 +55,12 @@ const T1& polar(const T1 &x, const T2 &r, const T2 &theta) {
 template < typename T >
 const T& fma(
     const T &x, typename T::const_reference y, typename T::const_reference z) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = static_cast< typename T::value_type >(
-          ::std::fma(x_pointer[i * x_step], y, z));
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = static_cast< typename T::value_type >(
-          ::std::fma(*x_begin, y, z));
-    }
+  if (simd::fma(x, y, z)) {
+    return x;
   }
+  parallel::forEach(x, [&y, &z](typename T::reference x_ref) {
+      x_ref = static_cast< typename T::value_type >(::std::fma(x_ref, y, z));
+    });
   return x;
 }
 
@@ -74,25 +69,14 @@ const T& fma(const T &x, const T &y, typename T::const_reference z) {
   if (x.length() != y.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-      y.partialContiguity(0, y.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = static_cast< typename T::value_type >(
-          ::std::fma(x_pointer[i * x_step], y_pointer[i * y_step], z));
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin();
-         x_begin != x_end; ++x_begin, ++y_begin) {
-      *x_begin = static_cast< typename T::value_type >(
-          ::std::fma(*x_begin, *y_begin, z));
-    }
+  if (simd::fma(x, y, z)) {
+    return x;
   }
+  parallel::forEach(x, y, [&z](typename T::reference x_ref,
+                               typename T::reference y_ref) {
+      x_ref = static_cast< typename T::value_type >(
+          ::std::fma(x_ref, y_ref, z));
+    });
   return x;
 }
 
@@ -101,25 +85,14 @@ const T& fma(const T &x, typename T::const_reference y, const T &z) {
   if (x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-      z.partialContiguity(0, z.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer z_pointer = z.data();
-    typename T::difference_type z_step = z.stride(z.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = static_cast< typename T::value_type >(
-          ::std::fma(x_pointer[i * x_step], y, z_pointer[i * z_step]));
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), z_begin = z.reference_begin();
-         x_begin != x_end; ++x_begin, ++z_begin) {
-      *x_begin = static_cast< typename T::value_type >(
-          ::std::fma(*x_begin, y, *z_begin));
-    }
+  if (simd::fma(x, y, z)) {
+    return x;
   }
+  parallel::forEach(x, z, [&y](typename T::reference x_ref,
+                               typename T::reference z_ref) {
+      x_ref = static_cast< typename T::value_type >(
+          ::std::fma(x_ref, y, z_ref));
+    });
   return x;
 }
 
@@ -128,29 +101,15 @@ const T& fma(const T &x, const T &y, const T &z) {
   if (x.length() != y.length() || x.length() != z.length()) {
     throw out_of_range("Tensors have different length.");
   }
-  if (x.partialContiguity(0, x.dimension() - 1) &&
-      y.partialContiguity(0, y.dimension() - 1) &&
-      z.partialContiguity(0, z.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    typename T::pointer y_pointer = y.data();
-    typename T::difference_type y_step = y.stride(y.dimension() - 1);
-    typename T::pointer z_pointer = z.data();
-    typename T::difference_type z_step = z.stride(z.dimension() - 1);
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = static_cast< typename T::value_type >(::std::fma(
-          x_pointer[i * x_step], y_pointer[i * y_step], z_pointer[i * z_step]));
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(), y_begin = y.reference_begin(),
-             z_begin = z.reference_begin(); x_begin != x_end;
-         ++x_begin, ++y_begin, ++z_begin) {
-      *x_begin = static_cast< typename T::value_type >(
-          ::std::fma(*x_begin, *y_begin, *z_begin));
-    }
+  if (simd::fma(x, y, z)) {
+    return x;
   }
+  parallel::forEach(x, y, z, [](typename T::reference x_ref,
+                                typename T::reference y_ref,
+                                typename T::reference z_ref) {
+      x_ref = static_cast< typename T::value_type >(
+          ::std::fma(x_ref, y_ref, z_ref));
+    });
   return x;
 }
 
@@ -28,6 +28,8 @@
 
 #include "thunder/exception.hpp"
 #include "thunder/tensor/index_iterator.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -45,7 +47,7 @@ T1 extract(const T1 &x, const T2 &y) {
       throw out_of_range("Size does not match.");
     }
   }
-  typename T1::size_storage sz(x.dimension() - y_dimension + 1);
+  typename T1::small_size_storage sz(x.dimension() - y_dimension + 1);
   for (typename T1::dim_type i = y_dimension; i < x.dimension(); ++i) {
     sz[i - y_dimension + 1] = x.size(i);
   }
@@ -60,12 +62,12 @@ T1 extract(const T1 &x, const T2 &y) {
       }
     }
   } else {
-    for (typename T2::reference_iterator begin = y.reference_begin(),
-             end = y.reference_end(); begin != end; ++begin) {
-      if (static_cast< bool >(*begin) == true) {
-        ++sz[0];
-      }
-    }
+    parallel::forEach(parallel::sequential, y, [&sz](
+        typename T2::reference y_value) {
+        if (static_cast< bool >(y_value) == true) {
+          ++sz[0];
+        }
+      });
   }
 
   // Create the new tensor and do the copy
@@ -87,16 +89,15 @@ T1 extract(const T1 &x, const T2 &y) {
       }
     }
   } else {
-    typename T1::size_storage y_size(y.dimension());
+    typename T1::small_size_storage y_size(y.dimension());
     for (typename T1::dim_type i = 0; i < y_size.size(); ++i) {
       y_size[i] = y.size(i);
     }
     typename T1::size_type pos = 0;
-    IndexIterator< typename T1::size_storage > t_begin =
-        IndexIterator< typename T1::size_storage>::begin(y_size);
-    for (IndexIterator< typename T2::size_storage > begin =
-             IndexIterator< typename T2::size_storage >::begin(y.size()),
-             end = IndexIterator< typename T2::size_storage >::end(y.size());
+    IndexIterator< typename T1::small_size_storage > t_begin =
+        IndexIterator< typename T1::small_size_storage>::begin(y_size);
+    typedef IndexIterator< typename T2::small_size_storage > Y;
+    for (Y begin = Y::begin(y.size()), end = Y::end(y.size());
          begin != end; ++begin, ++t_begin) {
       if (static_cast< bool >(y[*begin]()) == true) {
         t[pos++].copy(x[*t_begin]);
@@ -114,7 +115,7 @@ T1 shuffle(const T1 &x, const T2 &y) {
   }
   if (y.dimension() == 1) {
     T1 t;
-    typename T1::size_storage ind(x.dimension());
+    typename T1::small_size_storage ind(x.dimension());
     for (typename T2::dim_type i = 0; i < y.size(0); ++i) {
       ind[i] = static_cast< typename T1::size_type >(y(i));
       if (ind[i] >= x.size(i)) {
@@ -124,15 +125,15 @@ T1 shuffle(const T1 &x, const T2 &y) {
     t() = x(ind);
     return t;
   }
-  typename T1::size_storage sz(y.dimension() - 1);
+  typename T1::small_size_storage sz(y.dimension() - 1);
   for (typename T1::dim_type i = 0; i < sz.size(); ++i) {
     sz[i] = y.size(i);
   }
   T1 t(sz);
-  typename T1::size_storage ind(x.dimension());
-  for (IndexIterator< typename T1::size_storage > begin =
-           IndexIterator< typename T1::size_storage >::begin(sz),
-           end = IndexIterator< typename T1::size_storage >::end(sz);
+  typename T1::small_size_storage ind(x.dimension());
+  for (IndexIterator< typename T1::small_size_storage > begin =
+           IndexIterator< typename T1::small_size_storage >::begin(sz),
+           end = IndexIterator< typename T1::small_size_storage >::end(sz);
        begin != end; ++begin) {
     for (typename T1::dim_type i = 0; i < ind.size(); ++i) {
       ind[i] = static_cast< typename T1::size_type >(y[*begin](i));
@@ -150,25 +151,12 @@ T1 shuffle(const T1 &x, const T2 &y) {
   T2 tfunc(const T1 &x) {                                               \
     T2 t;                                                               \
     t.resizeAs(x);                                                      \
-    typename T2::pointer t_pointer = t.data();                          \
-    typename T2::difference_type t_step = t.stride(t.dimension() - 1);  \
-    if (x.partialContiguity(0, x.dimension() - 1)) {                    \
-      typename T1::pointer x_pointer = x.data();                        \
-      typename T1::difference_type x_step = x.stride(x.dimension() - 1); \
-      typename T1::size_type x_length = x.length();                     \
-      for (typename T1::size_type i = 0; i < x_length; ++i) {           \
-        t_pointer[i * t_step] = static_cast< typename T2::value_type >( \
-            ::std::sfunc(x_pointer[i * x_step]));                       \
-      }                                                                 \
-    } else {                                                            \
-      typename T2::size_type i = 0;                                     \
-      for (typename T1::reference_iterator x_begin = x.reference_begin(), \
-               x_end = x.reference_end(); x_begin != x_end; ++x_begin) { \
-        t_pointer[i * t_step] =                                         \
-            static_cast< typename T2::value_type >(::std::sfunc(*x_begin)); \
-        ++i;                                                            \
-      }                                                                 \
-    }                                                                   \
+    parallel::forEach(                                                  \
+        t, x, [](typename T2::reference t_value,                        \
+                 typename T1::reference x_value) {                      \
+          t_value = static_cast< typename T2::value_type >(             \
+              ::std::sfunc(x_value));                                   \
+        });                                                             \
     return t;                                                           \
   }
 
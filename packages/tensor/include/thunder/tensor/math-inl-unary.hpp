@@ -22,6 +22,10 @@
 
 #include "thunder/tensor/math.hpp"
 #include "thunder/tensor/math-inl.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/simd.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 
 #include <cmath>
 #include <complex>
@@ -33,48 +37,49 @@ namespace math {
 #define THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(func)                      \
   template < typename T >                                               \
   const T& func(const T &x) {                                           \
-    if (x.partialContiguity(0, x.dimension() - 1)) {                    \
-      typename T::pointer x_pointer = x.data();                         \
-      typename T::difference_type x_step = x.stride(x.dimension() - 1); \
-      typename T::size_type x_length = x.length();                      \
-      for (typename T::size_type i = 0; i < x_length; ++i) {            \
-        x_pointer[i * x_step] = static_cast< typename T::value_type >(  \
-            ::std::func(x_pointer[i * x_step]));                        \
-      }                                                                 \
-    } else {                                                            \
-      for (typename T::reference_iterator x_begin = x.reference_begin(), \
-               x_end = x.reference_end(); x_begin != x_end; ++x_begin) { \
-        *x_begin = static_cast< typename T::value_type >(               \
-            ::std::func(*x_begin));                                     \
-      }                                                                 \
+    parallel::forEach(x, [](typename T::reference x_ref) {              \
+        x_ref = static_cast< typename T::value_type >(::std::func(x_ref)); \
+      });                                                               \
+    return x;                                                           \
+  }
+
+// Functions with vectorized kernels use them on contiguous tensors
+#define THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(func, FUNCTION)           \
+  template < typename T >                                               \
+  const T& func(const T &x) {                                           \
+    if (simd::unary(simd::FUNCTION, x)) {                               \
+      return x;                                                         \
     }                                                                   \
+    parallel::forEach(x, [](typename T::reference x_ref) {              \
+        x_ref = static_cast< typename T::value_type >(::std::func(x_ref)); \
+      });                                                               \
     return x;                                                           \
   }
 
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(abs);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(fabs);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(exp);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(exp, EXP);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(exp2);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(expm1);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(log);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(log, LOG);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(log10);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(log2);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(log1p);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(sqrt);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(sqrt, SQRT);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(cbrt);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(sin);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(cos);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(sin, SIN);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(cos, COS);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(tan);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(asin);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(acos);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(atan);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(sinh);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(cosh);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(tanh);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(tanh, TANH);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(asinh);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(acosh);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(atanh);
-THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(erf);
+THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY(erf, ERF);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(erfc);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(tgamma);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(lgamma);
@@ -96,6 +101,7 @@ THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(imag);
 THUNDER_TENSOR_MATH_DEFINE_STD_UNARY(arg);
 
 #undef THUNDER_TENSOR_MATH_DEFINE_STD_UNARY
+#undef THUNDER_TENSOR_MATH_DEFINE_SIMD_UNARY
 
 template < typename A >
 const Tensor< Storage< double, A > >& abs(
@@ -115,39 +121,20 @@ const Tensor< Storage< ::std::size_t, A > >& abs(
 
 template < typename T >
 const T& cnrm(const T &x) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = static_cast< typename T::value_type >(
-          ::std::norm(x_pointer[i * x_step]));
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = static_cast< typename T::value_type >(
-          ::std::norm(*x_begin));
-    }
+  if (simd::cnrm(x)) {
+    return x;
   }
+  parallel::forEach(x, [](typename T::reference x_ref) {
+      x_ref = static_cast< typename T::value_type >(::std::norm(x_ref));
+    });
   return x;
 }
 
 template < typename T >
 const T& zero(const T &x) {
-  if (x.partialContiguity(0, x.dimension() - 1)) {
-    typename T::pointer x_pointer = x.data();
-    typename T::difference_type x_step = x.stride(x.dimension() - 1);
-    typename T::size_type x_length = x.length();
-    for (typename T::size_type i = 0; i < x_length; ++i) {
-      x_pointer[i * x_step] = 0;
-    }
-  } else {
-    for (typename T::reference_iterator x_begin = x.reference_begin(),
-             x_end = x.reference_end(); x_begin != x_end; ++x_begin) {
-      *x_begin = 0;
-    }
-  }
+  parallel::forEach(x, [](typename T::reference x_ref) {
+      x_ref = 0;
+    });
   return x;
 }
 
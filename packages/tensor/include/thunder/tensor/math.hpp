@@ -21,6 +21,7 @@
 #define THUNDER_TENSOR_MATH_HPP_
 
 #include <utility>
+#include "thunder/tensor/reduction.hpp"
 #include "thunder/tensor/tensor.hpp"
 
 namespace thunder {
@@ -286,9 +287,16 @@ const typename T::value_type prod(const T &x);
 template < typename T >
 const typename T::value_type mean(const T &x);
 template < typename T >
+const typename T::value_type sum(const T &x, reduction::Summation summation);
+template < typename T >
+const typename T::value_type mean(const T &x, reduction::Summation summation);
+template < typename T >
 const typename T::value_type var(const T &x);
 template < typename T >
 const typename T::value_type std(const T &x);
+template < typename T >
+const ::std::pair< typename T::value_type, typename T::value_type > meanVar(
+    const T &x);
 
 // Reduction functions along a particular dimension
 template < typename T >
@@ -311,6 +319,8 @@ template < typename T >
 T var(const T &x, typename T::dim_type d);
 template < typename T >
 T std(const T &x, typename T::dim_type d);
+template < typename T >
+::std::pair< T, T > meanVar(const T &x, typename T::dim_type d);
 
 }  // namespace math
 }  // namespace tensor
@@ -0,0 +1,228 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_PARALLEL_INL_HPP_
+#define THUNDER_TENSOR_PARALLEL_INL_HPP_
+
+#include "thunder/tensor/parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "thunder/tensor/strided.hpp"
+#include "thunder/tensor/strided-inl.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace parallel {
+
+template < typename F >
+void forRange(::std::size_t length, const F &func) {
+  forRange(length, getGrain(), func);
+}
+
+template < typename F >
+void forRange(::std::size_t length, ::std::size_t grain, const F &func) {
+  if (length == 0) {
+    return;
+  }
+  grain = grain > 0 ? grain : 1;
+  if (length < 2 * grain) {
+    func(0, length);
+    return;
+  }
+  ::std::shared_ptr< ThreadPool > workers = pool();
+  ::std::size_t chunks = ::std::min(workers->threads() * 4, length / grain);
+  if (chunks <= 1) {
+    func(0, length);
+    return;
+  }
+  ::std::size_t quotient = length / chunks;
+  ::std::size_t remainder = length % chunks;
+  workers->run(chunks, [&](::std::size_t chunk) {
+      ::std::size_t begin = chunk * quotient + ::std::min(chunk, remainder);
+      func(begin, begin + quotient + (chunk < remainder ? 1 : 0));
+    });
+}
+
+template < typename F >
+void forRange(Sequential, ::std::size_t length, const F &func) {
+  if (length > 0) {
+    func(0, length);
+  }
+}
+
+template < typename F >
+void forRange(Concurrent, ::std::size_t length, const F &func) {
+  forRange(length, func);
+}
+
+template < typename T >
+typename T::reference_iterator referenceAt(
+    const T &x, typename T::size_type index) {
+  typename T::small_size_storage position(x.dimension());
+  for (typename T::dim_type i = x.dimension(); i > 0; --i) {
+    position[i - 1] = index % x.size(i - 1);
+    index = index / x.size(i - 1);
+  }
+  return typename T::reference_iterator(x, position);
+}
+
+// Runs of the strided cursors are processed as plain pointer loops
+template < typename P, typename T, typename F >
+void forStrided(P policy, const T &x, const F &func) {
+  forRange(policy, x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      StridedCursor< T > x_cursor(x, begin);
+      while (begin < end) {
+        ::std::size_t n = ::std::min< ::std::size_t >(end - begin, x_cursor.run());
+        typename T::pointer x_pointer = x_cursor.data();
+        typename T::difference_type x_step = x_cursor.step();
+        if (x_step == 1) {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i]);
+          }
+        } else {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i * x_step]);
+          }
+        }
+        x_cursor.advance(n);
+        begin += n;
+      }
+    });
+}
+
+template < typename P, typename T1, typename T2, typename F >
+void forStrided(P policy, const T1 &x, const T2 &y, const F &func) {
+  forRange(policy, x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      StridedCursor< T1 > x_cursor(x, begin);
+      StridedCursor< T2 > y_cursor(y, begin);
+      while (begin < end) {
+        ::std::size_t n = ::std::min< ::std::size_t >(
+            end - begin, ::std::min< ::std::size_t >(
+                x_cursor.run(), y_cursor.run()));
+        typename T1::pointer x_pointer = x_cursor.data();
+        typename T1::difference_type x_step = x_cursor.step();
+        typename T2::pointer y_pointer = y_cursor.data();
+        typename T2::difference_type y_step = y_cursor.step();
+        if (x_step == 1 && y_step == 1) {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i], y_pointer[i]);
+          }
+        } else {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i * x_step], y_pointer[i * y_step]);
+          }
+        }
+        x_cursor.advance(n);
+        y_cursor.advance(n);
+        begin += n;
+      }
+    });
+}
+
+template < typename P, typename T1, typename T2, typename T3, typename F >
+void forStrided(P policy, const T1 &x, const T2 &y, const T3 &z,
+                const F &func) {
+  forRange(policy, x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      StridedCursor< T1 > x_cursor(x, begin);
+      StridedCursor< T2 > y_cursor(y, begin);
+      StridedCursor< T3 > z_cursor(z, begin);
+      while (begin < end) {
+        ::std::size_t n = ::std::min< ::std::size_t >(
+            end - begin, ::std::min< ::std::size_t >(
+                x_cursor.run(), ::std::min< ::std::size_t >(
+                    y_cursor.run(), z_cursor.run())));
+        typename T1::pointer x_pointer = x_cursor.data();
+        typename T1::difference_type x_step = x_cursor.step();
+        typename T2::pointer y_pointer = y_cursor.data();
+        typename T2::difference_type y_step = y_cursor.step();
+        typename T3::pointer z_pointer = z_cursor.data();
+        typename T3::difference_type z_step = z_cursor.step();
+        if (x_step == 1 && y_step == 1 && z_step == 1) {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i], y_pointer[i], z_pointer[i]);
+          }
+        } else {
+          for (::std::size_t i = 0; i < n; ++i) {
+            func(x_pointer[i * x_step], y_pointer[i * y_step],
+                 z_pointer[i * z_step]);
+          }
+        }
+        x_cursor.advance(n);
+        y_cursor.advance(n);
+        z_cursor.advance(n);
+        begin += n;
+      }
+    });
+}
+
+template < typename T, typename F >
+void forEach(Sequential, const T &x, const F &func) {
+  forStrided(sequential, x, func);
+}
+
+template < typename T1, typename T2, typename F >
+void forEach(Sequential, const T1 &x, const T2 &y, const F &func) {
+  forStrided(sequential, x, y, func);
+}
+
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(Sequential, const T1 &x, const T2 &y, const T3 &z,
+             const F &func) {
+  forStrided(sequential, x, y, z, func);
+}
+
+template < typename T, typename F >
+void forEach(Concurrent, const T &x, const F &func) {
+  forStrided(concurrent, x, func);
+}
+
+template < typename T1, typename T2, typename F >
+void forEach(Concurrent, const T1 &x, const T2 &y, const F &func) {
+  forStrided(concurrent, x, y, func);
+}
+
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(Concurrent, const T1 &x, const T2 &y, const T3 &z,
+             const F &func) {
+  forStrided(concurrent, x, y, z, func);
+}
+
+template < typename T, typename F >
+void forEach(const T &x, const F &func) {
+  forEach(concurrent, x, func);
+}
+
+template < typename T1, typename T2, typename F >
+void forEach(const T1 &x, const T2 &y, const F &func) {
+  forEach(concurrent, x, y, func);
+}
+
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(const T1 &x, const T2 &y, const T3 &z, const F &func) {
+  forEach(concurrent, x, y, z, func);
+}
+
+}  // namespace parallel
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_PARALLEL_INL_HPP_
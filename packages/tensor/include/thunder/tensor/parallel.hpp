@@ -0,0 +1,138 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_PARALLEL_HPP_
+#define THUNDER_TENSOR_PARALLEL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace thunder {
+namespace tensor {
+namespace parallel {
+
+// A fixed-size pool of worker threads. The calling thread of run() takes part
+// in the work, so a pool of n threads keeps n - 1 workers.
+class ThreadPool {
+ public:
+  explicit ThreadPool(::std::size_t threads = 1);
+  ~ThreadPool();
+
+  ::std::size_t threads() const;
+
+  // Execute task(0), ..., task(chunks - 1) and block until all are finished.
+  // Exceptions thrown by tasks are rethrown in the calling thread. Nested or
+  // concurrent calls execute serially in the calling thread.
+  void run(::std::size_t chunks,
+           const ::std::function< void(::std::size_t) > &task);
+
+ private:
+  ThreadPool(const ThreadPool &);
+  ThreadPool& operator=(const ThreadPool &);
+
+  void work();
+  void execute();
+
+  ::std::vector< ::std::thread > workers_;
+  ::std::mutex run_mutex_;
+  ::std::mutex mutex_;
+  ::std::condition_variable start_;
+  ::std::condition_variable finish_;
+  const ::std::function< void(::std::size_t) > *task_;
+  ::std::size_t chunks_;
+  ::std::size_t next_;
+  ::std::size_t done_;
+  ::std::size_t generation_;
+  bool stop_;
+  ::std::exception_ptr error_;
+};
+
+// Tags for user-supplied element functions, which are called either serially
+// in order, or concurrently from the pool in no particular order
+struct Sequential {};
+struct Concurrent {};
+const Sequential sequential = Sequential();
+const Concurrent concurrent = Concurrent();
+
+// Global pool used by the tensor kernels. Callers keep the returned pointer
+// while running tasks, so that setThreads() only replaces the global pool and
+// the previous one lives until its last run returns.
+::std::shared_ptr< ThreadPool > pool();
+
+// Number of threads used by the kernels. 0 resets to the default, which is
+// THUNDER_NUM_THREADS if set or the hardware concurrency otherwise.
+void setThreads(::std::size_t threads);
+::std::size_t getThreads();
+
+// Minimum number of elements per parallel chunk. Smaller tensors are
+// processed serially in the calling thread.
+void setGrain(::std::size_t grain);
+::std::size_t getGrain();
+
+// Split [0, length) into ranges of at least grain elements and call
+// func(begin, end) on each of them using the global pool
+template < typename F >
+void forRange(::std::size_t length, const F &func);
+template < typename F >
+void forRange(::std::size_t length, ::std::size_t grain, const F &func);
+template < typename F >
+void forRange(Sequential, ::std::size_t length, const F &func);
+template < typename F >
+void forRange(Concurrent, ::std::size_t length, const F &func);
+
+// Reference iterator pointing to the element at a linear index
+template < typename T >
+typename T::reference_iterator referenceAt(
+    const T &x, typename T::size_type index);
+
+// Elementwise traversal of 1, 2 or 3 tensors with the same length, in the
+// order of their reference iterators. The function receives references. The
+// tensors are walked in strided runs, and the default policy is concurrent.
+template < typename T, typename F >
+void forEach(const T &x, const F &func);
+template < typename T1, typename T2, typename F >
+void forEach(const T1 &x, const T2 &y, const F &func);
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(const T1 &x, const T2 &y, const T3 &z, const F &func);
+template < typename T, typename F >
+void forEach(Sequential, const T &x, const F &func);
+template < typename T1, typename T2, typename F >
+void forEach(Sequential, const T1 &x, const T2 &y, const F &func);
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(Sequential, const T1 &x, const T2 &y, const T3 &z,
+             const F &func);
+template < typename T, typename F >
+void forEach(Concurrent, const T &x, const F &func);
+template < typename T1, typename T2, typename F >
+void forEach(Concurrent, const T1 &x, const T2 &y, const F &func);
+template < typename T1, typename T2, typename T3, typename F >
+void forEach(Concurrent, const T1 &x, const T2 &y, const T3 &z,
+             const F &func);
+
+}  // namespace parallel
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_PARALLEL_HPP_
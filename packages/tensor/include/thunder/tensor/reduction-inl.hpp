@@ -0,0 +1,416 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_REDUCTION_INL_HPP_
+#define THUNDER_TENSOR_REDUCTION_INL_HPP_
+
+#include "thunder/tensor/reduction.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/strided.hpp"
+#include "thunder/tensor/strided-inl.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace reduction {
+
+template < typename T, typename F >
+void forBlocks(const T &x, typename T::dim_type d, const F &func) {
+  typedef typename T::size_type size_type;
+  typedef typename T::difference_type difference_type;
+  typedef typename T::pointer pointer;
+
+  // Collapse the kept dimensions, skipping singleton ones
+  ::std::vector< size_type > size;
+  ::std::vector< difference_type > stride;
+  for (typename T::dim_type i = 0; i < x.dimension(); ++i) {
+    size_type sz = x.size(i);
+    difference_type st = x.stride(i);
+    if (i == d || sz == 1) {
+      continue;
+    }
+    if (!size.empty() && stride.back() ==
+        st * static_cast< difference_type >(sz)) {
+      size.back() *= sz;
+      stride.back() = st;
+    } else {
+      size.push_back(sz);
+      stride.push_back(st);
+    }
+  }
+
+  // The innermost kept dimension gives the lanes of a block
+  size_type lanes = 1;
+  difference_type lane_step = 0;
+  if (!size.empty()) {
+    lanes = size.back();
+    lane_step = stride.back();
+    size.pop_back();
+    stride.pop_back();
+  }
+  size_type outer = 1;
+  for (size_type i = 0; i < size.size(); ++i) {
+    outer *= size[i];
+  }
+  size_type x_length = x.size(d);
+  bool line = lanes == 1 ||
+      ::std::abs(x.stride(d)) <= ::std::abs(lane_step);
+
+  // Narrow the blocks down to 16 lanes when there are few of them, so that
+  // all threads get some work
+  size_type width = ::std::min< size_type >(block, lanes);
+  size_type tasks = parallel::getThreads() * 4;
+  while (width > 16 && outer * ((lanes + width - 1) / width) < tasks) {
+    width /= 2;
+  }
+  size_type blocks = (lanes + width - 1) / width;
+  size_type grain = parallel::getGrain() / (width * x_length) + 1;
+
+  pointer x_data = x.data();
+  parallel::forRange(
+      outer * blocks, grain, [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t task = begin; task < end; ++task) {
+          size_type o = task / blocks;
+          size_type lane_begin = (task % blocks) * width;
+          size_type index = o * lanes + lane_begin;
+          pointer x_pointer = x_data +
+              static_cast< difference_type >(lane_begin) * lane_step;
+          for (size_type i = size.size(); i > 0; --i) {
+            x_pointer += static_cast< difference_type >(o % size[i - 1]) *
+                stride[i - 1];
+            o /= size[i - 1];
+          }
+          func(index, x_pointer, ::std::min(width, lanes - lane_begin),
+               lane_step, line);
+        }
+      });
+}
+
+template < typename A, typename T, typename I, typename U, typename F >
+void reduce(const T &x, typename T::dim_type d, const I &init,
+            const U &update, const F &finish) {
+  typedef typename T::size_type size_type;
+  typedef typename T::difference_type difference_type;
+  typedef typename T::pointer pointer;
+  size_type x_length = x.size(d);
+  difference_type x_step = x.stride(d);
+  forBlocks(x, d, [&](size_type index, pointer x_pointer, size_type n,
+                      difference_type lane_step, bool line) {
+      if (line) {
+        for (size_type j = 0; j < n; ++j) {
+          A value = init(index + j);
+          pointer line_pointer = x_pointer +
+              static_cast< difference_type >(j) * lane_step;
+          for (size_type k = 0; k < x_length; ++k) {
+            update(value, line_pointer[
+                static_cast< difference_type >(k) * x_step], k);
+          }
+          finish(index + j, value);
+        }
+        return;
+      }
+      A acc[block];
+      for (size_type j = 0; j < n; ++j) {
+        acc[j] = init(index + j);
+      }
+      for (size_type k = 0; k < x_length; ++k) {
+        pointer row_pointer = x_pointer +
+            static_cast< difference_type >(k) * x_step;
+        if (lane_step == 1) {
+          for (size_type j = 0; j < n; ++j) {
+            update(acc[j], row_pointer[j], k);
+          }
+        } else {
+          for (size_type j = 0; j < n; ++j) {
+            update(acc[j], row_pointer[
+                static_cast< difference_type >(j) * lane_step], k);
+          }
+        }
+      }
+      for (size_type j = 0; j < n; ++j) {
+        finish(index + j, acc[j]);
+      }
+    });
+}
+
+template < typename T, typename F >
+void moments(const T &x, const F &finish) {
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+  size_type length = x.length();
+  size_type chunks = (length + chunk - 1) / chunk;
+  ::std::vector< value_type > mean(chunks), m2(chunks);
+  parallel::forRange(chunks, 1, [&](::std::size_t begin, ::std::size_t end) {
+      for (::std::size_t c = begin; c < end; ++c) {
+        size_type n = ::std::min(chunk, length - c * chunk);
+        value_type sum_value = 0;
+        StridedCursor< T > x_cursor(x, c * chunk);
+        for (size_type i = 0; i < n;) {
+          size_type run = ::std::min(n - i, x_cursor.run());
+          typename T::pointer x_pointer = x_cursor.data();
+          typename T::difference_type x_step = x_cursor.step();
+          for (size_type j = 0; j < run; ++j) {
+            sum_value += x_pointer[j * x_step];
+          }
+          x_cursor.advance(run);
+          i += run;
+        }
+        mean[c] = sum_value / static_cast< value_type >(n);
+        m2[c] = 0;
+        x_cursor = StridedCursor< T >(x, c * chunk);
+        for (size_type i = 0; i < n;) {
+          size_type run = ::std::min(n - i, x_cursor.run());
+          typename T::pointer x_pointer = x_cursor.data();
+          typename T::difference_type x_step = x_cursor.step();
+          for (size_type j = 0; j < run; ++j) {
+            m2[c] += conjugateProduct(x_pointer[j * x_step] - mean[c],
+                                      x_pointer[j * x_step] - mean[c]);
+          }
+          x_cursor.advance(run);
+          i += run;
+        }
+      }
+    });
+  value_type mean_value = 0;
+  value_type m2_value = 0;
+  for (size_type c = 0; c < chunks; ++c) {
+    merge(c * chunk, &mean_value, &m2_value,
+          ::std::min(chunk, length - c * chunk), mean[c], m2[c]);
+  }
+  finish(mean_value, m2_value);
+}
+
+template < typename T, typename F >
+void moments(const T &x, typename T::dim_type d, const F &finish) {
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+  typedef typename T::difference_type difference_type;
+  typedef typename T::pointer pointer;
+  size_type x_length = x.size(d);
+  difference_type x_step = x.stride(d);
+  forBlocks(x, d, [&](size_type index, pointer x_pointer, size_type n,
+                      difference_type lane_step, bool line) {
+      if (line) {
+        for (size_type j = 0; j < n; ++j) {
+          pointer line_pointer = x_pointer +
+              static_cast< difference_type >(j) * lane_step;
+          value_type mean_value = 0;
+          value_type m2_value = 0;
+          for (size_type k = 0; k < x_length; k += segment) {
+            size_type m = ::std::min(segment, x_length - k);
+            pointer segment_pointer = line_pointer +
+                static_cast< difference_type >(k) * x_step;
+            value_type sum_value = 0;
+            for (size_type i = 0; i < m; ++i) {
+              sum_value += segment_pointer[
+                  static_cast< difference_type >(i) * x_step];
+            }
+            value_type segment_mean = sum_value / static_cast< value_type >(m);
+            value_type segment_m2 = 0;
+            for (size_type i = 0; i < m; ++i) {
+              value_type deviation = segment_pointer[
+                  static_cast< difference_type >(i) * x_step] - segment_mean;
+              segment_m2 += conjugateProduct(deviation, deviation);
+            }
+            merge(k, &mean_value, &m2_value, m, segment_mean, segment_m2);
+          }
+          finish(index + j, mean_value, m2_value);
+        }
+        return;
+      }
+      value_type mean[block], m2[block], segment_mean[block], segment_m2[block];
+      for (size_type k = 0; k < x_length; k += segment) {
+        size_type m = ::std::min(segment, x_length - k);
+        for (size_type j = 0; j < n; ++j) {
+          segment_mean[j] = 0;
+          segment_m2[j] = 0;
+        }
+        for (size_type i = k; i < k + m; ++i) {
+          pointer row_pointer = x_pointer +
+              static_cast< difference_type >(i) * x_step;
+          if (lane_step == 1) {
+            for (size_type j = 0; j < n; ++j) {
+              segment_mean[j] += row_pointer[j];
+            }
+          } else {
+            for (size_type j = 0; j < n; ++j) {
+              segment_mean[j] += row_pointer[
+                  static_cast< difference_type >(j) * lane_step];
+            }
+          }
+        }
+        for (size_type j = 0; j < n; ++j) {
+          segment_mean[j] /= static_cast< value_type >(m);
+        }
+        for (size_type i = k; i < k + m; ++i) {
+          pointer row_pointer = x_pointer +
+              static_cast< difference_type >(i) * x_step;
+          if (lane_step == 1) {
+            for (size_type j = 0; j < n; ++j) {
+              value_type deviation = row_pointer[j] - segment_mean[j];
+              segment_m2[j] += conjugateProduct(deviation, deviation);
+            }
+          } else {
+            for (size_type j = 0; j < n; ++j) {
+              value_type deviation = row_pointer[
+                  static_cast< difference_type >(j) * lane_step] -
+                  segment_mean[j];
+              segment_m2[j] += conjugateProduct(deviation, deviation);
+            }
+          }
+        }
+        for (size_type j = 0; j < n; ++j) {
+          merge(k, &mean[j], &m2[j], m, segment_mean[j], segment_m2[j]);
+        }
+      }
+      for (size_type j = 0; j < n; ++j) {
+        finish(index + j, mean[j], m2[j]);
+      }
+    });
+}
+
+template < typename T, typename F >
+void forChunks(const T &x, const F &func) {
+  typedef typename T::value_type value_type;
+  typedef typename T::size_type size_type;
+  size_type length = x.length();
+  size_type chunks = (length + chunk - 1) / chunk;
+  parallel::forRange(chunks, 1, [&](::std::size_t begin, ::std::size_t end) {
+      ::std::vector< value_type > buffer;
+      for (::std::size_t c = begin; c < end; ++c) {
+        size_type n = ::std::min(chunk, length - c * chunk);
+        StridedCursor< T > x_cursor(x, c * chunk);
+        if (x_cursor.step() == 1 && x_cursor.run() >= n) {
+          func(c, static_cast< const value_type* >(x_cursor.data()), n);
+          continue;
+        }
+        buffer.resize(n);
+        for (size_type i = 0; i < n;) {
+          size_type run = ::std::min(n - i, x_cursor.run());
+          typename T::pointer x_pointer = x_cursor.data();
+          typename T::difference_type x_step = x_cursor.step();
+          for (size_type j = 0; j < run; ++j, ++i) {
+            buffer[i] = x_pointer[j * x_step];
+          }
+          x_cursor.advance(run);
+        }
+        func(c, static_cast< const value_type* >(buffer.data()), n);
+      }
+    });
+}
+
+// Leaves of up to 16 rows are added row by row into independent
+// accumulators, which are then added pairwise
+template < typename D >
+D pairwiseSum(const D *x, ::std::size_t n) {
+  if (n > 16 * accumulators) {
+    ::std::size_t half = n / (2 * accumulators) * accumulators;
+    return pairwiseSum(x, half) + pairwiseSum(x + half, n - half);
+  }
+  D lane[accumulators];
+  for (::std::size_t l = 0; l < accumulators; ++l) {
+    lane[l] = 0;
+  }
+  ::std::size_t i = 0;
+  for (; i + accumulators <= n; i += accumulators) {
+    for (::std::size_t l = 0; l < accumulators; ++l) {
+      lane[l] += x[i + l];
+    }
+  }
+  for (::std::size_t l = 0; i < n; ++i, ++l) {
+    lane[l] += x[i];
+  }
+  for (::std::size_t width = accumulators / 2; width > 0; width /= 2) {
+    for (::std::size_t l = 0; l < width; ++l) {
+      lane[l] += lane[l + width];
+    }
+  }
+  return lane[0];
+}
+
+template < typename D >
+void kahanSum(const D *x, ::std::size_t n, D *sum, D *compensation) {
+  D lane[accumulators], lane_compensation[accumulators];
+  for (::std::size_t l = 0; l < accumulators; ++l) {
+    lane[l] = 0;
+    lane_compensation[l] = 0;
+  }
+  ::std::size_t i = 0;
+  for (; i + accumulators <= n; i += accumulators) {
+    for (::std::size_t l = 0; l < accumulators; ++l) {
+      D y = x[i + l] - lane_compensation[l];
+      D t = lane[l] + y;
+      lane_compensation[l] = (t - lane[l]) - y;
+      lane[l] = t;
+    }
+  }
+  for (::std::size_t l = 0; i < n; ++i, ++l) {
+    D y = x[i] - lane_compensation[l];
+    D t = lane[l] + y;
+    lane_compensation[l] = (t - lane[l]) - y;
+    lane[l] = t;
+  }
+  // The accumulators and their compensations are added to the running sum
+  for (::std::size_t l = 0; l < 2 * accumulators; ++l) {
+    D y = (l < accumulators ? lane[l] : -lane_compensation[l - accumulators]) -
+        *compensation;
+    D t = *sum + y;
+    *compensation = (t - *sum) - y;
+    *sum = t;
+  }
+}
+
+template < typename D >
+D conjugateProduct(const D &a, const D &b) {
+  return a * b;
+}
+
+template < typename D >
+::std::complex< D > conjugateProduct(
+    const ::std::complex< D > &a, const ::std::complex< D > &b) {
+  return a * ::std::conj(b);
+}
+
+template < typename D >
+void merge(::std::size_t count, D *mean, D *m2, ::std::size_t n,
+           const D &mean_n, const D &m2_n) {
+  if (count == 0) {
+    *mean = mean_n;
+    *m2 = m2_n;
+    return;
+  }
+  D delta = mean_n - *mean;
+  D ratio = static_cast< D >(n) / static_cast< D >(count + n);
+  *mean += delta * ratio;
+  *m2 += m2_n + conjugateProduct(delta, delta) * static_cast< D >(count) *
+      ratio;
+}
+
+}  // namespace reduction
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_REDUCTION_INL_HPP_
@@ -0,0 +1,106 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_REDUCTION_HPP_
+#define THUNDER_TENSOR_REDUCTION_HPP_
+
+#include <complex>
+#include <cstddef>
+
+namespace thunder {
+namespace tensor {
+namespace reduction {
+
+// Summation orders for sum and mean over a whole tensor. SEQUENTIAL adds the
+// elements one by one. PAIRWISE adds them in a tree with independent lanes at
+// the leaves, and KAHAN carries a compensation term in each lane. Both split
+// the tensor into chunks that are summed concurrently and then combined in a
+// fixed order, so the result does not depend on the number of threads.
+enum Summation { SEQUENTIAL, PAIRWISE, KAHAN };
+
+// Number of independent accumulators of the pairwise and compensated sums
+const ::std::size_t accumulators = 8;
+
+// Largest number of outputs reduced together by a task
+const ::std::size_t block = 256;
+
+// Number of elements that moments() reduces in two passes while in cache,
+// along a dimension or over a whole tensor
+const ::std::size_t segment = 128;
+const ::std::size_t chunk = 16384;
+
+// Walk the outputs of a reduction of x along dimension d in blocks. Outputs
+// are identified by their linear index in the contiguous shape of x with
+// dimension d removed. For each block, func(index, pointer, n, step, line) is
+// called concurrently, where the line of output index + j starts at
+// pointer + j * step for j < n. Line is true when the reduced dimension has
+// the smallest stride, and the lines should be reduced one at a time.
+// Otherwise the block should be updated one row at a time, so that the inner
+// loop runs over the contiguous output dimension.
+template < typename T, typename F >
+void forBlocks(const T &x, typename T::dim_type d, const F &func);
+
+// Reduce x along dimension d. For each output i, the accumulator is set by
+// acc = init(i), then updated by update(acc, value, k) for
+// k = 0, ..., x.size(d) - 1 in order, and passed to finish(i, acc).
+template < typename A, typename T, typename I, typename U, typename F >
+void reduce(const T &x, typename T::dim_type d, const I &init,
+            const U &update, const F &finish);
+
+// Mean and sum of squared deviations of x, or of its lines along dimension
+// d, passed to finish(mean, m2) or finish(i, mean, m2). Segments are reduced
+// in two passes while in cache and merged by the formula of Chan et al., so
+// that x is read from memory once.
+template < typename T, typename F >
+void moments(const T &x, const F &finish);
+template < typename T, typename F >
+void moments(const T &x, typename T::dim_type d, const F &finish);
+
+// Call func(c, pointer, n) concurrently on each chunk c of x, where pointer
+// gives the n elements of the chunk contiguously. Elements of non-contiguous
+// chunks are gathered in a buffer.
+template < typename T, typename F >
+void forChunks(const T &x, const F &func);
+
+// Pairwise sum of n contiguous elements
+template < typename D >
+D pairwiseSum(const D *x, ::std::size_t n);
+
+// Add n contiguous elements to a compensated sum, whose value is
+// *sum - *compensation
+template < typename D >
+void kahanSum(const D *x, ::std::size_t n, D *sum, D *compensation);
+
+// A deviation times the conjugate of another, for real or complex numbers
+template < typename D >
+D conjugateProduct(const D &a, const D &b);
+template < typename D >
+::std::complex< D > conjugateProduct(
+    const ::std::complex< D > &a, const ::std::complex< D > &b);
+
+// Merge the moments of n more elements into those of count elements
+template < typename D >
+void merge(::std::size_t count, D *mean, D *m2, ::std::size_t n,
+           const D &mean_n, const D &m2_n);
+
+}  // namespace reduction
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_REDUCTION_HPP_
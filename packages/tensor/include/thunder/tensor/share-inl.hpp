@@ -0,0 +1,81 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_SHARE_INL_HPP_
+#define THUNDER_TENSOR_SHARE_INL_HPP_
+
+#include "thunder/tensor/share.hpp"
+
+#include <memory>
+#include <type_traits>
+
+namespace thunder {
+namespace tensor {
+namespace share {
+
+template < typename S >
+::std::shared_ptr< S > lazy(const ::std::shared_ptr< S > &s,
+                            ::std::true_type) {
+  return ::std::make_shared< S >(s->share());
+}
+
+template < typename S >
+::std::shared_ptr< S > lazy(const ::std::shared_ptr< S > &,
+                            ::std::false_type) {
+  return ::std::shared_ptr< S >();
+}
+
+template < typename S >
+::std::shared_ptr< S > lazy(const ::std::shared_ptr< S > &s) {
+  return lazy(s, Shareable< S >());
+}
+
+template < typename S >
+void detach(const ::std::shared_ptr< S > &s, ::std::true_type) {
+  s->detach();
+}
+
+template < typename S >
+void detach(const ::std::shared_ptr< S > &, ::std::false_type) {}
+
+template < typename S >
+void detach(const ::std::shared_ptr< S > &s) {
+  detach(s, Detachable< S >());
+}
+
+template < typename S >
+bool isShared(const ::std::shared_ptr< S > &s, ::std::true_type) {
+  return s->isShared();
+}
+
+template < typename S >
+bool isShared(const ::std::shared_ptr< S > &, ::std::false_type) {
+  return false;
+}
+
+template < typename S >
+bool isShared(const ::std::shared_ptr< S > &s) {
+  return isShared(s, Shareable< S >());
+}
+
+}  // namespace share
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_SHARE_INL_HPP_
@@ -0,0 +1,69 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_SHARE_HPP_
+#define THUNDER_TENSOR_SHARE_HPP_
+
+#include <memory>
+#include <type_traits>
+
+#include "thunder/storage.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace share {
+
+// Copy-on-write clones. When enabled, clone() of a tensor that spans its
+// whole storage shares data with the source, and the first mutation through
+// either of them copies it. Mutating methods detach automatically, but writes
+// through data(), get(), operator() or reference iterators must be preceded
+// by detach(). It is disabled by default.
+void setCopyOnWrite(bool enabled);
+bool getCopyOnWrite();
+
+// Whether storage objects of type S can share data
+template < typename S >
+struct Shareable : public ::std::false_type {};
+template < typename D, typename A >
+struct Shareable< storage::Storage< D, A > > : public ::std::true_type {};
+
+// Whether storage objects of type S may need a copy before mutation, which
+// is the case for shared data and read-only file mappings
+template < typename S >
+struct Detachable : public Shareable< S > {};
+template < typename D >
+struct Detachable< storage::MappedStorage< D > > : public ::std::true_type {};
+
+// New storage sharing data with s, or null if S is not shareable
+template < typename S >
+::std::shared_ptr< S > lazy(const ::std::shared_ptr< S > &s);
+
+// Copy data that s shares with other storages or maps read-only
+template < typename S >
+void detach(const ::std::shared_ptr< S > &s);
+
+// Check whether s shares data with other storages
+template < typename S >
+bool isShared(const ::std::shared_ptr< S > &s);
+
+}  // namespace share
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_SHARE_HPP_
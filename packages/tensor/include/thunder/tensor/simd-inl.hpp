@@ -0,0 +1,348 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_SIMD_INL_HPP_
+#define THUNDER_TENSOR_SIMD_INL_HPP_
+
+#include "thunder/tensor/simd.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+
+// Whether the elements of x are contiguous with unit stride
+template < typename T >
+bool isDense(const T &x) {
+  return x.partialContiguity(0, x.dimension() - 1) &&
+      (x.length() <= 1 || x.stride(x.dimension() - 1) == 1);
+}
+
+// Complex tensors run the kernels on their real and imaginary parts
+template < typename T >
+bool complexBinary(Operation, const T &, const T *,
+                   typename T::const_reference, ::std::false_type) {
+  return false;
+}
+template < typename T >
+bool complexBinary(Operation op, const T &x, const T *y,
+                   typename T::const_reference y_value, ::std::true_type) {
+  typedef typename T::value_type::value_type D;
+  if ((op != ADD && op != SUB && op != MUL && op != DIV) || !isDense(x) ||
+      (y != nullptr && !isDense(*y))) {
+    return false;
+  }
+  D *x_pointer = reinterpret_cast< D* >(x.data());
+  const D *y_pointer =
+      y == nullptr ? nullptr : reinterpret_cast< const D* >(y->data());
+  D y_real = y_value.real(), y_imag = y_value.imag();
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      complexBinary(op, x_pointer + 2 * begin,
+                    y_pointer == nullptr ? nullptr : y_pointer + 2 * begin,
+                    y_real, y_imag, end - begin);
+    });
+  return true;
+}
+
+template < typename T >
+bool complexFma(const T &, const T *, typename T::const_reference,
+                const T *, typename T::const_reference, ::std::false_type) {
+  return false;
+}
+template < typename T >
+bool complexFma(const T &x, const T *y, typename T::const_reference y_value,
+                const T *z, typename T::const_reference z_value,
+                ::std::true_type) {
+  typedef typename T::value_type::value_type D;
+  if (!isDense(x) || (y != nullptr && !isDense(*y)) ||
+      (z != nullptr && !isDense(*z))) {
+    return false;
+  }
+  D *x_pointer = reinterpret_cast< D* >(x.data());
+  const D *y_pointer =
+      y == nullptr ? nullptr : reinterpret_cast< const D* >(y->data());
+  const D *z_pointer =
+      z == nullptr ? nullptr : reinterpret_cast< const D* >(z->data());
+  D y_real = y_value.real(), y_imag = y_value.imag();
+  D z_real = z_value.real(), z_imag = z_value.imag();
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      complexFma(x_pointer + 2 * begin,
+                 y_pointer == nullptr ? nullptr : y_pointer + 2 * begin,
+                 y_real, y_imag,
+                 z_pointer == nullptr ? nullptr : z_pointer + 2 * begin,
+                 z_real, z_imag, end - begin);
+    });
+  return true;
+}
+
+template < typename T >
+bool binary(Operation op, const T &x, typename T::const_reference y,
+            ::std::false_type) {
+  return complexBinary(op, x, static_cast< const T* >(nullptr), y,
+                       ComplexVectorizable< typename T::value_type >());
+}
+template < typename T >
+bool binary(Operation op, const T &x, typename T::const_reference y,
+            ::std::true_type) {
+  if (!isDense(x)) {
+    return false;
+  }
+  typename T::pointer x_pointer = x.data();
+  typename T::value_type y_value = y;
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      binary(op, x_pointer + begin, y_value, end - begin);
+    });
+  return true;
+}
+template < typename T >
+bool binary(Operation op, const T &x, typename T::const_reference y) {
+  return binary(op, x, y, Vectorizable< typename T::value_type >());
+}
+
+template < typename T >
+bool binary(Operation op, const T &x, const T &y, ::std::false_type) {
+  return complexBinary(op, x, &y, typename T::value_type(),
+                       ComplexVectorizable< typename T::value_type >());
+}
+template < typename T >
+bool binary(Operation op, const T &x, const T &y, ::std::true_type) {
+  if (!isDense(x) || !isDense(y)) {
+    return false;
+  }
+  typename T::pointer x_pointer = x.data();
+  typename T::pointer y_pointer = y.data();
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      binary(op, x_pointer + begin, y_pointer + begin, end - begin);
+    });
+  return true;
+}
+template < typename T >
+bool binary(Operation op, const T &x, const T &y) {
+  return binary(op, x, y, Vectorizable< typename T::value_type >());
+}
+
+// The fma kernels take null pointers for scalar arguments
+template < typename T >
+bool fma(const T &x, const T *y, typename T::const_reference y_value,
+         const T *z, typename T::const_reference z_value, ::std::false_type) {
+  return complexFma(x, y, y_value, z, z_value,
+                    ComplexVectorizable< typename T::value_type >());
+}
+template < typename T >
+bool fma(const T &x, const T *y, typename T::const_reference y_value,
+         const T *z, typename T::const_reference z_value, ::std::true_type) {
+  if (!isDense(x) || (y != nullptr && !isDense(*y)) ||
+      (z != nullptr && !isDense(*z))) {
+    return false;
+  }
+  typename T::pointer x_pointer = x.data();
+  typename T::pointer y_pointer = y == nullptr ? nullptr : y->data();
+  typename T::pointer z_pointer = z == nullptr ? nullptr : z->data();
+  typename T::value_type y_scalar = y_value;
+  typename T::value_type z_scalar = z_value;
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      fma(x_pointer + begin, y_pointer == nullptr ? nullptr : y_pointer + begin,
+          y_scalar, z_pointer == nullptr ? nullptr : z_pointer + begin,
+          z_scalar, end - begin);
+    });
+  return true;
+}
+
+template < typename T >
+bool fma(const T &x, typename T::const_reference y,
+         typename T::const_reference z) {
+  return fma(x, static_cast< const T* >(nullptr), y,
+             static_cast< const T* >(nullptr), z,
+             Vectorizable< typename T::value_type >());
+}
+template < typename T >
+bool fma(const T &x, const T &y, typename T::const_reference z) {
+  return fma(x, &y, typename T::value_type(), static_cast< const T* >(nullptr),
+             z, Vectorizable< typename T::value_type >());
+}
+template < typename T >
+bool fma(const T &x, typename T::const_reference y, const T &z) {
+  return fma(x, static_cast< const T* >(nullptr), y, &z,
+             typename T::value_type(),
+             Vectorizable< typename T::value_type >());
+}
+template < typename T >
+bool fma(const T &x, const T &y, const T &z) {
+  return fma(x, &y, typename T::value_type(), &z, typename T::value_type(),
+             Vectorizable< typename T::value_type >());
+}
+
+template < typename T >
+bool conj(const T &, ::std::false_type) {
+  return false;
+}
+template < typename T >
+bool conj(const T &x, ::std::true_type) {
+  typedef typename T::value_type::value_type D;
+  if (!isDense(x)) {
+    return false;
+  }
+  D *x_pointer = reinterpret_cast< D* >(x.data());
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      complexConj(x_pointer + 2 * begin, end - begin);
+    });
+  return true;
+}
+template < typename T >
+bool conj(const T &x) {
+  return conj(x, ComplexVectorizable< typename T::value_type >());
+}
+
+template < typename T >
+bool cnrm(const T &, ::std::false_type) {
+  return false;
+}
+template < typename T >
+bool cnrm(const T &x, ::std::true_type) {
+  typedef typename T::value_type::value_type D;
+  if (!isDense(x)) {
+    return false;
+  }
+  D *x_pointer = reinterpret_cast< D* >(x.data());
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      complexCnrm(x_pointer + 2 * begin, end - begin);
+    });
+  return true;
+}
+template < typename T >
+bool cnrm(const T &x) {
+  return cnrm(x, ComplexVectorizable< typename T::value_type >());
+}
+
+template < typename T >
+bool unary(Function, const T &, ::std::false_type) {
+  return false;
+}
+template < typename T >
+bool unary(Function f, const T &x, ::std::true_type) {
+  typedef typename T::value_type D;
+  if (!isDense(x)) {
+    return false;
+  }
+  D *x_pointer = x.data();
+  parallel::forRange(x.length(), [&](::std::size_t begin, ::std::size_t end) {
+      unary(f, x_pointer + begin, end - begin);
+    });
+  return true;
+}
+template < typename T >
+bool unary(Function f, const T &x) {
+  return unary(f, x, Vectorizable< typename T::value_type >());
+}
+
+// Blocks of other value types are transposed element by element
+template < typename D1, typename D2 >
+void transpose(D1 *x, ::std::ptrdiff_t x_stride, const D2 *y,
+               ::std::ptrdiff_t y_stride, ::std::size_t m, ::std::size_t n) {
+  for (::std::size_t i = 0; i < m; ++i) {
+    for (::std::size_t j = 0; j < n; ++j) {
+      x[i * x_stride + j] = static_cast< D1 >(y[j * y_stride + i]);
+    }
+  }
+}
+
+// Edge of the square blocks copied by each task
+const ::std::size_t block = 128;
+
+template < typename T1, typename T2 >
+bool transpose(const T1 &x, const T2 &y) {
+  typedef typename T1::dim_type dim_type;
+  typedef typename T1::size_type size_type;
+  typedef typename T1::difference_type difference_type;
+  if (!x.isSameSizeAs(y)) {
+    return false;
+  }
+  // Elements are contiguous along dimension a of x and dimension b of y
+  dim_type dimension = x.dimension();
+  dim_type a = dimension, b = dimension;
+  for (dim_type i = 0; i < dimension; ++i) {
+    if (a == dimension && x.size(i) > 1 && x.stride(i) == 1) {
+      a = i;
+    }
+    if (b == dimension && y.size(i) > 1 && y.stride(i) == 1) {
+      b = i;
+    }
+  }
+  if (a == dimension || b == dimension || a == b) {
+    return false;
+  }
+
+  // Remaining dimensions index the planes of blocks
+  typename T1::small_size_storage outer_size(dimension - 2);
+  typename T1::small_stride_storage x_outer(dimension - 2);
+  typename T1::small_stride_storage y_outer(dimension - 2);
+  size_type planes = 1;
+  for (dim_type i = 0, k = 0; i < dimension; ++i) {
+    if (i != a && i != b) {
+      outer_size[k] = x.size(i);
+      x_outer[k] = x.stride(i);
+      y_outer[k] = static_cast< difference_type >(y.stride(i));
+      planes = planes * x.size(i);
+      ++k;
+    }
+  }
+  size_type m = x.size(b);
+  size_type n = x.size(a);
+  size_type m_blocks = (m + block - 1) / block;
+  size_type n_blocks = (n + block - 1) / block;
+  difference_type x_stride = x.stride(b);
+  difference_type y_stride = static_cast< difference_type >(y.stride(a));
+  typename T1::pointer x_pointer = x.data();
+  typename T2::pointer y_pointer = y.data();
+  // Blocks are smaller than square along narrow dimensions such as channels
+  size_type area = ::std::min(block, m) * ::std::min(block, n);
+  parallel::forRange(
+      planes * m_blocks * n_blocks, parallel::getGrain() / area + 1,
+      [&](::std::size_t begin, ::std::size_t end) {
+        for (::std::size_t task = begin; task < end; ++task) {
+          size_type plane = task / (m_blocks * n_blocks);
+          size_type i = task / n_blocks % m_blocks * block;
+          size_type j = task % n_blocks * block;
+          difference_type x_offset = 0, y_offset = 0;
+          for (dim_type k = outer_size.size(); k > 0; --k) {
+            size_type index = plane % outer_size[k - 1];
+            plane = plane / outer_size[k - 1];
+            x_offset += index * x_outer[k - 1];
+            y_offset += index * y_outer[k - 1];
+          }
+          transpose(x_pointer + x_offset + i * x_stride + j, x_stride,
+                    y_pointer + y_offset + j * y_stride + i, y_stride,
+                    ::std::min(block, m - i), ::std::min(block, n - j));
+        }
+      });
+  return true;
+}
+
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_SIMD_INL_HPP_
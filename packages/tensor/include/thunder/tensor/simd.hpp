@@ -0,0 +1,240 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_SIMD_HPP_
+#define THUNDER_TENSOR_SIMD_HPP_
+
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+
+// Elementwise operations with vectorized kernels. Comparisons store 1 or 0.
+enum Operation {
+  ADD, SUB, MUL, DIV, FMAX, FMIN, ISGREATER, ISGREATEREQUAL, ISLESS,
+  ISLESSEQUAL, ISLESSGREATER, ISUNORDERED
+};
+
+// Elementary functions with vectorized kernels
+enum Function { EXP, LOG, SQRT, SIN, COS, TANH, ERF };
+
+// Instruction sets in increasing order of preference
+enum Instruction { SCALAR, SSE2, AVX2, AVX512 };
+
+// Best instruction set supported by both the build and the processor
+Instruction detect();
+
+// Instruction set used by the kernels. Requests above detect() are clamped.
+void setInstruction(Instruction instruction);
+Instruction getInstruction();
+
+// Value types with vectorized kernels
+template < typename D >
+struct Vectorizable : public ::std::false_type {};
+template < >
+struct Vectorizable< double > : public ::std::true_type {};
+template < >
+struct Vectorizable< float > : public ::std::true_type {};
+template < typename D >
+struct ComplexVectorizable : public ::std::false_type {};
+template < >
+struct ComplexVectorizable< ::std::complex< double > >
+    : public ::std::true_type {};
+template < >
+struct ComplexVectorizable< ::std::complex< float > >
+    : public ::std::true_type {};
+
+// Complex products and quotients recover infinities from NaN results as C99
+// Annex G specifies. Fast complex math skips those checks, as well as the
+// scaling that keeps quotients from overflowing or underflowing early.
+void setFastComplex(bool fast);
+bool getFastComplex();
+
+// Elementary functions have these largest errors in units in the last place
+// of the exact result, measured over random arguments on all instruction sets:
+//
+//          EXP   LOG   SQRT  SIN   COS   TANH  ERF
+//   double 0.85  0.82  0.5   0.77  0.77  1.27  2.96
+//   float  0.88  0.82  0.5   1.5   1.53  1.26  2.49
+//
+// Arguments the approximations do not cover, such as NaN, infinities,
+// subnormal and non-positive values for LOG, and huge values or near
+// multiples of pi / 2 for SIN and COS, are passed to the C library. Fast math
+// evaluates EXP without a division within 2.47 units for double and 1.17 for
+// float, which puts TANH within 1.61 and 1.33 units. It also lets SIN and COS
+// lose relative accuracy near multiples of pi / 2 instead of passing them on,
+// keeping their absolute error within the bounds above.
+void setFastMath(bool fast);
+bool getFastMath();
+
+// Kernels over contiguous arrays: x[i] = op(x[i], y[i]) or op(x[i], y), and
+// x[i] = fma(x[i], y[i], z[i]) where a null y or z uses y_value or z_value.
+void binary(Operation op, double *x, const double *y, ::std::size_t n);
+void binary(Operation op, double *x, double y, ::std::size_t n);
+void binary(Operation op, float *x, const float *y, ::std::size_t n);
+void binary(Operation op, float *x, float y, ::std::size_t n);
+void fma(double *x, const double *y, double y_value, const double *z,
+         double z_value, ::std::size_t n);
+void fma(float *x, const float *y, float y_value, const float *z,
+         float z_value, ::std::size_t n);
+
+// Kernels over n complex numbers stored as interleaved real and imaginary
+// parts: x[i] = op(x[i], y[i]) for op in ADD, SUB, MUL and DIV, x[i] =
+// x[i] * y[i] + z[i], x[i] = conj(x[i]) and x[i] = norm(x[i]), where a null y
+// or z uses the real and imaginary values given.
+void complexBinary(Operation op, double *x, const double *y, double y_real,
+                   double y_imag, ::std::size_t n);
+void complexBinary(Operation op, float *x, const float *y, float y_real,
+                   float y_imag, ::std::size_t n);
+void complexFma(double *x, const double *y, double y_real, double y_imag,
+                const double *z, double z_real, double z_imag,
+                ::std::size_t n);
+void complexFma(float *x, const float *y, float y_real, float y_imag,
+                const float *z, float z_real, float z_imag, ::std::size_t n);
+void complexConj(double *x, ::std::size_t n);
+void complexConj(float *x, ::std::size_t n);
+void complexCnrm(double *x, ::std::size_t n);
+void complexCnrm(float *x, ::std::size_t n);
+
+// Kernels over contiguous arrays: x[i] = f(x[i])
+void unary(Function f, double *x, ::std::size_t n);
+void unary(Function f, float *x, ::std::size_t n);
+
+// Kernels over 2-d blocks: x[i * x_stride + j] = y[j * y_stride + i] for
+// i < m and j < n. Tiles are transposed in registers.
+void transpose(double *x, ::std::ptrdiff_t x_stride, const double *y,
+               ::std::ptrdiff_t y_stride, ::std::size_t m, ::std::size_t n);
+void transpose(float *x, ::std::ptrdiff_t x_stride, const float *y,
+               ::std::ptrdiff_t y_stride, ::std::size_t m, ::std::size_t n);
+
+// Register tiles of the matrix multiplication kernel, in rows and columns
+template < typename D >
+struct GemmTile;
+template < >
+struct GemmTile< double > {
+  static const ::std::size_t m = 6;
+  static const ::std::size_t n = 8;
+};
+template < >
+struct GemmTile< float > {
+  static const ::std::size_t m = 6;
+  static const ::std::size_t n = 16;
+};
+
+// Kernel of matrix multiplication over panels packed by tiles: c[i * c_row +
+// j * c_column] += alpha * sum of a[p * GemmTile::m + i] * b[p * GemmTile::n
+// + j] for p < kc, updating only i < m and j < n.
+void gemm(::std::size_t kc, const double *a, const double *b, double *c,
+          ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+          ::std::size_t n, double alpha);
+void gemm(::std::size_t kc, const float *a, const float *b, float *c,
+          ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+          ::std::size_t n, float alpha);
+
+// Tensor versions that run the kernels over the thread pool. They return
+// false without doing anything unless all tensors are of vectorizable or
+// complex vectorizable type and their elements are contiguous with unit
+// stride. Complex tensors support ADD, SUB, MUL and DIV.
+template < typename T >
+bool binary(Operation op, const T &x, typename T::const_reference y);
+template < typename T >
+bool binary(Operation op, const T &x, const T &y);
+template < typename T >
+bool fma(const T &x, typename T::const_reference y,
+         typename T::const_reference z);
+template < typename T >
+bool fma(const T &x, const T &y, typename T::const_reference z);
+template < typename T >
+bool fma(const T &x, typename T::const_reference y, const T &z);
+template < typename T >
+bool fma(const T &x, const T &y, const T &z);
+template < typename T >
+bool conj(const T &x);
+template < typename T >
+bool cnrm(const T &x);
+template < typename T >
+bool unary(Function f, const T &x);
+
+// Copy y into x of the same size in cache blocks over the thread pool. It
+// returns false without doing anything unless x and y have unit strides in
+// different dimensions. Blocks of other value types are transposed element
+// by element.
+template < typename T1, typename T2 >
+bool transpose(const T1 &x, const T2 &y);
+
+// Implementations for each instruction set. supported() tells whether the
+// instruction set was enabled at build time.
+#define THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION(name)                   \
+  namespace name {                                                      \
+  bool supported();                                                     \
+  void binary(Operation op, double *x, const double *y, ::std::size_t n); \
+  void binary(Operation op, double *x, double y, ::std::size_t n);      \
+  void binary(Operation op, float *x, const float *y, ::std::size_t n); \
+  void binary(Operation op, float *x, float y, ::std::size_t n);        \
+  void fma(double *x, const double *y, double y_value, const double *z, \
+           double z_value, ::std::size_t n);                            \
+  void fma(float *x, const float *y, float y_value, const float *z,     \
+           float z_value, ::std::size_t n);                             \
+  void transpose(double *x, ::std::ptrdiff_t x_stride, const double *y, \
+                 ::std::ptrdiff_t y_stride, ::std::size_t m,            \
+                 ::std::size_t n);                                      \
+  void transpose(float *x, ::std::ptrdiff_t x_stride, const float *y,   \
+                 ::std::ptrdiff_t y_stride, ::std::size_t m,            \
+                 ::std::size_t n);                                      \
+  void gemm(::std::size_t kc, const double *a, const double *b,        \
+            double *c, ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, \
+            ::std::size_t m, ::std::size_t n, double alpha);            \
+  void gemm(::std::size_t kc, const float *a, const float *b, float *c, \
+            ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column,          \
+            ::std::size_t m, ::std::size_t n, float alpha);             \
+  void complexBinary(Operation op, double *x, const double *y,          \
+                     double y_real, double y_imag, ::std::size_t n,     \
+                     bool fast);                                        \
+  void complexBinary(Operation op, float *x, const float *y,            \
+                     float y_real, float y_imag, ::std::size_t n,       \
+                     bool fast);                                        \
+  void complexFma(double *x, const double *y, double y_real,            \
+                  double y_imag, const double *z, double z_real,        \
+                  double z_imag, ::std::size_t n, bool fast);           \
+  void complexFma(float *x, const float *y, float y_real, float y_imag, \
+                  const float *z, float z_real, float z_imag,           \
+                  ::std::size_t n, bool fast);                          \
+  void complexConj(double *x, ::std::size_t n);                         \
+  void complexConj(float *x, ::std::size_t n);                          \
+  void complexCnrm(double *x, ::std::size_t n);                         \
+  void complexCnrm(float *x, ::std::size_t n);                          \
+  void unary(Function f, double *x, ::std::size_t n, bool fast);        \
+  void unary(Function f, float *x, ::std::size_t n, bool fast);         \
+  }  // namespace name
+
+THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION(scalar);
+THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION(sse2);
+THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION(avx2);
+THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION(avx512);
+
+#undef THUNDER_TENSOR_SIMD_DECLARE_INSTRUCTION
+
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_SIMD_HPP_
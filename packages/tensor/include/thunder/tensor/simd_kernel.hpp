@@ -0,0 +1,1232 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_SIMD_KERNEL_HPP_
+#define THUNDER_TENSOR_SIMD_KERNEL_HPP_
+
+#include <float.h>
+#include <math.h>
+
+#include <cstddef>
+
+#include "thunder/tensor/simd.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+
+// Kernels written against a vector type V, which provides
+//   value_type, vector and width;
+//   load, store and set to move data between memory and registers;
+//   transpose of width vectors forming a square tile;
+//   add, sub, mul, div, fma, fmax and fmin with the semantics of <cmath>;
+//   isgreater, isgreaterequal, isless, islessequal, islessgreater and
+//   isunordered returning 1 or 0 in each lane;
+//   abs, any telling whether some lane is not zero, and choose(c, a, b)
+//   taking lanes of a where c is 1 and of b where c is 0;
+//   split of two vectors of interleaved complex numbers into their real and
+//   imaginary parts in some order, and merge doing the reverse;
+//   sqrt, madd(a, b, c) computing a * b + c fused or not, pow2(k) giving 2^k
+//   for integral k of normal result, and exponent and significand splitting
+//   a positive normal number into an integral power of 2 and [1, 2).
+// Each instruction set instantiates them with its own vector types.
+
+// Scalar math used by remainder loops. Everything here is templated on the
+// vector type and calls the C library directly, so that no inline function is
+// shared between translation units built for different instruction sets.
+template < typename V >
+struct Scalar {
+  static double fma(double a, double b, double c) { return ::fma(a, b, c); }
+  static float fma(float a, float b, float c) { return ::fmaf(a, b, c); }
+  static double fmax(double a, double b) { return ::fmax(a, b); }
+  static float fmax(float a, float b) { return ::fmaxf(a, b); }
+  static double fmin(double a, double b) { return ::fmin(a, b); }
+  static float fmin(float a, float b) { return ::fminf(a, b); }
+  static double copysign(double a, double b) { return ::copysign(a, b); }
+  static float copysign(float a, float b) { return ::copysignf(a, b); }
+  static double least(double) { return DBL_MIN; }
+  static float least(float) { return FLT_MIN; }
+  static double sqrt(double a) { return ::sqrt(a); }
+  static float sqrt(float a) { return ::sqrtf(a); }
+  static double ldexp(double a, int e) { return ::ldexp(a, e); }
+  static float ldexp(float a, int e) { return ::ldexpf(a, e); }
+  static double frexp(double a, int *e) { return ::frexp(a, e); }
+  static float frexp(float a, int *e) { return ::frexpf(a, e); }
+  static double exp(double a) { return ::exp(a); }
+  static float exp(float a) { return ::expf(a); }
+  static double log(double a) { return ::log(a); }
+  static float log(float a) { return ::logf(a); }
+  static double sin(double a) { return ::sin(a); }
+  static float sin(float a) { return ::sinf(a); }
+  static double cos(double a) { return ::cos(a); }
+  static float cos(float a) { return ::cosf(a); }
+  static double tanh(double a) { return ::tanh(a); }
+  static float tanh(float a) { return ::tanhf(a); }
+  static double erf(double a) { return ::erf(a); }
+  static float erf(float a) { return ::erff(a); }
+  template < typename D >
+  static bool isNan(D a) { return a != a; }
+  template < typename D >
+  static bool isInf(D a) { return a == a && a - a != a - a; }
+  template < typename D >
+  static D unit(D a) { return copysign(isInf(a) ? D(1) : D(0), a); }
+  template < typename D >
+  static D clear(D a) { return isNan(a) ? copysign(D(0), a) : a; }
+
+  // Complex product and quotient of a + bi and c + di with the recovery of
+  // infinities and zeros from NaN results given in C99 Annex G
+  template < typename D >
+  static void multiply(D a, D b, D c, D d, D *x, D *y) {
+    D ac = a * c, bd = b * d, ad = a * d, bc = b * c;
+    *x = ac - bd;
+    *y = ad + bc;
+    if (!isNan(*x) || !isNan(*y)) {
+      return;
+    }
+    bool recalc = false;
+    if (isInf(a) || isInf(b)) {
+      a = unit(a);
+      b = unit(b);
+      c = clear(c);
+      d = clear(d);
+      recalc = true;
+    }
+    if (isInf(c) || isInf(d)) {
+      c = unit(c);
+      d = unit(d);
+      a = clear(a);
+      b = clear(b);
+      recalc = true;
+    }
+    if (!recalc && (isInf(ac) || isInf(bd) || isInf(ad) || isInf(bc))) {
+      a = clear(a);
+      b = clear(b);
+      c = clear(c);
+      d = clear(d);
+      recalc = true;
+    }
+    if (recalc) {
+      *x = static_cast< D >(HUGE_VAL) * (a * c - b * d);
+      *y = static_cast< D >(HUGE_VAL) * (a * d + b * c);
+    }
+  }
+  // Smith's algorithm, where quotients of floats are computed in double
+  // precision as the runtime libraries of compilers do
+  template < typename D >
+  static void divide(D a, D b, D c, D d, D *x, D *y) {
+    D ratio, denom;
+    if ((c < 0 ? -c : c) < (d < 0 ? -d : d)) {
+      ratio = c / d;
+      denom = c * ratio + d;
+      if (ratio != 0 && (ratio < 0 ? -ratio : ratio) < least(D())) {
+        *x = (c * (a / d) + b) / denom;
+        *y = (c * (b / d) - a) / denom;
+      } else {
+        *x = (a * ratio + b) / denom;
+        *y = (b * ratio - a) / denom;
+      }
+    } else {
+      ratio = d / c;
+      denom = d * ratio + c;
+      if (ratio != 0 && (ratio < 0 ? -ratio : ratio) < least(D())) {
+        *x = (d * (b / c) + a) / denom;
+        *y = (b - d * (a / c)) / denom;
+      } else {
+        *x = (b * ratio + a) / denom;
+        *y = (b - a * ratio) / denom;
+      }
+    }
+    if (!isNan(*x) || !isNan(*y)) {
+      return;
+    }
+    D inf = static_cast< D >(HUGE_VAL);
+    bool a_finite = !isNan(a) && !isInf(a), b_finite = !isNan(b) && !isInf(b);
+    bool c_finite = !isNan(c) && !isInf(c), d_finite = !isNan(d) && !isInf(d);
+    if (c == 0 && d == 0 && (!isNan(a) || !isNan(b))) {
+      *x = copysign(inf, c) * a;
+      *y = copysign(inf, c) * b;
+    } else if ((isInf(a) || isInf(b)) && c_finite && d_finite) {
+      a = unit(a);
+      b = unit(b);
+      *x = inf * (a * c + b * d);
+      *y = inf * (b * c - a * d);
+    } else if ((isInf(c) || isInf(d)) && a_finite && b_finite) {
+      c = unit(c);
+      d = unit(d);
+      *x = D(0) * (a * c + b * d);
+      *y = D(0) * (b * c - a * d);
+    }
+  }
+  static void divide(float a, float b, float c, float d, float *x,
+                     float *y) {
+    double re, im;
+    divide< double >(a, b, c, d, &re, &im);
+    *x = static_cast< float >(re);
+    *y = static_cast< float >(im);
+  }
+};
+
+#define THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Name, func, expr)          \
+  struct Name {                                                         \
+    template < typename V >                                             \
+    static typename V::vector vector(                                   \
+        typename V::vector a, typename V::vector b) {                   \
+      return V::func(a, b);                                             \
+    }                                                                   \
+    template < typename V >                                             \
+    static typename V::value_type scalar(                               \
+        typename V::value_type a, typename V::value_type b) {           \
+      return static_cast< typename V::value_type >(expr);               \
+    }                                                                   \
+  };
+
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Add, add, a + b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Sub, sub, a - b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Mul, mul, a * b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Div, div, a / b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Fmax, fmax, Scalar< V >::fmax(a, b));
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Fmin, fmin, Scalar< V >::fmin(a, b));
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Isgreater, isgreater, a > b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Isgreaterequal, isgreaterequal, a >= b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Isless, isless, a < b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(Islessequal, islessequal, a <= b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(
+    Islessgreater, islessgreater, a < b || a > b);
+THUNDER_TENSOR_SIMD_DEFINE_OPERATION(
+    Isunordered, isunordered, a != a || b != b);
+
+#undef THUNDER_TENSOR_SIMD_DEFINE_OPERATION
+
+template < typename V, typename O >
+void binaryKernel(typename V::value_type *x, const typename V::value_type *y,
+                  ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  ::std::size_t i = 0;
+  for (; i + 2 * width <= n; i += 2 * width) {
+    typename V::vector x0 = V::load(x + i);
+    typename V::vector x1 = V::load(x + i + width);
+    V::store(x + i, O::template vector< V >(x0, V::load(y + i)));
+    V::store(x + i + width,
+             O::template vector< V >(x1, V::load(y + i + width)));
+  }
+  for (; i < n; ++i) {
+    x[i] = O::template scalar< V >(x[i], y[i]);
+  }
+}
+
+template < typename V, typename O >
+void binaryKernel(typename V::value_type *x, typename V::value_type y,
+                  ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  typename V::vector y_vector = V::set(y);
+  ::std::size_t i = 0;
+  for (; i + 2 * width <= n; i += 2 * width) {
+    typename V::vector x0 = V::load(x + i);
+    typename V::vector x1 = V::load(x + i + width);
+    V::store(x + i, O::template vector< V >(x0, y_vector));
+    V::store(x + i + width, O::template vector< V >(x1, y_vector));
+  }
+  for (; i < n; ++i) {
+    x[i] = O::template scalar< V >(x[i], y);
+  }
+}
+
+template < typename V, typename Y >
+void binaryKernel(Operation op, typename V::value_type *x, Y y,
+                  ::std::size_t n) {
+  switch (op) {
+    case ADD: binaryKernel< V, Add >(x, y, n); break;
+    case SUB: binaryKernel< V, Sub >(x, y, n); break;
+    case MUL: binaryKernel< V, Mul >(x, y, n); break;
+    case DIV: binaryKernel< V, Div >(x, y, n); break;
+    case FMAX: binaryKernel< V, Fmax >(x, y, n); break;
+    case FMIN: binaryKernel< V, Fmin >(x, y, n); break;
+    case ISGREATER: binaryKernel< V, Isgreater >(x, y, n); break;
+    case ISGREATEREQUAL: binaryKernel< V, Isgreaterequal >(x, y, n); break;
+    case ISLESS: binaryKernel< V, Isless >(x, y, n); break;
+    case ISLESSEQUAL: binaryKernel< V, Islessequal >(x, y, n); break;
+    case ISLESSGREATER: binaryKernel< V, Islessgreater >(x, y, n); break;
+    case ISUNORDERED: binaryKernel< V, Isunordered >(x, y, n); break;
+  }
+}
+
+template < typename V >
+void fmaKernel(typename V::value_type *x, const typename V::value_type *y,
+               typename V::value_type y_value,
+               const typename V::value_type *z,
+               typename V::value_type z_value, ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  typename V::vector y_vector = V::set(y_value);
+  typename V::vector z_vector = V::set(z_value);
+  ::std::size_t i = 0;
+  for (; i + width <= n; i += width) {
+    V::store(x + i, V::fma(V::load(x + i),
+                           y == nullptr ? y_vector : V::load(y + i),
+                           z == nullptr ? z_vector : V::load(z + i)));
+  }
+  for (; i < n; ++i) {
+    x[i] = Scalar< V >::fma(x[i], y == nullptr ? y_value : y[i],
+                            z == nullptr ? z_value : z[i]);
+  }
+}
+
+// Square tiles are loaded from rows of y, transposed in registers and stored
+// to rows of x. The edges are copied element by element.
+template < typename V >
+void transposeKernel(typename V::value_type *x, ::std::ptrdiff_t x_stride,
+                     const typename V::value_type *y,
+                     ::std::ptrdiff_t y_stride, ::std::size_t m,
+                     ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  typename V::vector tile[V::width];
+  ::std::size_t i = 0;
+  for (; i + width <= m; i += width) {
+    ::std::size_t j = 0;
+    for (; j + width <= n; j += width) {
+      for (::std::size_t k = 0; k < width; ++k) {
+        tile[k] = V::load(y + (j + k) * y_stride + i);
+      }
+      V::transpose(tile);
+      for (::std::size_t k = 0; k < width; ++k) {
+        V::store(x + (i + k) * x_stride + j, tile[k]);
+      }
+    }
+    for (::std::size_t k = 0; k < width; ++k) {
+      for (::std::size_t l = j; l < n; ++l) {
+        x[(i + k) * x_stride + l] = y[l * y_stride + i + k];
+      }
+    }
+  }
+  for (; i < m; ++i) {
+    for (::std::size_t j = 0; j < n; ++j) {
+      x[i * x_stride + j] = y[j * y_stride + i];
+    }
+  }
+}
+
+// The mr x nr tile of products is accumulated in registers, loading each row
+// of the b panel in vectors and broadcasting each column of the a panel.
+// Columns are taken two vectors at a time so that the accumulators fit in 16
+// registers. Full tiles of contiguous rows are updated in place, and the edges
+// through memory.
+template < typename V >
+void gemmKernel(::std::size_t kc, const typename V::value_type *a,
+                const typename V::value_type *b, typename V::value_type *c,
+                ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column,
+                ::std::size_t m, ::std::size_t n,
+                typename V::value_type alpha) {
+  typedef typename V::value_type D;
+  const ::std::size_t mr = GemmTile< D >::m;
+  const ::std::size_t nr = GemmTile< D >::n;
+  const ::std::size_t nv = nr / V::width;
+  const ::std::size_t group = nv < 2 ? nv : 2;
+  static_assert(nv % group == 0 && nv * V::width == nr,
+                "Tile columns must fill vector groups.");
+  bool full = m == mr && n == nr && c_column == 1;
+  typename V::vector alpha_vector = V::set(alpha);
+  D buffer[mr * nr];
+  for (::std::size_t jv = 0; jv < nv; jv += group) {
+    typename V::vector ab[mr][group];
+    for (::std::size_t i = 0; i < mr; ++i) {
+      for (::std::size_t j = 0; j < group; ++j) {
+        ab[i][j] = V::set(D(0));
+      }
+    }
+    const D *a_pointer = a;
+    const D *b_pointer = b + jv * V::width;
+    for (::std::size_t p = 0; p < kc; ++p) {
+      typename V::vector b_vector[group];
+      for (::std::size_t j = 0; j < group; ++j) {
+        b_vector[j] = V::load(b_pointer + j * V::width);
+      }
+      for (::std::size_t i = 0; i < mr; ++i) {
+        typename V::vector a_vector = V::set(a_pointer[i]);
+        for (::std::size_t j = 0; j < group; ++j) {
+          ab[i][j] = V::madd(a_vector, b_vector[j], ab[i][j]);
+        }
+      }
+      a_pointer += mr;
+      b_pointer += nr;
+    }
+    for (::std::size_t i = 0; i < mr; ++i) {
+      for (::std::size_t j = 0; j < group; ++j) {
+        if (full) {
+          D *c_pointer = c + i * c_row + (jv + j) * V::width;
+          V::store(c_pointer,
+                   V::madd(alpha_vector, ab[i][j], V::load(c_pointer)));
+        } else {
+          V::store(buffer + i * nr + (jv + j) * V::width,
+                   V::mul(alpha_vector, ab[i][j]));
+        }
+      }
+    }
+  }
+  if (!full) {
+    for (::std::size_t i = 0; i < m; ++i) {
+      for (::std::size_t j = 0; j < n; ++j) {
+        c[i * c_row + j * c_column] += buffer[i * nr + j];
+      }
+    }
+  }
+}
+
+// Complex operations on the real and imaginary parts of width complex
+// numbers. vector returns false when the results have to be computed again by
+// scalar to follow C99 Annex G, which is only checked unless fast.
+struct ComplexAdd {
+  template < typename V >
+  static bool vector(typename V::vector ar, typename V::vector ai,
+                     typename V::vector br, typename V::vector bi,
+                     typename V::vector *cr, typename V::vector *ci,
+                     bool) {
+    *cr = V::add(ar, br);
+    *ci = V::add(ai, bi);
+    return true;
+  }
+  template < typename V, typename D >
+  static void scalar(D a, D b, D c, D d, D *x, D *y, bool) {
+    *x = a + c;
+    *y = b + d;
+  }
+};
+
+struct ComplexSub {
+  template < typename V >
+  static bool vector(typename V::vector ar, typename V::vector ai,
+                     typename V::vector br, typename V::vector bi,
+                     typename V::vector *cr, typename V::vector *ci,
+                     bool) {
+    *cr = V::sub(ar, br);
+    *ci = V::sub(ai, bi);
+    return true;
+  }
+  template < typename V, typename D >
+  static void scalar(D a, D b, D c, D d, D *x, D *y, bool) {
+    *x = a - c;
+    *y = b - d;
+  }
+};
+
+// Products that are NaN in some lane are recomputed with Annex G
+struct ComplexMul {
+  template < typename V >
+  static bool vector(typename V::vector ar, typename V::vector ai,
+                     typename V::vector br, typename V::vector bi,
+                     typename V::vector *cr, typename V::vector *ci,
+                     bool fast) {
+    *cr = V::sub(V::mul(ar, br), V::mul(ai, bi));
+    *ci = V::add(V::mul(ar, bi), V::mul(ai, br));
+    return fast || !V::any(V::isunordered(*cr, *ci));
+  }
+  template < typename V, typename D >
+  static void scalar(D a, D b, D c, D d, D *x, D *y, bool fast) {
+    if (fast) {
+      *x = a * c - b * d;
+      *y = a * d + b * c;
+    } else {
+      Scalar< V >::multiply(a, b, c, d, x, y);
+    }
+  }
+};
+
+// Fast quotients multiply by the conjugate over the squared magnitude, which
+// overflows or underflows beyond the square roots of the range. Otherwise
+// lanes run Smith's algorithm, and those whose ratio is subnormal or whose
+// results are not finite are computed again by scalar, as well as quotients
+// of floats.
+struct ComplexDiv {
+  template < typename V >
+  static bool vector(typename V::vector ar, typename V::vector ai,
+                     typename V::vector br, typename V::vector bi,
+                     typename V::vector *cr, typename V::vector *ci,
+                     bool fast) {
+    typedef typename V::value_type D;
+    if (fast) {
+      typename V::vector t = V::div(
+          V::set(1), V::add(V::mul(br, br), V::mul(bi, bi)));
+      *cr = V::mul(V::add(V::mul(ar, br), V::mul(ai, bi)), t);
+      *ci = V::mul(V::sub(V::mul(ai, br), V::mul(ar, bi)), t);
+      return true;
+    }
+    if (sizeof(D) < sizeof(double)) {
+      return false;
+    }
+    // Each lane divides by the larger of the real and imaginary parts
+    typename V::vector m = V::isless(V::abs(br), V::abs(bi));
+    typename V::vector ratio = V::div(V::choose(m, br, bi),
+                                      V::choose(m, bi, br));
+    typename V::vector denom = V::add(V::mul(V::choose(m, br, bi), ratio),
+                                      V::choose(m, bi, br));
+    typename V::vector u = V::choose(m, ar, ai), v = V::choose(m, ai, ar);
+    typename V::vector vr = V::mul(v, ratio);
+    *cr = V::div(V::add(V::mul(u, ratio), v), denom);
+    *ci = V::div(V::choose(m, V::sub(vr, u), V::sub(u, vr)), denom);
+    typename V::vector r = V::abs(ratio);
+    return !V::any(V::add(
+        V::mul(V::isless(r, V::set(Scalar< V >::least(D()))),
+               V::isgreater(r, V::set(0))),
+        V::isunordered(V::sub(*cr, *cr), V::sub(*ci, *ci))));
+  }
+  template < typename V, typename D >
+  static void scalar(D a, D b, D c, D d, D *x, D *y, bool fast) {
+    if (fast) {
+      D t = 1 / (c * c + d * d);
+      *x = (a * c + b * d) * t;
+      *y = (b * c - a * d) * t;
+    } else {
+      Scalar< V >::divide(a, b, c, d, x, y);
+    }
+  }
+};
+
+// Kernels over n interleaved complex numbers
+template < typename V, typename O >
+void complexBinaryKernel(typename V::value_type *x,
+                         const typename V::value_type *y,
+                         typename V::value_type y_real,
+                         typename V::value_type y_imag, ::std::size_t n,
+                         bool fast) {
+  const ::std::size_t width = V::width;
+  typename V::vector yr = V::set(y_real), yi = V::set(y_imag);
+  ::std::size_t i = 0;
+  for (; i + width <= n; i += width) {
+    typename V::vector xr, xi, cr, ci, c0, c1;
+    V::split(V::load(x + 2 * i), V::load(x + 2 * i + width), &xr, &xi);
+    if (y != nullptr) {
+      V::split(V::load(y + 2 * i), V::load(y + 2 * i + width), &yr, &yi);
+    }
+    if (O::template vector< V >(xr, xi, yr, yi, &cr, &ci, fast)) {
+      V::merge(cr, ci, &c0, &c1);
+      V::store(x + 2 * i, c0);
+      V::store(x + 2 * i + width, c1);
+      continue;
+    }
+    for (::std::size_t k = 2 * i; k < 2 * (i + width); k += 2) {
+      O::template scalar< V >(x[k], x[k + 1], y == nullptr ? y_real : y[k],
+                              y == nullptr ? y_imag : y[k + 1], x + k,
+                              x + k + 1, fast);
+    }
+  }
+  for (::std::size_t k = 2 * i; k < 2 * n; k += 2) {
+    O::template scalar< V >(x[k], x[k + 1], y == nullptr ? y_real : y[k],
+                            y == nullptr ? y_imag : y[k + 1], x + k, x + k + 1,
+                            fast);
+  }
+}
+
+template < typename V >
+void complexBinaryKernel(Operation op, typename V::value_type *x,
+                         const typename V::value_type *y,
+                         typename V::value_type y_real,
+                         typename V::value_type y_imag, ::std::size_t n,
+                         bool fast) {
+  switch (op) {
+    case ADD:
+      complexBinaryKernel< V, ComplexAdd >(x, y, y_real, y_imag, n, fast);
+      break;
+    case SUB:
+      complexBinaryKernel< V, ComplexSub >(x, y, y_real, y_imag, n, fast);
+      break;
+    case MUL:
+      complexBinaryKernel< V, ComplexMul >(x, y, y_real, y_imag, n, fast);
+      break;
+    case DIV:
+      complexBinaryKernel< V, ComplexDiv >(x, y, y_real, y_imag, n, fast);
+      break;
+    default:
+      break;
+  }
+}
+
+// x = x * y + z, where the product follows Annex G unless fast
+template < typename V >
+void complexFmaKernel(typename V::value_type *x,
+                      const typename V::value_type *y,
+                      typename V::value_type y_real,
+                      typename V::value_type y_imag,
+                      const typename V::value_type *z,
+                      typename V::value_type z_real,
+                      typename V::value_type z_imag, ::std::size_t n,
+                      bool fast) {
+  typedef typename V::value_type D;
+  const ::std::size_t width = V::width;
+  typename V::vector yr = V::set(y_real), yi = V::set(y_imag);
+  typename V::vector zr = V::set(z_real), zi = V::set(z_imag);
+  ::std::size_t i = 0;
+  for (; i + width <= n; i += width) {
+    typename V::vector xr, xi, cr, ci, c0, c1;
+    V::split(V::load(x + 2 * i), V::load(x + 2 * i + width), &xr, &xi);
+    if (y != nullptr) {
+      V::split(V::load(y + 2 * i), V::load(y + 2 * i + width), &yr, &yi);
+    }
+    if (z != nullptr) {
+      V::split(V::load(z + 2 * i), V::load(z + 2 * i + width), &zr, &zi);
+    }
+    if (ComplexMul::vector< V >(xr, xi, yr, yi, &cr, &ci, fast)) {
+      V::merge(V::add(cr, zr), V::add(ci, zi), &c0, &c1);
+      V::store(x + 2 * i, c0);
+      V::store(x + 2 * i + width, c1);
+      continue;
+    }
+    for (::std::size_t k = 2 * i; k < 2 * (i + width); k += 2) {
+      D re, im;
+      ComplexMul::scalar< V >(x[k], x[k + 1], y == nullptr ? y_real : y[k],
+                              y == nullptr ? y_imag : y[k + 1], &re, &im,
+                              fast);
+      x[k] = re + (z == nullptr ? z_real : z[k]);
+      x[k + 1] = im + (z == nullptr ? z_imag : z[k + 1]);
+    }
+  }
+  for (::std::size_t k = 2 * i; k < 2 * n; k += 2) {
+    D re, im;
+    ComplexMul::scalar< V >(x[k], x[k + 1], y == nullptr ? y_real : y[k],
+                            y == nullptr ? y_imag : y[k + 1], &re, &im, fast);
+    x[k] = re + (z == nullptr ? z_real : z[k]);
+    x[k + 1] = im + (z == nullptr ? z_imag : z[k + 1]);
+  }
+}
+
+template < typename V >
+void complexConjKernel(typename V::value_type *x, ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  typename V::vector minus = V::set(-1);
+  ::std::size_t i = 0;
+  for (; i + width <= n; i += width) {
+    typename V::vector xr, xi, c0, c1;
+    V::split(V::load(x + 2 * i), V::load(x + 2 * i + width), &xr, &xi);
+    V::merge(xr, V::mul(xi, minus), &c0, &c1);
+    V::store(x + 2 * i, c0);
+    V::store(x + 2 * i + width, c1);
+  }
+  for (::std::size_t k = 2 * i; k < 2 * n; k += 2) {
+    x[k + 1] = -x[k + 1];
+  }
+}
+
+// x = |x|^2 as std::norm computes it
+template < typename V >
+void complexCnrmKernel(typename V::value_type *x, ::std::size_t n) {
+  const ::std::size_t width = V::width;
+  typename V::vector zero = V::set(0);
+  ::std::size_t i = 0;
+  for (; i + width <= n; i += width) {
+    typename V::vector xr, xi, c0, c1;
+    V::split(V::load(x + 2 * i), V::load(x + 2 * i + width), &xr, &xi);
+    V::merge(V::add(V::mul(xr, xr), V::mul(xi, xi)), zero, &c0, &c1);
+    V::store(x + 2 * i, c0);
+    V::store(x + 2 * i + width, c1);
+  }
+  for (::std::size_t k = 2 * i; k < 2 * n; k += 2) {
+    x[k] = x[k] * x[k] + x[k + 1] * x[k + 1];
+    x[k + 1] = 0;
+  }
+}
+
+// Elementary functions. Each reduces its argument to a small range where a
+// polynomial or rational approximation from fdlibm or Cephes applies.
+// vector() sets lanes of *bad to 1 where the argument needs the care of the C
+// library, whose result scalar() gives instead. Fast math takes shorter paths
+// where they exist.
+template < typename V >
+typename V::value_type constant(double d, float f) {
+  typedef typename V::value_type D;
+  return sizeof(D) == sizeof(double) ? static_cast< D >(d) : f;
+}
+
+// c[0] * a^(n - 1) + ... + c[n - 1] by Horner's rule
+template < typename V, typename D, ::std::size_t n >
+typename V::vector horner(typename V::vector a, const D (&c)[n]) {
+  typename V::vector p = V::set(c[0]);
+  for (::std::size_t i = 1; i < n; ++i) {
+    p = V::madd(p, a, V::set(c[i]));
+  }
+  return p;
+}
+
+// The same with a leading coefficient of 1
+template < typename V, typename D, ::std::size_t n >
+typename V::vector monic(typename V::vector a, const D (&c)[n]) {
+  typename V::vector p = V::add(a, V::set(c[0]));
+  for (::std::size_t i = 1; i < n; ++i) {
+    p = V::madd(p, a, V::set(c[i]));
+  }
+  return p;
+}
+
+// Nearest integral value, for magnitudes below 2^51 or 2^22
+template < typename V >
+typename V::vector nearest(typename V::vector a) {
+  typename V::vector magic =
+      V::set(constant< V >(6755399441055744.0, 12582912.0f));
+  return V::sub(V::add(a, magic), magic);
+}
+
+// P(r^2) from fdlibm, such that 2 + r^2 P(r^2) approximates
+// r (exp(r) + 1) / (exp(r) - 1) for |r| <= ln(2) / 2
+template < typename V >
+typename V::vector expRemez(typename V::vector r, double) {
+  static const double p[] = {
+    4.13813679705723846039e-08, -1.65339022054652515390e-06,
+    6.61375632143793436117e-05, -2.77777777770155933842e-03,
+    1.66666666666666019037e-01};
+  return horner< V >(V::mul(r, r), p);
+}
+template < typename V >
+typename V::vector expRemez(typename V::vector r, float) {
+  static const float p[] = {-2.7667332906e-3f, 1.6666625440e-1f};
+  return horner< V >(V::mul(r, r), p);
+}
+
+// Taylor series of exp(r), for |r| <= ln(2) / 2
+template < typename V >
+typename V::vector expTaylor(typename V::vector r, double) {
+  static const double p[] = {
+    1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800, 1.0 / 362880,
+    1.0 / 40320, 1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6,
+    1.0 / 2, 1.0, 1.0};
+  return horner< V >(r, p);
+}
+template < typename V >
+typename V::vector expTaylor(typename V::vector r, float) {
+  static const float p[] = {
+    1.0f / 5040, 1.0f / 720, 1.0f / 120, 1.0f / 24, 1.0f / 6, 1.0f / 2,
+    1.0f, 1.0f};
+  return horner< V >(r, p);
+}
+
+struct Exp {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool fast) {
+    typedef typename V::value_type D;
+    typedef typename V::vector vector;
+    vector x = V::fmin(V::fmax(a, V::set(constant< V >(-746, -104))),
+                       V::set(constant< V >(710, 89)));
+    vector k = nearest< V >(V::mul(x, V::set(constant< V >(
+        1.44269504088896338700e+00, 1.4426950216e+00f))));
+    vector hi = V::madd(k, V::set(constant< V >(
+        -6.93147180369123816490e-01, -6.9314575195e-01f)), x);
+    vector lo = V::mul(k, V::set(constant< V >(
+        1.90821492927058770002e-10, 1.4286067653e-06f)));
+    vector r = V::sub(hi, lo), y;
+    *bad = V::add(*bad, V::isunordered(a, a));
+    if (fast) {
+      y = expTaylor< V >(r, D());
+    } else {
+      vector c = V::sub(r, V::mul(V::mul(r, r), expRemez< V >(r, D())));
+      y = V::sub(V::set(1), V::sub(V::sub(lo, V::div(
+          V::mul(r, c), V::sub(V::set(2), c))), hi));
+    }
+    // The scale is split in two so that each factor is normal
+    vector k1 = nearest< V >(V::madd(k, V::set(0.5), V::set(-0.25)));
+    return V::mul(V::mul(y, V::pow2(k1)), V::pow2(V::sub(k, k1)));
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::exp(a); }
+};
+
+// R from fdlibm, such that log(1 + f) = f - f^2 / 2 + s (f^2 / 2 + R) where
+// s = f / (2 + f), z = s^2 and w = z^2
+template < typename V >
+typename V::vector logRemez(typename V::vector z, typename V::vector w,
+                            double) {
+  static const double p1[] = {
+    1.531383769920937332e-01, 2.222219843214978396e-01,
+    3.999999999940941908e-01};
+  static const double p2[] = {
+    1.479819860511658591e-01, 1.818357216161805012e-01,
+    2.857142874366239149e-01, 6.666666666666735130e-01};
+  return V::madd(z, horner< V >(w, p2), V::mul(w, horner< V >(w, p1)));
+}
+template < typename V >
+typename V::vector logRemez(typename V::vector z, typename V::vector w,
+                            float) {
+  static const float p1[] = {2.4279078841e-01f, 4.0000972152e-01f};
+  static const float p2[] = {2.8498786688e-01f, 6.6666662693e-01f};
+  return V::madd(z, horner< V >(w, p2), V::mul(w, horner< V >(w, p1)));
+}
+
+struct Log {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool) {
+    typedef typename V::value_type D;
+    typedef typename V::vector vector;
+    *bad = V::add(*bad, V::add(
+        V::isless(a, V::set(Scalar< V >::least(D()))),
+        V::add(V::isgreater(a, V::set(constant< V >(DBL_MAX, FLT_MAX))),
+               V::isunordered(a, a))));
+    vector e = V::exponent(a), m = V::significand(a);
+    vector big = V::isgreater(m, V::set(constant< V >(
+        1.41421356237309504880, 1.4142135624f)));
+    m = V::choose(big, V::mul(m, V::set(0.5)), m);
+    e = V::add(e, big);
+    vector f = V::sub(m, V::set(1));
+    vector s = V::div(f, V::add(f, V::set(2)));
+    vector z = V::mul(s, s);
+    vector r = logRemez< V >(z, V::mul(z, z), D());
+    vector hfsq = V::mul(V::mul(V::set(0.5), f), f);
+    return V::sub(V::mul(e, V::set(constant< V >(
+        6.93147180369123816490e-01, 6.9313812256e-01f))), V::sub(V::sub(
+            hfsq, V::madd(s, V::add(hfsq, r), V::mul(e, V::set(constant< V >(
+                1.90821492927058770002e-10, 9.0580006145e-06f))))), f));
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::log(a); }
+};
+
+struct Sqrt {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *, bool) {
+    return V::sqrt(a);
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::sqrt(a); }
+};
+
+// a = n * pi / 2 + r + t with |r| <= pi / 4 and a tail t, if the lanes of
+// *bad are clear. In double the multiples of pi / 2 are taken with 119 bits
+// and the rounding of r is recovered in t. Fast math lets r lose relative
+// accuracy near multiples of pi / 2.
+template < typename V >
+void quadrant(typename V::vector a, typename V::vector *n,
+              typename V::vector *r, typename V::vector *t,
+              typename V::vector *bad, bool fast, double) {
+  typedef typename V::vector vector;
+  *n = nearest< V >(V::mul(a, V::set(6.36619772367581382433e-01)));
+  vector u = V::madd(*n, V::set(-1.57079632673412561417e+00), a);
+  vector w = V::mul(*n, V::set(-6.07710050630396597660e-11));
+  *r = V::add(u, w);
+  vector v = V::sub(*r, u);
+  *t = V::madd(*n, V::set(-2.02226624879595063154e-21), V::add(
+      V::sub(u, V::sub(*r, v)), V::sub(w, v)));
+  *bad = V::add(*bad, V::add(V::isunordered(a, a),
+                             V::isgreater(V::abs(a), V::set(1048576.0))));
+  if (!fast) {
+    *bad = V::add(*bad, V::mul(
+        V::isless(V::abs(*r), V::set(9.094947017729282379e-13)),
+        V::isgreater(V::abs(*n), V::set(0))));
+  }
+}
+template < typename V >
+void quadrant(typename V::vector a, typename V::vector *n,
+              typename V::vector *r, typename V::vector *t,
+              typename V::vector *bad, bool fast, float) {
+  *n = nearest< V >(V::mul(a, V::set(6.3661977236e-01f)));
+  *r = V::madd(*n, V::set(-7.54978995489188216e-8f), V::madd(
+      *n, V::set(-4.837512969970703125e-4f), V::madd(
+          *n, V::set(-1.5703125f), a)));
+  *t = V::set(0);
+  *bad = V::add(*bad, V::add(V::isunordered(a, a),
+                             V::isgreater(V::abs(a), V::set(8192))));
+  if (!fast) {
+    *bad = V::add(*bad, V::mul(
+        V::isless(V::abs(*r), V::set(1.953125e-3f)),
+        V::isgreater(V::abs(*n), V::set(0))));
+  }
+}
+
+// sin(r + t) and cos(r + t) for |r| <= pi / 4
+template < typename V >
+typename V::vector sinKernel(typename V::vector r, typename V::vector t,
+                             double) {
+  typedef typename V::vector vector;
+  static const double p[] = {
+    1.58969099521155010221e-10, -2.50507602534068634195e-08,
+    2.75573137070700676789e-06, -1.98412698298579493134e-04,
+    8.33333333332248946124e-03};
+  vector z = V::mul(r, r), v = V::mul(z, r);
+  return V::sub(r, V::sub(V::sub(V::mul(z, V::sub(
+      V::mul(V::set(0.5), t), V::mul(v, horner< V >(z, p)))), t), V::mul(
+          v, V::set(-1.66666666666666324348e-01))));
+}
+template < typename V >
+typename V::vector sinKernel(typename V::vector r, typename V::vector,
+                             float) {
+  static const float p[] = {
+    -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f};
+  typename V::vector y = V::madd(
+      V::mul(V::mul(r, r), r), horner< V >(V::mul(r, r), p), r);
+  return V::choose(V::isless(V::abs(r), V::set(2.4414062500e-04f)), r, y);
+}
+template < typename V >
+typename V::vector cosKernel(typename V::vector r, typename V::vector t,
+                             double) {
+  typedef typename V::vector vector;
+  static const double p[] = {
+    -1.13596475577881948265e-11, 2.08757232129817482790e-09,
+    -2.75573143513906633035e-07, 2.48015872894767294178e-05,
+    -1.38888888888741095749e-03, 4.16666666666666019037e-02};
+  vector z = V::mul(r, r), hz = V::mul(V::set(0.5), z);
+  vector w = V::sub(V::set(1), hz);
+  return V::add(w, V::add(V::sub(V::sub(V::set(1), w), hz), V::sub(
+      V::mul(z, V::mul(z, horner< V >(z, p))), V::mul(r, t))));
+}
+template < typename V >
+typename V::vector cosKernel(typename V::vector r, typename V::vector,
+                             float) {
+  typedef typename V::vector vector;
+  static const float p[] = {
+    2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f};
+  vector z = V::mul(r, r);
+  return V::madd(V::mul(z, z), horner< V >(z, p),
+                 V::madd(z, V::set(-0.5), V::set(1)));
+}
+
+// sin(a + shift * pi / 2)
+template < typename V >
+typename V::vector sine(typename V::vector a, typename V::vector *bad,
+                        bool fast, int shift) {
+  typedef typename V::value_type D;
+  typedef typename V::vector vector;
+  vector n, r, t;
+  quadrant< V >(a, &n, &r, &t, bad, fast, D());
+  n = V::add(n, V::set(shift));
+  vector q = V::madd(nearest< V >(V::madd(n, V::set(0.25), V::set(-0.375))),
+                     V::set(-4), n);
+  vector half = nearest< V >(V::madd(q, V::set(0.5), V::set(-0.25)));
+  vector odd = V::madd(half, V::set(-2), q);
+  vector y = V::choose(odd, cosKernel< V >(r, t, D()),
+                       sinKernel< V >(r, t, D()));
+  return V::choose(half, V::mul(y, V::set(-1)), y);
+}
+
+struct Sin {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool fast) {
+    return sine< V >(a, bad, fast, 0);
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::sin(a); }
+};
+
+struct Cos {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool fast) {
+    return sine< V >(a, bad, fast, 1);
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::cos(a); }
+};
+
+// (tanh(a) - a) / a^3 as a function of z = a^2, for |a| < 0.625
+template < typename V >
+typename V::vector tanhRational(typename V::vector z, double) {
+  static const double p[] = {
+    -9.64399179425052238628e-01, -9.92877231001918586564e+01,
+    -1.61468768441708447952e+03};
+  static const double q[] = {
+    1.12811678491632931402e+02, 2.23548839060100448583e+03,
+    4.84406305325125486048e+03};
+  return V::div(horner< V >(z, p), monic< V >(z, q));
+}
+template < typename V >
+typename V::vector tanhRational(typename V::vector z, float) {
+  static const float p[] = {
+    -5.70498872745e-3f, 2.06390887954e-2f, -5.37397155531e-2f,
+    1.33314422036e-1f, -3.33332819422e-1f};
+  return horner< V >(z, p);
+}
+
+struct Tanh {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool fast) {
+    typedef typename V::value_type D;
+    typedef typename V::vector vector;
+    vector z = V::mul(a, a);
+    vector tiny = V::isless(V::abs(a), V::set(constant< V >(
+        3.7252902984619141e-09, 1.2207031250e-04f)));
+    vector small = V::choose(
+        tiny, a, V::madd(V::mul(a, z), tanhRational< V >(z, D()), a));
+    vector e = Exp::vector< V >(V::mul(V::abs(a), V::set(2)), bad, fast);
+    vector y = V::sub(V::set(1), V::div(V::set(2), V::add(e, V::set(1))));
+    return V::choose(V::isless(V::abs(a), V::set(0.625)), small, V::choose(
+        V::isless(a, V::set(0)), V::mul(y, V::set(-1)), y));
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::tanh(a); }
+};
+
+// erf(a) / a as a function of z = a^2 for |a| < 1, and erfc(a) / exp(-a^2)
+// for 1 <= a <= 6
+template < typename V >
+typename V::vector erfRational(typename V::vector z, double) {
+  static const double p[] = {
+    9.60497373987051638749e+00, 9.00260197203842689217e+01,
+    2.23200534594684319226e+03, 7.00332514112805075473e+03,
+    5.55923013010394962768e+04};
+  static const double q[] = {
+    3.35617141647503099647e+01, 5.21357949780152679795e+02,
+    4.59432382970980127987e+03, 2.26290000613890934246e+04,
+    4.92673942608635921086e+04};
+  return V::div(horner< V >(z, p), monic< V >(z, q));
+}
+template < typename V >
+typename V::vector erfRational(typename V::vector z, float) {
+  static const float p[] = {
+    7.853861353153693e-5f, -8.010193625184903e-4f, 5.188327685732524e-3f,
+    -2.685381193529856e-2f, 1.128358514861418e-1f, -3.761262582423300e-1f,
+    1.128379165726710e+0f};
+  return horner< V >(z, p);
+}
+template < typename V, typename D >
+typename V::vector erfcRational(typename V::vector a) {
+  static const D p[] = {
+    2.46196981473530512524e-10, 5.64189564831068821977e-01,
+    7.46321056442269912687e+00, 4.86371970985681366614e+01,
+    1.96520832956077098242e+02, 5.26445194995477358631e+02,
+    9.34528527171957607540e+02, 1.02755188689515710272e+03,
+    5.57535335369399327526e+02};
+  static const D q[] = {
+    1.32281951154744992508e+01, 8.67072140885989742329e+01,
+    3.54937778887819891062e+02, 9.75708501743205489753e+02,
+    1.82390916687909736289e+03, 2.24633760818710981792e+03,
+    1.65666309194161350182e+03, 5.57535340817727675546e+02};
+  return V::div(horner< V >(a, p), monic< V >(a, q));
+}
+
+struct Erf {
+  template < typename V >
+  static typename V::vector vector(typename V::vector a,
+                                   typename V::vector *bad, bool fast) {
+    typedef typename V::value_type D;
+    typedef typename V::vector vector;
+    *bad = V::add(*bad, V::isunordered(a, a));
+    vector b = V::fmin(V::abs(a), V::set(6)), unused = V::set(0);
+    vector small = V::mul(a, erfRational< V >(V::mul(a, a), D()));
+    vector y = V::sub(V::set(1), V::mul(Exp::vector< V >(V::mul(
+        V::mul(b, b), V::set(-1)), &unused, fast), erfcRational< V, D >(b)));
+    return V::choose(V::isless(b, V::set(1)), small, V::choose(
+        V::isless(a, V::set(0)), V::mul(y, V::set(-1)), y));
+  }
+  template < typename V, typename D >
+  static D scalar(D a) { return Scalar< V >::erf(a); }
+};
+
+// x = f(x) over n elements. The tail goes through a padded block so that
+// every element gets the same result wherever it lies.
+template < typename V, typename F >
+void unaryKernel(typename V::value_type *x, ::std::size_t n, bool fast) {
+  typedef typename V::value_type D;
+  const ::std::size_t width = V::width;
+  D a[width], y[width], bad[width];
+  for (::std::size_t i = 0; i < n; i += width) {
+    ::std::size_t m = n - i < width ? n - i : width;
+    const D *p = x + i;
+    if (m < width) {
+      for (::std::size_t k = 0; k < width; ++k) {
+        a[k] = k < m ? x[i + k] : D(1);
+      }
+      p = a;
+    }
+    typename V::vector c = V::set(0);
+    typename V::vector v = F::template vector< V >(V::load(p), &c, fast);
+    if (m == width && !V::any(c)) {
+      V::store(x + i, v);
+      continue;
+    }
+    V::store(y, v);
+    V::store(bad, c);
+    for (::std::size_t k = 0; k < m; ++k) {
+      x[i + k] = bad[k] != 0 ? F::template scalar< V >(x[i + k]) : y[k];
+    }
+  }
+}
+
+template < typename V >
+void unaryKernel(Function f, typename V::value_type *x, ::std::size_t n,
+                 bool fast) {
+  switch (f) {
+    case EXP:
+      unaryKernel< V, Exp >(x, n, fast);
+      break;
+    case LOG:
+      unaryKernel< V, Log >(x, n, fast);
+      break;
+    case SQRT:
+      unaryKernel< V, Sqrt >(x, n, fast);
+      break;
+    case SIN:
+      unaryKernel< V, Sin >(x, n, fast);
+      break;
+    case COS:
+      unaryKernel< V, Cos >(x, n, fast);
+      break;
+    case TANH:
+      unaryKernel< V, Tanh >(x, n, fast);
+      break;
+    case ERF:
+      unaryKernel< V, Erf >(x, n, fast);
+      break;
+    default:
+      break;
+  }
+}
+
+// Scalar vector type used when no instruction set is available
+template < typename D >
+struct ScalarVector {
+  typedef D value_type;
+  typedef D vector;
+  static const ::std::size_t width = 1;
+
+  static vector load(const D *p) { return *p; }
+  static void store(D *p, vector a) { *p = a; }
+  static vector set(D a) { return a; }
+  static void transpose(vector *) {}
+  static vector add(vector a, vector b) { return a + b; }
+  static vector sub(vector a, vector b) { return a - b; }
+  static vector mul(vector a, vector b) { return a * b; }
+  static vector div(vector a, vector b) { return a / b; }
+  static vector fma(vector a, vector b, vector c) {
+    return Scalar< ScalarVector >::fma(a, b, c);
+  }
+  static vector fmax(vector a, vector b) {
+    return Scalar< ScalarVector >::fmax(a, b);
+  }
+  static vector fmin(vector a, vector b) {
+    return Scalar< ScalarVector >::fmin(a, b);
+  }
+  static vector isgreater(vector a, vector b) { return a > b; }
+  static vector isgreaterequal(vector a, vector b) { return a >= b; }
+  static vector isless(vector a, vector b) { return a < b; }
+  static vector islessequal(vector a, vector b) { return a <= b; }
+  static vector islessgreater(vector a, vector b) { return a < b || a > b; }
+  static vector isunordered(vector a, vector b) {
+    return a != a || b != b;
+  }
+  static vector abs(vector a) { return a < 0 ? -a : a; }
+  static bool any(vector a) { return a != 0; }
+  static vector choose(vector c, vector a, vector b) { return c != 0 ? a : b; }
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = a0;
+    *im = a1;
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = re;
+    *a1 = im;
+  }
+  static vector sqrt(vector a) { return Scalar< ScalarVector >::sqrt(a); }
+  static vector madd(vector a, vector b, vector c) { return a * b + c; }
+  static vector pow2(vector k) {
+    return Scalar< ScalarVector >::ldexp(D(1), static_cast< int >(k));
+  }
+  static vector exponent(vector a) {
+    int e = 0;
+    Scalar< ScalarVector >::frexp(a, &e);
+    return e - 1;
+  }
+  static vector significand(vector a) {
+    int e = 0;
+    return Scalar< ScalarVector >::frexp(a, &e) * 2;
+  }
+};
+
+// Defines the entry points of an instruction set from its vector types
+#define THUNDER_TENSOR_SIMD_DEFINE_INSTRUCTION(DoubleVector, FloatVector) \
+  void binary(Operation op, double *x, const double *y, ::std::size_t n) { \
+    binaryKernel< DoubleVector >(op, x, y, n);                          \
+  }                                                                     \
+  void binary(Operation op, double *x, double y, ::std::size_t n) {     \
+    binaryKernel< DoubleVector >(op, x, y, n);                          \
+  }                                                                     \
+  void binary(Operation op, float *x, const float *y, ::std::size_t n) { \
+    binaryKernel< FloatVector >(op, x, y, n);                           \
+  }                                                                     \
+  void binary(Operation op, float *x, float y, ::std::size_t n) {       \
+    binaryKernel< FloatVector >(op, x, y, n);                           \
+  }                                                                     \
+  void fma(double *x, const double *y, double y_value, const double *z, \
+           double z_value, ::std::size_t n) {                           \
+    fmaKernel< DoubleVector >(x, y, y_value, z, z_value, n);            \
+  }                                                                     \
+  void fma(float *x, const float *y, float y_value, const float *z,     \
+           float z_value, ::std::size_t n) {                            \
+    fmaKernel< FloatVector >(x, y, y_value, z, z_value, n);             \
+  }                                                                     \
+  void transpose(double *x, ::std::ptrdiff_t x_stride, const double *y, \
+                 ::std::ptrdiff_t y_stride, ::std::size_t m,            \
+                 ::std::size_t n) {                                     \
+    transposeKernel< DoubleVector >(x, x_stride, y, y_stride, m, n);    \
+  }                                                                     \
+  void transpose(float *x, ::std::ptrdiff_t x_stride, const float *y,   \
+                 ::std::ptrdiff_t y_stride, ::std::size_t m,            \
+                 ::std::size_t n) {                                     \
+    transposeKernel< FloatVector >(x, x_stride, y, y_stride, m, n);     \
+  }                                                                     \
+  void gemm(::std::size_t kc, const double *a, const double *b,        \
+            double *c, ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, \
+            ::std::size_t m, ::std::size_t n, double alpha) {           \
+    gemmKernel< DoubleVector >(kc, a, b, c, c_row, c_column, m, n, alpha); \
+  }                                                                     \
+  void gemm(::std::size_t kc, const float *a, const float *b, float *c, \
+            ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column,          \
+            ::std::size_t m, ::std::size_t n, float alpha) {            \
+    gemmKernel< FloatVector >(kc, a, b, c, c_row, c_column, m, n, alpha); \
+  }                                                                     \
+  void complexBinary(Operation op, double *x, const double *y,          \
+                     double y_real, double y_imag, ::std::size_t n,     \
+                     bool fast) {                                       \
+    complexBinaryKernel< DoubleVector >(op, x, y, y_real, y_imag, n, fast); \
+  }                                                                     \
+  void complexBinary(Operation op, float *x, const float *y,            \
+                     float y_real, float y_imag, ::std::size_t n,       \
+                     bool fast) {                                       \
+    complexBinaryKernel< FloatVector >(op, x, y, y_real, y_imag, n, fast); \
+  }                                                                     \
+  void complexFma(double *x, const double *y, double y_real,            \
+                  double y_imag, const double *z, double z_real,        \
+                  double z_imag, ::std::size_t n, bool fast) {          \
+    complexFmaKernel< DoubleVector >(x, y, y_real, y_imag, z, z_real,   \
+                                     z_imag, n, fast);                  \
+  }                                                                     \
+  void complexFma(float *x, const float *y, float y_real, float y_imag, \
+                  const float *z, float z_real, float z_imag,           \
+                  ::std::size_t n, bool fast) {                         \
+    complexFmaKernel< FloatVector >(x, y, y_real, y_imag, z, z_real,    \
+                                    z_imag, n, fast);                   \
+  }                                                                     \
+  void complexConj(double *x, ::std::size_t n) {                        \
+    complexConjKernel< DoubleVector >(x, n);                            \
+  }                                                                     \
+  void complexConj(float *x, ::std::size_t n) {                         \
+    complexConjKernel< FloatVector >(x, n);                             \
+  }                                                                     \
+  void complexCnrm(double *x, ::std::size_t n) {                        \
+    complexCnrmKernel< DoubleVector >(x, n);                            \
+  }                                                                     \
+  void complexCnrm(float *x, ::std::size_t n) {                         \
+    complexCnrmKernel< FloatVector >(x, n);                             \
+  }                                                                     \
+  void unary(Function f, double *x, ::std::size_t n, bool fast) {       \
+    unaryKernel< DoubleVector >(f, x, n, fast);                         \
+  }                                                                     \
+  void unary(Function f, float *x, ::std::size_t n, bool fast) {        \
+    unaryKernel< FloatVector >(f, x, n, fast);                          \
+  }
+
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_SIMD_KERNEL_HPP_
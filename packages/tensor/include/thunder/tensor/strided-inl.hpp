@@ -0,0 +1,95 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_STRIDED_INL_HPP_
+#define THUNDER_TENSOR_STRIDED_INL_HPP_
+
+#include "thunder/tensor/strided.hpp"
+
+#include <algorithm>
+
+namespace thunder {
+namespace tensor {
+
+template < typename T >
+StridedCursor< T >::StridedCursor(const T &x, size_type index)
+    : data_(x.data()) {
+  // Collapse from the innermost dimension, skipping singleton ones
+  for (typename T::dim_type i = x.dimension(); i > 0; --i) {
+    size_type sz = x.size(i - 1);
+    difference_type st = x.stride(i - 1);
+    if (sz == 1) {
+      continue;
+    }
+    if (!size_.empty() && st == stride_.back() *
+        static_cast< difference_type >(size_.back())) {
+      size_.back() *= sz;
+    } else {
+      size_.push_back(sz);
+      stride_.push_back(st);
+    }
+  }
+  if (size_.empty()) {
+    size_.push_back(1);
+    stride_.push_back(1);
+  }
+  ::std::reverse(size_.begin(), size_.end());
+  ::std::reverse(stride_.begin(), stride_.end());
+  position_.resize(size_.size());
+  for (size_type i = size_.size() - 1; i > 0; --i) {
+    position_[i] = index % size_[i];
+    index = index / size_[i];
+    data_ += static_cast< difference_type >(position_[i]) * stride_[i];
+  }
+  position_[0] = index;
+  data_ += static_cast< difference_type >(position_[0]) * stride_[0];
+}
+
+template < typename T >
+typename StridedCursor< T >::pointer StridedCursor< T >::data() const {
+  return data_;
+}
+
+template < typename T >
+typename StridedCursor< T >::difference_type StridedCursor< T >::step() const {
+  return stride_.back();
+}
+
+template < typename T >
+typename StridedCursor< T >::size_type StridedCursor< T >::run() const {
+  return size_.back() - position_.back();
+}
+
+template < typename T >
+void StridedCursor< T >::advance(size_type n) {
+  size_type i = size_.size() - 1;
+  position_[i] += n;
+  data_ += static_cast< difference_type >(n) * stride_[i];
+  while (i > 0 && position_[i] >= size_[i]) {
+    data_ -= static_cast< difference_type >(position_[i]) * stride_[i];
+    position_[i] = 0;
+    ++position_[--i];
+    data_ += stride_[i];
+  }
+}
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_STRIDED_INL_HPP_
@@ -0,0 +1,59 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#ifndef THUNDER_TENSOR_STRIDED_HPP_
+#define THUNDER_TENSOR_STRIDED_HPP_
+
+#include <vector>
+
+namespace thunder {
+namespace tensor {
+
+// Traversal of a tensor in the order of its reference iterators. Dimensions
+// that are contiguous with each other are collapsed, and a running pointer is
+// kept, so that elements are visited in runs of equal stride.
+template < typename T >
+class StridedCursor {
+ public:
+  typedef typename T::pointer pointer;
+  typedef typename T::size_type size_type;
+  typedef typename T::difference_type difference_type;
+
+  // Start at the element with the given linear index
+  explicit StridedCursor(const T &x, size_type index = 0);
+
+  // Current element, and stride and remaining length of the current run
+  pointer data() const;
+  difference_type step() const;
+  size_type run() const;
+
+  // Move forward by n elements, where n is at most run()
+  void advance(size_type n);
+
+ private:
+  ::std::vector< size_type > size_;
+  ::std::vector< difference_type > stride_;
+  ::std::vector< size_type > position_;
+  pointer data_;
+};
+
+}  // namespace tensor
+}  // namespace thunder
+
+#endif  // THUNDER_TENSOR_STRIDED_HPP_
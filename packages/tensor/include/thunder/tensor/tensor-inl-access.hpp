@@ -73,7 +73,7 @@ typename Tensor< S >::reference Tensor< S >::operator()(
 
 template < typename S >
 typename Tensor< S >::reference Tensor< S >::operator()(
-    const size_storage &pos) const {
+    const small_size_storage &pos) const {
   size_type os = offset_;
   for (dim_type i = 0; i < pos.size(); ++i) {
     os += pos[i] * stride_[i];
@@ -85,37 +85,37 @@ template < typename S >
 Tensor< S > Tensor< S >::operator[](size_type pos) const {
   size_type os = offset_ + pos * stride_[0];
   if (size_.size() > 1) {
-    size_storage sz(size_.size()-1);
-    stride_storage st(stride_.size()-1);
+    small_size_storage sz(size_.size()-1);
+    small_stride_storage st(stride_.size()-1);
     for (dim_type i = 0; i < sz.size(); ++i) {
       sz[i] = size_[i + 1];
       st[i] = stride_[i + 1];
     }
     return Tensor(sz, st, storage_, os);
   } else {
-    size_storage sz(1, 1);
-    stride_storage st(1, 1);
+    small_size_storage sz(1, 1);
+    small_stride_storage st(1, 1);
     return Tensor(sz, st, storage_, os);
   }
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::operator[](const size_storage &pos) const {
+Tensor< S > Tensor< S >::operator[](const small_size_storage &pos) const {
   size_type os = offset_;
   for (dim_type i = 0; i < pos.size(); ++i) {
     os += pos[i] * stride_[i];
   }
   if (size_.size() > pos.size()) {
-    size_storage sz(size_.size() - pos.size());
-    stride_storage st(stride_.size() - pos.size());
+    small_size_storage sz(size_.size() - pos.size());
+    small_stride_storage st(stride_.size() - pos.size());
     for (dim_type i = 0; i < sz.size(); ++i) {
       sz[i] = size_[pos.size() + i];
       st[i] = stride_[pos.size() + i];
     }
     return Tensor(sz, st, storage_, os);
   } else {
-    size_storage sz(1, 1);
-    stride_storage st(1, 1);
+    small_size_storage sz(1, 1);
+    small_stride_storage st(1, 1);
     return Tensor(sz, st, storage_, os);
   }
 }
@@ -124,7 +124,7 @@ template < typename S >
 Tensor< S > Tensor< S >::operator[](
     const Storage< ::std::pair< size_type, size_type > > &range) const {
   size_type os = offset_;
-  size_storage sz(size_);
+  small_size_storage sz(size_);
   for (dim_type i = 0; i < range.size(); ++i) {
     os = os + range[i].first * stride_[i];
     sz[i] = range[i].second - range[i].first + 1;
@@ -21,142 +21,150 @@
 #define THUNDER_TENSOR_TENSOR_INL_APPLY_HPP_
 
 #include "thunder/tensor/tensor.hpp"
-#include "thunder/tensor/tensor-inl.hpp"
+
+#include <type_traits>
+
+#include "thunder/exception.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
 
 namespace thunder {
 namespace tensor {
 
-template< typename S >
-const Tensor< S >& Tensor< S >::apply(
-    const ::std::function< value_type(value_type) > &lambda) const {
-  if (partialContiguity(0, size_.size() - 1)) {
-    pointer data_pointer = data();
-    size_type data_length = length();
-    difference_type step = stride_[stride_.size() - 1];
-    for (size_type i = 0; i < data_length; ++i) {
-      data_pointer[i * step] = lambda(data_pointer[i * step]);
-    }
-  } else {
-    for (reference_iterator begin = reference_begin(), end = reference_end();
-         begin != end; ++begin) {
-      *begin = lambda(*begin);
-    }
+// Element calls are resolved at compile time. Reference forms are preferred
+// over the pointer form.
+template < typename F, typename D >
+auto applyElement(F &f, D &value, int) -> typename ::std::enable_if<
+  ::std::is_void< decltype(f(value)) >::value >::type {
+  f(value);
+}
+
+template < typename F, typename D >
+auto applyElement(F &f, D &value, int) -> typename ::std::enable_if<
+  !::std::is_void< decltype(f(value)) >::value >::type {
+  value = f(value);
+}
+
+template < typename F, typename D >
+void applyElement(F &f, D &value, long) {
+  f(&value);
+}
+
+template < typename P, typename T, typename F >
+void applyTensor(P policy, const T &x, F &f) {
+  parallel::forEach(policy, x, [&f](typename T::reference x_value) {
+      applyElement(f, x_value, 0);
+    });
+}
+
+template < typename P, typename T, typename T1, typename F >
+void zipApplyBinary(P policy, const T &r, const T &x, const T1 &y, F &f) {
+  if (x.length() != y.length()) {
+    throw out_of_range("Tensors have different length.");
   }
-  return *this;
+  parallel::forEach(
+      policy, r, x, y,
+      [&f](typename T::reference r_value, typename T::reference x_value,
+           typename T1::reference y_value) {
+        r_value = f(x_value, y_value);
+      });
 }
 
-template< typename S >
-const Tensor< S >& Tensor< S >:: apply(
-    const ::std::function< value_type(const value_type&) > &lambda) const {
-  if (partialContiguity(0, size_.size() - 1)) {
-    pointer data_pointer = data();
-    size_type data_length = length();
-    difference_type step = stride_[stride_.size() - 1];
-    for (size_type i = 0; i < data_length; ++i) {
-      data_pointer[i * step] = lambda(data_pointer[i * step]);
-    }
-  } else {
-    for (reference_iterator begin = reference_begin(), end = reference_end();
-         begin != end; ++begin) {
-      *begin = lambda(*begin);
-    }
+// The result r already holds a copy of x
+template < typename P, typename T, typename T1, typename T2, typename F >
+void zipApplyTernary(P policy, const T &r, const T1 &y, const T2 &z, F &f) {
+  if (r.length() != y.length() || r.length() != z.length()) {
+    throw out_of_range("Tensors have different length.");
   }
-  return *this;
+  parallel::forEach(
+      policy, r, y, z,
+      [&f](typename T::reference r_value, typename T1::reference y_value,
+           typename T2::reference z_value) {
+        r_value = f(r_value, y_value, z_value);
+      });
 }
 
 template< typename S >
-const Tensor< S >& Tensor< S >::apply(
-    const ::std::function< void(value_type&) > &lambda) const {
-  if (partialContiguity(0, size_.size() - 1)) {
-    pointer data_pointer = data();
-    size_type data_length = length();
-    difference_type step = stride_[stride_.size() - 1];
-    for (size_type i = 0; i < data_length; ++i) {
-      lambda(data_pointer[i * step]);
-    }
-  } else {
-    for (reference_iterator begin = reference_begin(), end = reference_end();
-         begin != end; ++begin) {
-      lambda(*begin);
-    }
-  }
+template< typename F >
+const Tensor< S >& Tensor< S >::apply(F &&f) const {
+  detach();
+  applyTensor(parallel::sequential, *this, f);
   return *this;
 }
 
 template< typename S >
-const Tensor< S >& Tensor< S >::apply(
-    const ::std::function< void(value_type*) > &lambda) const {
-  if (partialContiguity(0, size_.size() - 1)) {
-    pointer data_pointer = data();
-    size_type data_length = length();
-    difference_type step = stride_[stride_.size() - 1];
-    for (size_type i = 0; i < data_length; ++i) {
-      lambda(data_pointer + i * step);
-    }
-  } else {
-    for (reference_iterator begin = reference_begin(), end = reference_end();
-         begin != end; ++begin) {
-      lambda(&(*begin));
-    }
-  }
+template< typename F >
+const Tensor< S >& Tensor< S >::apply(parallel::Concurrent, F &&f) const {
+  detach();
+  applyTensor(parallel::concurrent, *this, f);
   return *this;
 }
 
-
 template< typename S >
-Tensor< S >& Tensor< S >::apply(
-    const ::std::function< value_type(value_type) > &lambda) {
+template< typename F >
+Tensor< S >& Tensor< S >::apply(F &&f) {
   return const_cast< Tensor& >(
-      const_cast< const Tensor* >(this)->apply(lambda));
+      const_cast< const Tensor* >(this)->apply(::std::forward< F >(f)));
 }
 
 template< typename S >
-Tensor< S >& Tensor< S >::apply(
-    const ::std::function< value_type(const value_type&) > &lambda) {
+template< typename F >
+Tensor< S >& Tensor< S >::apply(parallel::Concurrent c, F &&f) {
   return const_cast< Tensor& >(
-      const_cast< const Tensor* >(this)->apply(lambda));
+      const_cast< const Tensor* >(this)->apply(c, ::std::forward< F >(f)));
 }
 
+// Static lambda applications are delegated
 template< typename S >
-Tensor< S >& Tensor< S >::apply(
-    const ::std::function< void(value_type&) > &lambda) {
-  return const_cast< Tensor& >(
-      const_cast< const Tensor* >(this)->apply(lambda));
+template< typename F >
+Tensor< S > Tensor< S >::apply(const Tensor &x, F &&f) {
+  return x.clone().apply(::std::forward< F >(f));
 }
 
 template< typename S >
-Tensor< S >& Tensor< S >::apply(
-    const ::std::function< void(value_type*) > &lambda) {
-  return const_cast< Tensor& >(
-      const_cast< const Tensor* >(this)->apply(lambda));
+template< typename F >
+Tensor< S > Tensor< S >::apply(parallel::Concurrent c, const Tensor &x,
+                               F &&f) {
+  return x.clone().apply(c, ::std::forward< F >(f));
 }
 
-// Static lambda applications are delegated
 template< typename S >
-Tensor< S > Tensor< S >::apply(
-    const Tensor& x, const ::std::function< value_type(value_type) > &lambda) {
-  return x.clone().apply(lambda);
+template< typename S1, typename F >
+Tensor< S > Tensor< S >::zip_apply(const Tensor &x, const Tensor< S1 > &y,
+                                   F &&f) {
+  Tensor r(x.size());
+  zipApplyBinary(parallel::sequential, r, x, y, f);
+  return r;
 }
 
 template< typename S >
-Tensor< S > Tensor< S >::apply(
-    const Tensor &x,
-    const ::std::function< value_type(const value_type&) > &lambda) {
-  return x.clone().apply(lambda);
+template< typename S1, typename F >
+Tensor< S > Tensor< S >::zip_apply(parallel::Concurrent, const Tensor &x,
+                                   const Tensor< S1 > &y, F &&f) {
+  Tensor r(x.size());
+  zipApplyBinary(parallel::concurrent, r, x, y, f);
+  return r;
 }
 
 template< typename S >
-Tensor< S > Tensor< S >::apply(
-    const Tensor &x,
-    const ::std::function< void(value_type&) > &lambda) {
-  return x.clone().apply(lambda);
+template< typename S1, typename S2, typename F >
+Tensor< S > Tensor< S >::zip_apply(const Tensor &x, const Tensor< S1 > &y,
+                                   const Tensor< S2 > &z, F &&f) {
+  Tensor r = x.clone();
+  r.detach();
+  zipApplyTernary(parallel::sequential, r, y, z, f);
+  return r;
 }
 
 template< typename S >
-Tensor< S > Tensor< S >::apply(
-    const Tensor &x,
-    const ::std::function< void(value_type*) > &lambda) {
-  return x.clone().apply(lambda);
+template< typename S1, typename S2, typename F >
+Tensor< S > Tensor< S >::zip_apply(parallel::Concurrent, const Tensor &x,
+                                   const Tensor< S1 > &y,
+                                   const Tensor< S2 > &z, F &&f) {
+  Tensor r = x.clone();
+  r.detach();
+  zipApplyTernary(parallel::concurrent, r, y, z, f);
+  return r;
 }
 
 }  // namespace tensor
@@ -33,6 +33,7 @@ namespace tensor {
 #define THUNDER_TENSOR_DEFINE_BINARY(func)                              \
   template < typename S >                                               \
   const Tensor< S >& Tensor< S >::func(const_reference y) const {       \
+    detach();                                                           \
     return math::func(*this, y);                                        \
   }                                                                     \
   template < typename S >                                               \
@@ -46,6 +47,7 @@ namespace tensor {
   }                                                                     \
   template < typename S >                                               \
   const Tensor< S >& Tensor< S >::func(const Tensor &y) const {         \
+    detach();                                                           \
     return math::func(*this, y);                                        \
   }                                                                     \
   template < typename S >                                               \
@@ -87,6 +89,7 @@ THUNDER_TENSOR_DEFINE_BINARY(isunordered);
 
 template < typename S >
 const Tensor< S >& Tensor< S >::fill(const_reference y) const {
+  detach();
   return math::fill(*this, y);
 }
 template < typename S >
@@ -101,6 +104,7 @@ Tensor< S > Tensor< S >::fill(const Tensor &x, const_reference y) {
 template < typename S >
 template < typename T >
 const Tensor< S >& Tensor< S >::copy(const T &y) const {
+  detach();
   return math::copy(*this, y);
 }
 template < typename S >
@@ -36,7 +36,7 @@ Tensor< S >::Tensor()
     : size_(1, 1), stride_(1, 1), storage_(new S(1)), offset_(0) {}
 
 template < typename S >
-Tensor< S >::Tensor(size_storage sz)
+Tensor< S >::Tensor(small_size_storage sz)
     : stride_(sz.size()), offset_(0) {
   ::std::swap(size_, sz);
   if (size_.size() == 0) {
@@ -57,19 +57,19 @@ Tensor< S >::Tensor(size_storage sz)
 }
 
 template < typename S >
-Tensor< S >::Tensor(size_type sz0) : Tensor(size_storage({sz0})) {}
+Tensor< S >::Tensor(size_type sz0) : Tensor(small_size_storage({sz0})) {}
 
 template < typename S >
 Tensor< S >::Tensor(size_type sz0, size_type sz1)
-    : Tensor(size_storage({sz0, sz1})) {}
+    : Tensor(small_size_storage({sz0, sz1})) {}
 
 template < typename S >
 Tensor< S >::Tensor(size_type sz0, size_type sz1, size_type sz2)
-    : Tensor(size_storage({sz0, sz1, sz2})) {}
+    : Tensor(small_size_storage({sz0, sz1, sz2})) {}
 
 template < typename S >
 Tensor< S >::Tensor(size_type sz0, size_type sz1, size_type sz2, size_type sz3)
-    : Tensor(size_storage({sz0, sz1, sz2, sz3})) {}
+    : Tensor(small_size_storage({sz0, sz1, sz2, sz3})) {}
 
 template < typename S >
 Tensor< S >::Tensor(storage_pointer s, size_type os)
@@ -84,7 +84,7 @@ Tensor< S >::Tensor(storage_pointer s, size_type os)
 }
 
 template < typename S >
-Tensor< S >::Tensor(size_storage sz, storage_pointer s, size_type os)
+Tensor< S >::Tensor(small_size_storage sz, storage_pointer s, size_type os)
     : stride_(sz.size()), offset_(os) {
   ::std::swap(size_, sz);
   ::std::swap(storage_, s);
@@ -111,7 +111,7 @@ Tensor< S >::Tensor(size_storage sz, storage_pointer s, size_type os)
 }
 
 template< typename S >
-Tensor< S >::Tensor(size_storage sz, stride_storage st) {
+Tensor< S >::Tensor(small_size_storage sz, small_stride_storage st) {
   ::std::swap(size_, sz);
   ::std::swap(stride_, st);
   if (size_.size() == 0) {
@@ -141,8 +141,8 @@ Tensor< S >::Tensor(size_storage sz, stride_storage st) {
 }
 
 template< typename S >
-Tensor< S >::Tensor(size_storage sz, stride_storage st, storage_pointer s,
-                    size_type os) : offset_(os) {
+Tensor< S >::Tensor(small_size_storage sz, small_stride_storage st,
+                    storage_pointer s, size_type os) : offset_(os) {
   ::std::swap(size_, sz);
   ::std::swap(stride_, st);
   ::std::swap(storage_, s);
@@ -120,22 +120,30 @@ typename Tensor< S >::iterator Tensor< S >::end(
 
 template < typename S >
 Tensor< S >::reference_iterator::reference_iterator(const Tensor &x)
-    : tensor_(&x), position_(x.size_.size(), 0) {}
+    : tensor_(&x), position_(x.size_.size(), 0), index_(0),
+      current_(x.data()) {}
 
 template < typename S >
 Tensor< S >::reference_iterator::reference_iterator(
-const Tensor &x, size_storage pos) : tensor_(&x) {
+const Tensor &x, small_size_storage pos)
+    : tensor_(&x), index_(0), current_(x.data()) {
   ::std::swap(position_, pos);
+  for (dim_type i = 0; i < position_.size(); ++i) {
+    index_ = index_ * x.size_[i] + position_[i];
+    current_ += static_cast< difference_type >(position_[i]) * x.stride_[i];
+  }
 }
 
 template < typename S >
 Tensor< S >::reference_iterator::reference_iterator(
     const reference_iterator& it)
-    : tensor_(it.tensor_), position_(it.position_) {}
+    : tensor_(it.tensor_), position_(it.position_), index_(it.index_),
+      current_(it.current_) {}
 
 template < typename S >
 Tensor< S >::reference_iterator::reference_iterator(reference_iterator &&it)
-    : tensor_(it.tensor_), position_(std::move(it.position_)) {}
+    : tensor_(it.tensor_), position_(std::move(it.position_)),
+      index_(it.index_), current_(it.current_) {}
 
 template < typename S >
 Tensor< S >::reference_iterator::~reference_iterator() {}
@@ -145,45 +153,38 @@ typename Tensor< S >::reference_iterator&
 Tensor< S >::reference_iterator::operator=(reference_iterator it) {
   tensor_ = it.tensor_;
   position_ = it.position_;
+  index_ = it.index_;
+  current_ = it.current_;
   return *this;
 }
 
+// Positions are compared through their linear index
 template < typename S >
 bool Tensor< S >::reference_iterator::operator==(
     const reference_iterator& it) const {
-  if (tensor_ != it.tensor_) {
-    return false;
-  }
-  for (dim_type i = 0; i < position_.size(); ++i) {
-    if (position_[i] != it.position_[i]) {
-      return false;
-    }
-  }
-  return true;
+  return tensor_ == it.tensor_ && index_ == it.index_;
 }
 
 template < typename S >
 bool Tensor< S >::reference_iterator::operator!=(
     const reference_iterator& it) const {
-  if (tensor_ != it.tensor_) {
-    return true;
-  }
-  for (dim_type i = 0; i < position_.size(); ++i) {
-    if (position_[i] != it.position_[i]) {
-      return true;
-    }
-  }
-  return false;
+  return tensor_ != it.tensor_ || index_ != it.index_;
 }
 
+// The current pointer is updated along with the position
 template < typename S >
 typename Tensor< S >::reference_iterator&
 Tensor< S >::reference_iterator::operator++() {
-  ++position_[position_.size() - 1];
   dim_type i = position_.size() - 1;
+  ++index_;
+  ++position_[i];
+  current_ += tensor_->stride_[i];
   while (i > 0 && position_[i] >= tensor_->size_[i]) {
+    current_ -= static_cast< difference_type >(position_[i]) *
+        tensor_->stride_[i];
     position_[i] = 0;
     ++position_[--i];
+    current_ += tensor_->stride_[i];
   }
   return *this;
 }
@@ -192,29 +193,24 @@ template < typename S >
 typename Tensor< S >::reference_iterator
 Tensor< S >::reference_iterator::operator++(int) {
   reference_iterator it(*this);
-  ++position_[position_.size() - 1];
-  dim_type i = position_.size() - 1;
-  while (i > 0 && position_[i] >= tensor_->size_[i]) {
-    position_[i] = 0;
-    ++position_[--i];
-  }
+  ++(*this);
   return it;
 }
 
 template < typename S >
 typename Tensor< S >::reference
 Tensor< S >::reference_iterator::operator*() const {
-  return (*tensor_)(position_);
+  return *current_;
 }
 
 template < typename S >
 typename Tensor< S >::pointer
 Tensor< S >::reference_iterator::operator->() const {
-  return &(*tensor_)(position_);
+  return current_;
 }
 
 template < typename S >
-typename Tensor< S >::size_storage
+typename Tensor< S >::small_size_storage
 Tensor< S >::reference_iterator::position() const {
   return position_;
 }
@@ -226,7 +222,7 @@ typename Tensor< S >::reference_iterator Tensor< S >::reference_begin() const {
 
 template < typename S >
 typename Tensor< S >::reference_iterator Tensor< S >::reference_end() const {
-  size_storage pos(size_.size());
+  small_size_storage pos(size_.size());
   for (dim_type i = 1; i < size_.size(); ++i) {
     pos[i] = 0;
   }
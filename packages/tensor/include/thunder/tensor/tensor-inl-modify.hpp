@@ -26,6 +26,8 @@
 #include <utility>
 
 #include "thunder/exception.hpp"
+#include "thunder/tensor/share.hpp"
+#include "thunder/tensor/share-inl.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -33,7 +35,7 @@ namespace tensor {
 template < typename S >
 template < typename T >
 Tensor< S >& Tensor< S >::resizeAs(const T &y) {
-  size_storage sz(y.dimension());
+  small_size_storage sz(y.dimension());
   for (dim_type i = 0; i < sz.size(); ++i) {
     sz[i] = static_cast< size_type >(y.size(i));
   }
@@ -72,8 +74,8 @@ Tensor< S >& Tensor< S >::set(storage_pointer s, size_type os) {
 
 template < typename S >
 Tensor< S >& Tensor< S >::set(
-    size_storage sz, storage_pointer s, size_type os) {
-  stride_storage st(sz.size());
+    small_size_storage sz, storage_pointer s, size_type os) {
+  small_stride_storage st(sz.size());
   st[st.size() - 1] = 1;
   for (dim_type i = st.size() - 1; i > 0; --i) {
     st[i - 1] = sz[i] * st[i];
@@ -83,7 +85,8 @@ Tensor< S >& Tensor< S >::set(
 
 template < typename S >
 Tensor< S >& Tensor< S >::set(
-    size_storage sz, stride_storage st, storage_pointer s, size_type os) {
+    small_size_storage sz, small_stride_storage st, storage_pointer s,
+    size_type os) {
   if (s == nullptr) {
     throw invalid_argument("Storage is nullptr.");
   }
@@ -115,8 +118,8 @@ Tensor< S >& Tensor< S >::set(
 }
 
 template < typename S >
-Tensor< S >& Tensor< S >::resize(size_storage sz) {
-  stride_storage st(sz.size());
+Tensor< S >& Tensor< S >::resize(small_size_storage sz) {
+  small_stride_storage st(sz.size());
   st[st.size() - 1] = 1;
   for (dim_type i = st.size() - 1; i > 0; --i) {
     st[i - 1] = sz[i] * st[i];
@@ -126,27 +129,28 @@ Tensor< S >& Tensor< S >::resize(size_storage sz) {
 
 template < typename S >
 Tensor< S >& Tensor< S >::resize(size_type sz) {
-  return resize(size_storage({sz}));
+  return resize(small_size_storage({sz}));
 }
 
 template < typename S >
 Tensor< S >& Tensor< S >::resize(size_type sz0, size_type sz1) {
-  return resize(size_storage({sz0, sz1}));
+  return resize(small_size_storage({sz0, sz1}));
 }
 
 template < typename S >
 Tensor< S >& Tensor< S >::resize(size_type sz0, size_type sz1, size_type sz2) {
-  return resize(size_storage({sz0, sz1, sz2}));
+  return resize(small_size_storage({sz0, sz1, sz2}));
 }
 
 template < typename S >
 Tensor< S >& Tensor< S >::resize(
     size_type sz0, size_type sz1, size_type sz2, size_type sz3) {
-  return resize(size_storage({sz0, sz1, sz2, sz3}));
+  return resize(small_size_storage({sz0, sz1, sz2, sz3}));
 }
 
 template < typename S >
-Tensor< S >& Tensor< S >::resize(size_storage sz, stride_storage st) {
+Tensor< S >& Tensor< S >::resize(
+    small_size_storage sz, small_stride_storage st) {
   if (sz.size() == 0) {
     throw invalid_argument("Size is empty.");
   }
@@ -206,8 +210,8 @@ template < typename S >
 Tensor< S >& Tensor< S >::squeeze() {
   for (dim_type i = 0; i < size_.size() && size_.size() > 1; ++i) {
     if (size_[i] == 1) {
-      size_storage sz(size_.size() - 1);
-      stride_storage st(stride_.size() - 1);
+      small_size_storage sz(size_.size() - 1);
+      small_stride_storage st(stride_.size() - 1);
       for (dim_type j = 0; j < i; ++j) {
         sz[j] = size_[j];
         st[j] = stride_[j];
@@ -232,10 +236,24 @@ Tensor< S >& Tensor< S >::unique() {
     ::std::swap(stride_, t.stride_);
     ::std::swap(storage_, t.storage_);
     ::std::swap(offset_, t.offset_);
+  } else {
+    share::detach(storage_);
   }
   return *this;
 }
 
+template < typename S >
+const Tensor< S >& Tensor< S >::detach() const {
+  share::detach(storage_);
+  return *this;
+}
+
+template < typename S >
+Tensor< S >& Tensor< S >::detach() {
+  share::detach(storage_);
+  return *this;
+}
+
 template < typename S >
 Tensor< S >& Tensor< S >::set(Tensor *x, const Tensor &y) {
   return x->set(y);
@@ -248,19 +266,19 @@ Tensor< S >& Tensor< S >::set(Tensor *x, storage_pointer s, size_type os) {
 
 template < typename S >
 Tensor< S >& Tensor< S >::set(
-    Tensor *x, size_storage sz, storage_pointer s, size_type os) {
+    Tensor *x, small_size_storage sz, storage_pointer s, size_type os) {
   return x->set(sz, s, os);
 }
 
 template < typename S >
 Tensor< S >& Tensor< S >::set(
-    Tensor *x, size_storage sz, stride_storage st, storage_pointer s,
-    size_type os) {
+    Tensor *x, small_size_storage sz, small_stride_storage st,
+    storage_pointer s, size_type os) {
   return x->set(sz, st, s, os);
 }
 
 template < typename S >
-Tensor< S >& Tensor< S >::resize(Tensor *x, size_storage sz) {
+Tensor< S >& Tensor< S >::resize(Tensor *x, small_size_storage sz) {
   return x->resize(sz);
 }
 
@@ -288,7 +306,7 @@ Tensor< S >& Tensor< S >::resize(
 
 template < typename S >
 Tensor< S >& Tensor< S >::resize(
-    Tensor *x, size_storage sz, stride_storage st) {
+    Tensor *x, small_size_storage sz, small_stride_storage st) {
   return x->resize(sz, st);
 }
 
@@ -307,6 +325,11 @@ Tensor< S >& Tensor< S >::unique(Tensor *x) {
   return x->unique();
 }
 
+template < typename S >
+Tensor< S >& Tensor< S >::detach(Tensor *x) {
+  return x->detach();
+}
+
 }  // namespace tensor
 }  // namespace thunder
 
@@ -26,28 +26,6 @@
 namespace thunder {
 namespace tensor {
 
-template < typename S >
-Tensor< S > Tensor< S >::operator+(const_reference value) const {
-  return clone().add(value);
-}
-
-template < typename S >
-Tensor< S > Tensor< S >::operator-(const_reference value) const {
-  return clone().sub(value);
-}
-
-template < typename S >
-Tensor< S > operator+(
-    typename Tensor< S >::const_reference value, const Tensor< S > &x) {
-  return x.clone().add(value);
-}
-
-template < typename S >
-Tensor< S > operator-(
-    typename Tensor< S >::const_reference value, const Tensor< S > &x) {
-  return x.clone().sub(value).mul(-1);
-}
-
 template < typename S >
 const Tensor< S >& Tensor< S >::operator+=(const_reference value) const {
   return add(value);
@@ -68,16 +46,6 @@ Tensor< S >& Tensor< S >::operator-=(const_reference value) {
   return sub(value);
 }
 
-template < typename S >
-Tensor< S > Tensor< S >::operator+(const Tensor &y) const {
-  return clone().add(y);
-}
-
-template < typename S >
-Tensor< S > Tensor< S >::operator-(const Tensor &y) const {
-  return clone().sub(y);
-}
-
 template < typename S >
 const Tensor< S >& Tensor< S >::operator+=(const Tensor &y) const {
   return add(y);
@@ -24,6 +24,8 @@
 #include "thunder/tensor/tensor-inl.hpp"
 
 #include "thunder/exception.hpp"
+#include "thunder/tensor/share.hpp"
+#include "thunder/tensor/share-inl.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -54,7 +56,7 @@ typename Tensor< S >::dim_type Tensor< S >::dimension() const {
 }
 
 template < typename S >
-typename Tensor< S >::size_storage Tensor< S >::size() const {
+typename Tensor< S >::small_size_storage Tensor< S >::size() const {
   return size_;
 }
 
@@ -76,7 +78,7 @@ typename Tensor< S >::size_type Tensor< S >::length() const {
 }
 
 template < typename S >
-typename Tensor< S >::stride_storage Tensor< S >::stride() const {
+typename Tensor< S >::small_stride_storage Tensor< S >::stride() const {
   return stride_;
 }
 
@@ -146,7 +148,7 @@ typename Tensor< S >::reference Tensor< S >::get(
 }
 template < typename S >
 typename Tensor< S >::reference Tensor< S >::get(
-    const size_storage &pos) const {
+    const small_size_storage &pos) const {
   if (size_.size() < pos.size()) {
     throw out_of_range("Position exceeds size limit.");
   }
@@ -197,7 +199,12 @@ bool Tensor< S >::partialContiguity(dim_type a, dim_type b) const {
 
 template < typename S >
 bool Tensor< S >::isUnique() const {
-  return storage_.unique();
+  return storage_.unique() && !share::isShared(storage_);
+}
+
+template < typename S >
+bool Tensor< S >::isShared() const {
+  return share::isShared(storage_);
 }
 
 template < typename S >
@@ -206,7 +213,7 @@ typename Tensor< S >::dim_type Tensor< S >::dimension(const Tensor &x) {
 }
 
 template < typename S >
-typename Tensor< S >::size_storage Tensor< S >::size(const Tensor &x) {
+typename Tensor< S >::small_size_storage Tensor< S >::size(const Tensor &x) {
   return x.size();
 }
 
@@ -222,7 +229,8 @@ typename Tensor< S >::size_type Tensor< S >::length(const Tensor &x) {
 }
 
 template < typename S >
-typename Tensor< S >::stride_storage Tensor< S >::stride(const Tensor &x) {
+typename Tensor< S >::small_stride_storage Tensor< S >::stride(
+    const Tensor &x) {
   return x.stride();
 }
 
@@ -279,7 +287,7 @@ typename Tensor< S >::reference Tensor< S >::get(
 
 template < typename S >
 typename Tensor< S >::reference Tensor< S >::get(
-    const Tensor &x, const size_storage &pos) {
+    const Tensor &x, const small_size_storage &pos) {
   return x.get(pos);
 }
 
@@ -298,6 +306,11 @@ bool Tensor< S >::isUnique(const Tensor &x) {
   return x.isUnique();
 }
 
+template < typename S >
+bool Tensor< S >::isShared(const Tensor &x) {
+  return x.isShared();
+}
+
 }  // namespace tensor
 }  // namespace thunder
 
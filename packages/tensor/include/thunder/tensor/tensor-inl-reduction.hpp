@@ -25,6 +25,7 @@
 
 #include <limits>
 #include <cmath>
+#include <utility>
 
 #include "thunder/exception.hpp"
 #include "thunder/tensor/index_iterator.hpp"
@@ -102,6 +103,50 @@ THUNDER_TENSOR_DEFINE_REDUCTION(std);
 
 #undef THUNDER_TENSOR_DEFINE_REDUCTION
 
+template < typename S >
+typename Tensor< S >::value_type Tensor< S >::sum(
+    reduction::Summation summation) const {
+  return math::sum(*this, summation);
+}
+template < typename S >
+typename Tensor< S >::value_type Tensor< S >::sum(
+    const Tensor &x, reduction::Summation summation) {
+  return x.sum(summation);
+}
+template < typename S >
+typename Tensor< S >::value_type Tensor< S >::mean(
+    reduction::Summation summation) const {
+  return math::mean(*this, summation);
+}
+template < typename S >
+typename Tensor< S >::value_type Tensor< S >::mean(
+    const Tensor &x, reduction::Summation summation) {
+  return x.mean(summation);
+}
+
+template < typename S >
+::std::pair< typename Tensor< S >::value_type,
+             typename Tensor< S >::value_type >
+Tensor< S >::meanVar() const {
+  return math::meanVar(*this);
+}
+template < typename S >
+::std::pair< typename Tensor< S >::value_type,
+             typename Tensor< S >::value_type >
+Tensor< S >::meanVar(const Tensor &x) {
+  return x.meanVar();
+}
+template < typename S >
+::std::pair< Tensor< S >, Tensor< S > > Tensor< S >::meanVar(
+    dim_type d) const {
+  return math::meanVar(*this, d);
+}
+template < typename S >
+::std::pair< Tensor< S >, Tensor< S > > Tensor< S >::meanVar(
+    const Tensor &x, dim_type d) {
+  return x.meanVar(d);
+}
+
 }  // namespace tensor
 }  // namespace thunder
 
@@ -42,9 +42,9 @@ template < typename C, typename S >
 void load(C *s, tensor::Tensor< S > *t) {
   typedef tensor::Tensor< S > T;
 
-  typename T::size_storage size;
+  typename T::small_size_storage size;
   s->load(&size);
-  typename T::stride_storage stride;
+  typename T::small_stride_storage stride;
   s->load(&stride);
   typename T::storage_pointer storage;
   s->load(&storage);
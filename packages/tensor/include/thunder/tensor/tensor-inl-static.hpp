@@ -50,7 +50,7 @@ Tensor< S > Tensor< S >::ones(
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::ones(const size_storage &sz) {
+Tensor< S > Tensor< S >::ones(const small_size_storage &sz) {
   return Tensor(sz).fill(1);
 }
 
@@ -76,7 +76,7 @@ Tensor< S > Tensor< S >::zeros(
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::zeros(const size_storage &sz) {
+Tensor< S > Tensor< S >::zeros(const small_size_storage &sz) {
   return Tensor(sz).zero();
 }
 
@@ -34,17 +34,20 @@ template < typename S >
 template < typename TR >
 const Tensor< S >& Tensor< S >::polar(
     typename TR::const_reference r, const TR& theta) const {
+  detach();
   return math::polar(*this, r, theta);
 }
 template < typename S >
 template < typename TR >
 const Tensor< S >& Tensor< S >::polar(
     const TR& r, typename TR::const_reference theta) const {
+  detach();
   return math::polar(*this, r, theta);
 }
 template < typename S >
 template < typename TR >
 const Tensor< S >& Tensor< S >::polar(const TR& r, const TR& theta) const {
+  detach();
   return math::polar(*this, r, theta);
 }
 
@@ -91,21 +94,25 @@ Tensor< S > Tensor< S >::polar(
 template < typename S >
 const Tensor< S >& Tensor< S >::polar(
     const_reference y, const_reference z) const {
+  detach();
   return math::polar(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::polar(
     const Tensor &y, const_reference z) const {
+  detach();
   return math::polar(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::polar(
     const_reference y, const Tensor& z) const {
+  detach();
   return math::polar(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::polar(
     const Tensor &y, const Tensor &z) const {
+  detach();
   return math::polar(*this, y, z);
 }
 
@@ -150,18 +157,22 @@ Tensor< S > Tensor< S >::polar(
 template < typename S >
 const Tensor< S >& Tensor< S >::fma(
     const_reference y, const_reference z) const {
+  detach();
   return math::fma(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::fma(const Tensor &y, const_reference z) const {
+  detach();
   return math::fma(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::fma(const_reference y, const Tensor& z) const {
+  detach();
   return math::fma(*this, y, z);
 }
 template < typename S >
 const Tensor< S >& Tensor< S >::fma(const Tensor &y, const Tensor &z) const {
+  detach();
   return math::fma(*this, y, z);
 }
 
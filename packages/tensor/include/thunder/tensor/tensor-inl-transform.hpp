@@ -29,6 +29,8 @@
 #include "thunder/tensor/complex.hpp"
 #include "thunder/tensor/index_iterator.hpp"
 #include "thunder/tensor/math.hpp"
+#include "thunder/tensor/share.hpp"
+#include "thunder/tensor/share-inl.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -36,8 +38,8 @@ namespace tensor {
 template < typename S >
 template < typename T >
 Tensor< S > Tensor< S >::viewAs(const T &y, size_type os) const {
-  size_storage sz(y.dimension());
-  stride_storage st(y.dimension());
+  small_size_storage sz(y.dimension());
+  small_stride_storage st(y.dimension());
   for (dim_type i = 0; i < sz.size(); ++i) {
     sz[i] = static_cast< size_type >(y.size(i));
     st[i] = static_cast< difference_type >(y.stride(i));
@@ -52,9 +54,9 @@ Tensor< S > Tensor< S >::viewAs(const Tensor &y, size_type os) const {
 
 template < typename S >
 template < typename T >
-Tensor< S > Tensor< S >::viewAs(const T &y, stride_storage st,
+Tensor< S > Tensor< S >::viewAs(const T &y, small_stride_storage st,
                                 size_type os) const {
-  size_storage sz(y.dimension());
+  small_size_storage sz(y.dimension());
   for (dim_type i = 0; i < sz.size(); ++i) {
     sz[i] = static_cast< size_type >(y.size(i));
   }
@@ -62,7 +64,7 @@ Tensor< S > Tensor< S >::viewAs(const T &y, stride_storage st,
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::viewAs(const Tensor &y, stride_storage st,
+Tensor< S > Tensor< S >::viewAs(const Tensor &y, small_stride_storage st,
                                 size_type os) const {
   return this->view(y.size(), st, os);
 }
@@ -119,14 +121,14 @@ Tensor< S > Tensor< S >::viewAs(
 
 template < typename S >
 template < typename T >
-Tensor< S > Tensor< S >::viewAs(const Tensor &x, const T &y, stride_storage st,
-                                size_type os) {
+Tensor< S > Tensor< S >::viewAs(const Tensor &x, const T &y,
+                                small_stride_storage st, size_type os) {
   return x.viewAs(y, st, os);
 }
 
 template < typename S >
 Tensor< S > Tensor< S >::viewAs(const Tensor &x, const Tensor &y,
-                                stride_storage st, size_type os) {
+                                small_stride_storage st, size_type os) {
   return x.viewAs(y, st, os);
 }
 
@@ -175,7 +177,7 @@ Tensor< S > Tensor< S >::narrow(dim_type dim, size_type pos,
   if (pos + size > size_[dim]) {
     throw out_of_range("Position and size exceed limit.");
   }
-  size_storage sz = size_;
+  small_size_storage sz = size_;
   sz[dim] = size;
   return Tensor(sz, stride_, storage_, offset_ + pos * stride_[dim]);
 }
@@ -189,12 +191,12 @@ Tensor< S > Tensor< S >::select(dim_type dim, size_type pos) const {
     throw out_of_range("Position exceed limit.");
   }
   if (size_.size() == 1) {
-    size_storage sz(1, 1);
-    stride_storage st(1, 1);
+    small_size_storage sz(1, 1);
+    small_stride_storage st(1, 1);
     return Tensor(sz, st, storage_, offset_ + pos * stride_[dim]);
   } else {
-    size_storage sz(size_.size() - 1);
-    stride_storage st(stride_.size() - 1);
+    small_size_storage sz(size_.size() - 1);
+    small_stride_storage st(stride_.size() - 1);
     for (dim_type i = 0; i < dim; ++i) {
       sz[i] = size_[i];
       st[i] = stride_[i];
@@ -209,46 +211,86 @@ Tensor< S > Tensor< S >::select(dim_type dim, size_type pos) const {
 
 template < typename S >
 Tensor< S > Tensor< S >::view(size_type sz0) const {
-  return Tensor(size_storage({sz0}), storage_, 0);
+  return Tensor(small_size_storage({sz0}), storage_, 0);
 }
 
 template < typename S >
 Tensor< S > Tensor< S >::view(size_type sz0, size_type sz1) const {
-  return Tensor(size_storage({sz0, sz1}), storage_, 0);
+  return Tensor(small_size_storage({sz0, sz1}), storage_, 0);
 }
 
 template < typename S >
 Tensor< S > Tensor< S >::view(
     size_type sz0, size_type sz1, size_type sz2) const {
-  return Tensor(size_storage({sz0, sz1, sz2}), storage_, 0);
+  return Tensor(small_size_storage({sz0, sz1, sz2}), storage_, 0);
 }
 
 template < typename S >
 Tensor< S > Tensor< S >::view(
     size_type sz0, size_type sz1, size_type sz2, size_type sz3) const {
-  return Tensor(size_storage({sz0, sz1, sz2, sz3}), storage_, 0);
+  return Tensor(small_size_storage({sz0, sz1, sz2, sz3}), storage_, 0);
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::view(size_storage sz, size_type os) const {
+Tensor< S > Tensor< S >::view(small_size_storage sz, size_type os) const {
   return Tensor(sz, storage_, os);
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::view(size_storage sz, stride_storage st,
+Tensor< S > Tensor< S >::view(small_size_storage sz, small_stride_storage st,
                               size_type os) const {
   return Tensor(sz, st, storage_, os);
 }
 
 template < typename S >
 Tensor< S > Tensor< S >::transpose(dim_type dim0, dim_type dim1) const {
-  size_storage sz(size_);
-  stride_storage st(stride_);
+  small_size_storage sz(size_);
+  small_stride_storage st(stride_);
   ::std::swap(sz[dim0], sz[dim1]);
   ::std::swap(st[dim0], st[dim1]);
   return Tensor(sz, st, storage_, offset_);
 }
 
+template < typename S >
+Tensor< S > Tensor< S >::permute(dim_type dim0, dim_type dim1) const {
+  return permute(small_size_storage({dim0, dim1}));
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(dim_type dim0, dim_type dim1,
+                                 dim_type dim2) const {
+  return permute(small_size_storage({dim0, dim1, dim2}));
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(dim_type dim0, dim_type dim1, dim_type dim2,
+                                 dim_type dim3) const {
+  return permute(small_size_storage({dim0, dim1, dim2, dim3}));
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(small_size_storage dims) const {
+  if (dims.size() != size_.size()) {
+    throw out_of_range("Dimension mismatches.");
+  }
+  // Dimension i of the result is dimension dims[i] of this tensor
+  small_size_storage sz(size_.size());
+  small_stride_storage st(stride_.size());
+  small_size_storage used(size_.size(), 0);
+  for (dim_type i = 0; i < dims.size(); ++i) {
+    if (dims[i] >= size_.size()) {
+      throw out_of_range("Dimension exceeds limit.");
+    }
+    if (used[dims[i]] != 0) {
+      throw invalid_argument("Dimension is repeated.");
+    }
+    used[dims[i]] = 1;
+    sz[i] = size_[dims[i]];
+    st[i] = stride_[dims[i]];
+  }
+  return Tensor(sz, st, storage_, offset_);
+}
+
 template < typename S >
 Tensor< S > Tensor< S >::unfold(dim_type dim, size_type size,
                                 size_type step) const {
@@ -258,8 +300,8 @@ Tensor< S > Tensor< S >::unfold(dim_type dim, size_type size,
   if (size > size_[dim]) {
     throw out_of_range("Size exceeds limit.");
   }
-  size_storage sz(size_.size() + 1);
-  stride_storage st(stride_.size() + 1);
+  small_size_storage sz(size_.size() + 1);
+  small_stride_storage st(stride_.size() + 1);
   for (dim_type i = 0; i < dim; ++i) {
     sz[i] = size_[i];
     st[i] = stride_[i];
@@ -277,6 +319,14 @@ Tensor< S > Tensor< S >::unfold(dim_type dim, size_type size,
 
 template < typename S >
 Tensor< S > Tensor< S >::clone() const {
+  // Copy-on-write clones only share storages that the tensor spans entirely
+  if (share::getCopyOnWrite() && offset_ == 0 && isContiguous() &&
+      length() == storage_->size()) {
+    storage_pointer s = share::lazy(storage_);
+    if (s != nullptr) {
+      return Tensor(size_, stride_, s, offset_);
+    }
+  }
   return Tensor(size_, stride_).copy(*this);
 }
 
@@ -298,7 +348,7 @@ Tensor< S > Tensor< S >::cat(const Tensor &y, dim_type dim) const {
       throw out_of_range("Size mismatches.");
     }
   }
-  size_storage sz(size_);
+  small_size_storage sz(size_);
   sz[dim] = size_[dim] + y.size(dim);
   Tensor t(sz);
   t.narrow(dim, 0, size_[dim]).copy(*this);
@@ -316,8 +366,8 @@ Tensor< S > Tensor< S >::reshape(size_type sz0) const {
     throw out_of_range("Length mismatches.");
   }
   return Tensor(
-      size_storage({sz0}), stride_storage({stride_[stride_.size() - 1]}),
-      storage_, offset_);
+      small_size_storage({sz0}),
+      small_stride_storage({stride_[stride_.size() - 1]}), storage_, offset_);
 }
 
 template < typename S >
@@ -329,10 +379,10 @@ Tensor< S > Tensor< S >::reshape(size_type sz0, size_type sz1) const {
   if (sz0 * sz1 != length()) {
     throw out_of_range("Length mismatches.");
   }
-  stride_storage st(2);
+  small_stride_storage st(2);
   st[1] = stride_[stride_.size() - 1];
   st[0] = sz1 * st[1];
-  return Tensor(size_storage({sz0, sz1}), st, storage_, offset_);
+  return Tensor(small_size_storage({sz0, sz1}), st, storage_, offset_);
 }
 
 template < typename S >
@@ -345,11 +395,11 @@ Tensor< S > Tensor< S >::reshape(size_type sz0, size_type sz1,
   if (sz0 * sz1 * sz2 != length()) {
     throw out_of_range("Length mismatches.");
   }
-  stride_storage st(3);
+  small_stride_storage st(3);
   st[2] = stride_[stride_.size() - 1];
   st[1] = sz2 * st[2];
   st[0] = sz1 * st[1];
-  return Tensor(size_storage({sz0, sz1, sz2}), st, storage_, offset_);
+  return Tensor(small_size_storage({sz0, sz1, sz2}), st, storage_, offset_);
 }
 
 template < typename S >
@@ -362,16 +412,17 @@ Tensor< S > Tensor< S >::reshape(size_type sz0, size_type sz1, size_type sz2,
   if (sz0 * sz1 * sz2 * sz3 != length()) {
     throw out_of_range("Length mismatches.");
   }
-  stride_storage st(4);
+  small_stride_storage st(4);
   st[3] = stride_[stride_.size() - 1];
   st[2] = sz3 * st[3];
   st[1] = sz2 * st[2];
   st[0] = sz1 * st[1];
-  return Tensor(size_storage({sz0, sz1, sz2, sz3}), st, storage_, offset_);
+  return Tensor(
+      small_size_storage({sz0, sz1, sz2, sz3}), st, storage_, offset_);
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::reshape(size_storage sz) const {
+Tensor< S > Tensor< S >::reshape(small_size_storage sz) const {
   if (!partialContiguity(0, size_.size() - 1)) {
     throw contiguity_error(
         "Reshaping is impossible because of non-contiguity.");
@@ -383,7 +434,7 @@ Tensor< S > Tensor< S >::reshape(size_storage sz) const {
   if (t_length != length()) {
     throw out_of_range("Length mismatches.");
   }
-  stride_storage st(sz.size());
+  small_stride_storage st(sz.size());
   st[st.size() - 1] = stride_[stride_.size() - 1];
   for (dim_type i = st.size() - 1; i > 0; --i) {
     st[i - 1] = sz[i] * st[i];
@@ -425,13 +476,14 @@ Tensor< S > Tensor< S >::view(const Tensor &x, size_type sz0, size_type sz1,
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::view(const Tensor &x, size_storage sz, size_type os) {
+Tensor< S > Tensor< S >::view(
+    const Tensor &x, small_size_storage sz, size_type os) {
   return x.view(sz, os);
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::view(const Tensor &x, size_storage sz,
-                              stride_storage st, size_type os) {
+Tensor< S > Tensor< S >::view(const Tensor &x, small_size_storage sz,
+                              small_stride_storage st, size_type os) {
   return x.view(sz, st, os);
 }
 
@@ -441,6 +493,29 @@ Tensor< S > Tensor< S >::transpose(const Tensor &x, dim_type dim0,
   return x.transpose(dim0, dim1);
 }
 
+template < typename S >
+Tensor< S > Tensor< S >::permute(const Tensor &x, dim_type dim0,
+                                 dim_type dim1) {
+  return x.permute(dim0, dim1);
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(const Tensor &x, dim_type dim0, dim_type dim1,
+                                 dim_type dim2) {
+  return x.permute(dim0, dim1, dim2);
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(const Tensor &x, dim_type dim0, dim_type dim1,
+                                 dim_type dim2, dim_type dim3) {
+  return x.permute(dim0, dim1, dim2, dim3);
+}
+
+template < typename S >
+Tensor< S > Tensor< S >::permute(const Tensor &x, small_size_storage dims) {
+  return x.permute(dims);
+}
+
 template < typename S >
 Tensor< S > Tensor< S >::unfold(const Tensor &x, dim_type dim, size_type size,
                                 size_type step) {
@@ -481,7 +556,7 @@ Tensor< S > Tensor< S >::reshape(const Tensor &x, size_type sz0, size_type sz1,
 }
 
 template < typename S >
-Tensor< S > Tensor< S >::reshape(const Tensor &x, size_storage sz) {
+Tensor< S > Tensor< S >::reshape(const Tensor &x, small_size_storage sz) {
   return x.reshape(sz);
 }
 
@@ -29,8 +29,8 @@ namespace tensor {
 template < typename S >
 template < typename T >
 T Tensor< S >::type() const {
-  typename T::size_storage sz(size_.size());
-  typename T::stride_storage st(stride_.size());
+  typename T::small_size_storage sz(size_.size());
+  typename T::small_stride_storage st(stride_.size());
   for (dim_type i = 0; i < size_.size(); ++i) {
     sz[i] = static_cast< typename T::size_type >(size_[i]);
     st[i] = static_cast< typename T::difference_type >(stride_[i]);
@@ -33,6 +33,7 @@ namespace tensor {
 #define THUNDER_TENSOR_DEFINE_UNARY(func)                               \
   template < typename S >                                               \
   const Tensor< S >& Tensor< S >::func() const {                        \
+    detach();                                                           \
     return math::func(*this);                                           \
   }                                                                     \
   template < typename S >                                               \
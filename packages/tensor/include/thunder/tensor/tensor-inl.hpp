@@ -64,6 +64,9 @@
 // Mathematical operators
 #include "thunder/tensor/tensor-inl-operator.hpp"
 
+// Arithmetic expressions
+#include "thunder/tensor/expression-inl.hpp"
+
 // Serialization
 #include "thunder/tensor/tensor-inl-serialize.hpp"
 
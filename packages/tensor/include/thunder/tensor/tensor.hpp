@@ -26,6 +26,10 @@
 #include <utility>
 
 #include "thunder/storage.hpp"
+#include "thunder/tensor/expression.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/reduction.hpp"
+#include "thunder/tensor/share.hpp"
 
 namespace thunder {
 namespace tensor {
@@ -33,13 +37,6 @@ namespace tensor {
 template < typename S = DoubleStorage >
 class Tensor;
 
-template < typename S >
-Tensor< S > operator+(
-    typename Tensor< S >::const_reference value, const Tensor< S > &x);
-template < typename S >
-Tensor< S > operator-(
-    typename Tensor< S >::const_reference value, const Tensor< S > &x);
-
 template < typename S >
 Tensor< S > operator==(
     typename Tensor< S >::const_reference value, const Tensor< S > &x);
@@ -79,17 +76,22 @@ class Tensor {
   typedef ::std::shared_ptr< S > storage_pointer;
   typedef typename size_storage::size_type dim_type;
 
+  // Sizes and strides of up to 8 dimensions are kept inline. They convert
+  // implicitly to and from size_storage and stride_storage.
+  typedef SmallStorage< size_type > small_size_storage;
+  typedef SmallStorage< difference_type > small_stride_storage;
+
   // Constructors
   explicit Tensor();
-  explicit Tensor(size_storage sz);
+  explicit Tensor(small_size_storage sz);
   explicit Tensor(size_type sz0);
   Tensor(size_type sz0, size_type sz1);
   Tensor(size_type sz0, size_type sz1, size_type sz2);
   Tensor(size_type sz0, size_type sz1, size_type sz2, size_type sz3);
   explicit Tensor(storage_pointer s, size_type os = 0);
-  Tensor(size_storage sz, storage_pointer s, size_type os = 0);
-  Tensor(size_storage sz, stride_storage st);
-  Tensor(size_storage sz, stride_storage st, storage_pointer s,
+  Tensor(small_size_storage sz, storage_pointer s, size_type os = 0);
+  Tensor(small_size_storage sz, small_stride_storage st);
+  Tensor(small_size_storage sz, small_stride_storage st, storage_pointer s,
          size_type os = 0);
   Tensor(const Tensor &y);
   Tensor(Tensor &&y);
@@ -98,6 +100,10 @@ class Tensor {
   template < typename Other_S >
   explicit Tensor(const Tensor< Other_S > &y);
 
+  // Evaluation of arithmetic expressions to a new contiguous tensor
+  template < typename O, typename L, typename R >
+  Tensor(const expression::Expression< O, L, R > &e);
+
   // Destructor
   ~Tensor();
 
@@ -111,10 +117,10 @@ class Tensor {
 
   // Property queries
   dim_type dimension() const;
-  size_storage size() const;
+  small_size_storage size() const;
   size_type size(dim_type dim) const;
   size_type length() const;
-  stride_storage stride() const;
+  small_stride_storage stride() const;
   difference_type stride(dim_type dim) const;
   storage_pointer storage() const;
   size_type offset() const;
@@ -125,17 +131,18 @@ class Tensor {
   reference get(size_type pos0, size_type pos1, size_type pos2) const;
   reference get(size_type pos0, size_type pos1, size_type pos2,
                         size_type pos3) const;
-  reference get(const size_storage &pos) const;
+  reference get(const small_size_storage &pos) const;
   bool isContiguous() const;
   bool partialContiguity(dim_type a, dim_type b) const;
   bool isUnique() const;
+  bool isShared() const;
 
   // Static property queries are delegated
   static dim_type dimension(const Tensor &x);
-  static size_storage size(const Tensor &x);
+  static small_size_storage size(const Tensor &x);
   static size_type size(const Tensor &x, dim_type dim);
   static size_type length(const Tensor &x);
-  static stride_storage stride(const Tensor &x);
+  static small_stride_storage stride(const Tensor &x);
   static difference_type stride(const Tensor &x, dim_type dim);
   static storage_pointer storage(const Tensor &x);
   static size_type offset(const Tensor &x);
@@ -147,10 +154,11 @@ class Tensor {
                        size_type pos2);
   static reference get(const Tensor &x, size_type pos0, size_type pos1,
                        size_type pos2, size_type pos3);
-  static reference get(const Tensor &x, const size_storage &pos);
+  static reference get(const Tensor &x, const small_size_storage &pos);
   static bool isContiguous(const Tensor &x);
   static bool partialContiguity(const Tensor &x, dim_type a, dim_type b);
   static bool isUnique(const Tensor &x);
+  static bool isShared(const Tensor &x);
 
   // Assignment operators
   Tensor& operator=(Tensor y);
@@ -163,11 +171,11 @@ class Tensor {
                                size_type pos2) const;
   reference operator()(size_type pos0, size_type pos1,
                                size_type pos2, size_type pos3) const;
-  reference operator()(const size_storage &pos) const;
+  reference operator()(const small_size_storage &pos) const;
 
   // Index operators
   Tensor operator[](size_type pos) const;
-  Tensor operator[](const size_storage& pos) const;
+  Tensor operator[](const small_size_storage& pos) const;
   Tensor operator[](
       const Storage< ::std::pair< size_type, size_type > > &range) const;
 
@@ -198,45 +206,51 @@ class Tensor {
   // Normal modifiers
   Tensor& set(const Tensor &y);
   Tensor& set(storage_pointer s, size_type os = 0);
-  Tensor& set(size_storage sz, storage_pointer s, size_type os = 0);
-  Tensor& set(size_storage sz, stride_storage st, storage_pointer s,
+  Tensor& set(small_size_storage sz, storage_pointer s, size_type os = 0);
+  Tensor& set(small_size_storage sz, small_stride_storage st, storage_pointer s,
                       size_type os = 0);
-  Tensor& resize(size_storage sz);
+  Tensor& resize(small_size_storage sz);
   Tensor& resize(size_type sz);
   Tensor& resize(size_type sz0, size_type sz1);
   Tensor& resize(size_type sz0, size_type sz1, size_type sz2);
   Tensor& resize(size_type sz0, size_type sz1, size_type sz2,
                          size_type sz3);
-  Tensor& resize(size_storage sz, stride_storage st);
+  Tensor& resize(small_size_storage sz, small_stride_storage st);
   Tensor& contiguous();
   Tensor& squeeze();
   Tensor& unique();
+  // Copy data shared with copy-on-write clones, keeping views of this tensor
+  const Tensor& detach() const;
+  Tensor& detach();
 
   // Static modifiers are delegated
   static Tensor& set(Tensor *x, const Tensor &y);
   static Tensor& set(Tensor *x, storage_pointer s, size_type os = 0);
-  static Tensor& set(Tensor *x, size_storage sz, storage_pointer s,
+  static Tensor& set(Tensor *x, small_size_storage sz, storage_pointer s,
                      size_type os = 0);
-  static Tensor& set(Tensor *x, size_storage sz, stride_storage st,
+  static Tensor& set(Tensor *x, small_size_storage sz, small_stride_storage st,
                      storage_pointer s, size_type os = 0);
-  static Tensor& resize(Tensor *x, size_storage sz);
+  static Tensor& resize(Tensor *x, small_size_storage sz);
   static Tensor& resize(Tensor *x, size_type sz);
   static Tensor& resize(Tensor *x, size_type sz0, size_type sz1);
   static Tensor& resize(Tensor *x, size_type sz0, size_type sz1, size_type sz2);
   static Tensor& resize(Tensor *x, size_type sz0, size_type sz1, size_type sz2,
                         size_type sz3);
-  static Tensor& resize(Tensor *x, size_storage sz, stride_storage st);
+  static Tensor& resize(
+      Tensor *x, small_size_storage sz, small_stride_storage st);
   static Tensor& contiguous(Tensor *x);
   static Tensor& squeeze(Tensor *x);
   static Tensor& unique(Tensor *x);
+  static Tensor& detach(Tensor *x);
 
   // Templated subtensor extractors. Specialization because of type collision.
   template < typename T >
   Tensor viewAs(const T &y, size_type os = 0) const;
   Tensor viewAs(const Tensor &y, size_type os = 0) const;
   template < typename T >
-  Tensor viewAs(const T &y, stride_storage st, size_type os = 0) const;
-  Tensor viewAs(const Tensor &y, stride_storage st, size_type os = 0) const;
+  Tensor viewAs(const T &y, small_stride_storage st, size_type os = 0) const;
+  Tensor viewAs(
+      const Tensor &y, small_stride_storage st, size_type os = 0) const;
   template < typename T >
   Tensor extract(const T &y) const;
   template < typename T >
@@ -256,10 +270,10 @@ class Tensor {
   static Tensor viewAs(const Tensor &x, const T &y, size_type os = 0);
   static Tensor viewAs(const Tensor &x, const Tensor &y, size_type os = 0);
   template < typename T >
-  static Tensor viewAs(const Tensor &x, const T &y, stride_storage st,
-                       size_type os = 0);
-  static Tensor viewAs(const Tensor &x, const Tensor &y, stride_storage st,
+  static Tensor viewAs(const Tensor &x, const T &y, small_stride_storage st,
                        size_type os = 0);
+  static Tensor viewAs(const Tensor &x, const Tensor &y,
+                       small_stride_storage st, size_type os = 0);
   template < typename T >
   static Tensor extract(const Tensor &x, const T &y);
   template < typename T >
@@ -281,10 +295,15 @@ class Tensor {
   Tensor view(size_type sz0, size_type sz1, size_type sz2) const;
   Tensor view(size_type sz0, size_type sz1, size_type sz2,
                       size_type sz3) const;
-  Tensor view(size_storage sz, size_type os = 0) const;
-  Tensor view(size_storage sz, stride_storage st,
+  Tensor view(small_size_storage sz, size_type os = 0) const;
+  Tensor view(small_size_storage sz, small_stride_storage st,
                       size_type os = 0) const;
   Tensor transpose(dim_type dim0 = 0, dim_type dim1 = 1) const;
+  Tensor permute(dim_type dim0, dim_type dim1) const;
+  Tensor permute(dim_type dim0, dim_type dim1, dim_type dim2) const;
+  Tensor permute(dim_type dim0, dim_type dim1, dim_type dim2,
+                 dim_type dim3) const;
+  Tensor permute(small_size_storage dims) const;
   Tensor unfold(dim_type dim, size_type size, size_type step) const;
   Tensor clone() const;
   Tensor cat(const Tensor &y, dim_type dim = 0) const;
@@ -293,7 +312,7 @@ class Tensor {
   Tensor reshape(size_type sz0, size_type sz1, size_type sz2) const;
   Tensor reshape(size_type sz0, size_type sz1, size_type sz2,
                          size_type sz3) const;
-  Tensor reshape(size_storage sz) const;
+  Tensor reshape(small_size_storage sz) const;
 
   // Static subtensor or transformation extractors are delegated
   static Tensor narrow(const Tensor &x, dim_type dim, size_type pos,
@@ -305,11 +324,17 @@ class Tensor {
                      size_type sz2);
   static Tensor view(const Tensor &x, size_type sz0, size_type sz1,
                      size_type sz2, size_type sz3);
-  static Tensor view(const Tensor &x, size_storage sz, size_type os = 0);
-  static Tensor view(const Tensor &x, size_storage sz, stride_storage st,
-                     size_type os = 0);
+  static Tensor view(const Tensor &x, small_size_storage sz, size_type os = 0);
+  static Tensor view(const Tensor &x, small_size_storage sz,
+                     small_stride_storage st, size_type os = 0);
   static Tensor transpose(const Tensor &x, dim_type dim0 = 0,
                           dim_type dim1 = 1);
+  static Tensor permute(const Tensor &x, dim_type dim0, dim_type dim1);
+  static Tensor permute(const Tensor &x, dim_type dim0, dim_type dim1,
+                        dim_type dim2);
+  static Tensor permute(const Tensor &x, dim_type dim0, dim_type dim1,
+                        dim_type dim2, dim_type dim3);
+  static Tensor permute(const Tensor &x, small_size_storage dims);
   static Tensor unfold(const Tensor &x, dim_type dim, size_type size,
                        size_type step);
   static Tensor clone(const Tensor& t);
@@ -320,7 +345,7 @@ class Tensor {
                         size_type sz2);
   static Tensor reshape(const Tensor &x, size_type sz0, size_type sz1,
                         size_type sz2, size_type sz3);
-  static Tensor reshape(const Tensor &x, size_storage sz);
+  static Tensor reshape(const Tensor &x, small_size_storage sz);
 
   // Type conversions
   template < typename T >
@@ -331,34 +356,40 @@ class Tensor {
   static T type(const Tensor& x);
 
 
-  // lambda applications
-  const Tensor& apply(
-      const ::std::function< value_type(value_type) > &lambda) const;
-  const Tensor& apply(
-      const ::std::function< value_type(const value_type&) > &lambda) const;
-  const Tensor& apply(
-      const ::std::function< void(value_type&) > &lambda) const;
-  const Tensor& apply(
-      const ::std::function< void(value_type*) > &lambda) const;
+  // lambda applications. The function is called on each element in the
+  // order of reference iterators, and can take the forms value_type(value_type)
+  // or void(value_type&), or void(value_type*) if neither of them applies.
+  template < typename F >
+  const Tensor& apply(F &&f) const;
+  template < typename F >
+  const Tensor& apply(parallel::Concurrent, F &&f) const;
 
   // Non-const lambda applications are delegated using const_cast
-  Tensor& apply(
-      const ::std::function< value_type(value_type) > &lambda);
-  Tensor& apply(
-      const ::std::function< value_type(const value_type&) > &lambda);
-  Tensor& apply(const ::std::function< void(value_type&) > &lambda);
-  Tensor& apply(const ::std::function< void(value_type*) > &lambda);
+  template < typename F >
+  Tensor& apply(F &&f);
+  template < typename F >
+  Tensor& apply(parallel::Concurrent, F &&f);
 
   // Static lambda applications are delegated
-  static Tensor apply(const Tensor& x,
-                      const ::std::function< value_type(value_type) > &lambda);
-  static Tensor apply(
-      const Tensor &x,
-      const ::std::function< value_type(const value_type&) > &lambda);
-  static Tensor apply(const Tensor &x,
-                      const ::std::function< void(value_type&) > &lambda);
-  static Tensor apply(const Tensor &x,
-                      const ::std::function< void(value_type*) > &lambda);
+  template < typename F >
+  static Tensor apply(const Tensor &x, F &&f);
+  template < typename F >
+  static Tensor apply(parallel::Concurrent, const Tensor &x, F &&f);
+
+  // Zipped lambda applications return a tensor of f(x[i], y[i]) or
+  // f(x[i], y[i], z[i]) with the size of x
+  template < typename S1, typename F >
+  static Tensor zip_apply(const Tensor &x, const Tensor< S1 > &y, F &&f);
+  template < typename S1, typename F >
+  static Tensor zip_apply(parallel::Concurrent, const Tensor &x,
+                          const Tensor< S1 > &y, F &&f);
+  template < typename S1, typename S2, typename F >
+  static Tensor zip_apply(const Tensor &x, const Tensor< S1 > &y,
+                          const Tensor< S2 > &z, F &&f);
+  template < typename S1, typename S2, typename F >
+  static Tensor zip_apply(parallel::Concurrent, const Tensor &x,
+                          const Tensor< S1 > &y, const Tensor< S2 > &z,
+                          F &&f);
 
   // Element-wise mathematical operations that are free of parameters
   const Tensor& abs() const;
@@ -593,6 +624,10 @@ class Tensor {
   const Tensor& copy(const T &y) const;
   template < typename T >
   Tensor& copy(const T& y);
+  template < typename O, typename L, typename R >
+  const Tensor& copy(const expression::Expression< O, L, R > &e) const;
+  template < typename O, typename L, typename R >
+  Tensor& copy(const expression::Expression< O, L, R > &e);
 
   // Element-wise operations with another tensor
   const Tensor& add(const Tensor &y) const;
@@ -737,8 +772,11 @@ class Tensor {
   value_type sum() const;
   value_type prod() const;
   value_type mean() const;
+  value_type sum(reduction::Summation summation) const;
+  value_type mean(reduction::Summation summation) const;
   value_type var() const;
   value_type std() const;
+  ::std::pair< value_type, value_type > meanVar() const;
 
   // Static reduction operations are deligated
   static value_type max(const Tensor &x, Tensor< size_storage > *pos);
@@ -748,8 +786,11 @@ class Tensor {
   static value_type sum(const Tensor &x);
   static value_type prod(const Tensor &x);
   static value_type mean(const Tensor &x);
+  static value_type sum(const Tensor &x, reduction::Summation summation);
+  static value_type mean(const Tensor &x, reduction::Summation summation);
   static value_type var(const Tensor &x);
   static value_type std(const Tensor &x);
+  static ::std::pair< value_type, value_type > meanVar(const Tensor &x);
 
   // Reduction operations along a dimension
   Tensor max(dim_type d, Tensor< size_storage > *pos) const;
@@ -761,6 +802,7 @@ class Tensor {
   Tensor mean(dim_type d) const;
   Tensor var(dim_type d) const;
   Tensor std(dim_type d) const;
+  ::std::pair< Tensor, Tensor > meanVar(dim_type d) const;
 
   // Static reduction operations are deligated
   static Tensor max(const Tensor &x, dim_type d, Tensor< size_storage > *pos);
@@ -772,18 +814,19 @@ class Tensor {
   static Tensor mean(const Tensor &x, dim_type d);
   static Tensor var(const Tensor &x, dim_type d);
   static Tensor std(const Tensor &x, dim_type d);
+  static ::std::pair< Tensor, Tensor > meanVar(const Tensor &x, dim_type d);
 
   // Constructor functions that can only be static
   static Tensor ones(size_type n);
   static Tensor ones(size_type m, size_type n);
   static Tensor ones(size_type n0, size_type n1, size_type n2);
   static Tensor ones(size_type n0, size_type n1, size_type n2, size_type n3);
-  static Tensor ones(const size_storage &sz);
+  static Tensor ones(const small_size_storage &sz);
   static Tensor zeros(size_type n);
   static Tensor zeros(size_type m, size_type n);
   static Tensor zeros(size_type n0, size_type n1, size_type n2);
   static Tensor zeros(size_type n0, size_type n1, size_type n2, size_type n3);
-  static Tensor zeros(const size_storage &sz);
+  static Tensor zeros(const small_size_storage &sz);
 
   // Templated constructor functions
   template < typename TR >
@@ -793,27 +836,24 @@ class Tensor {
   template < typename TR >
   static Tensor polars(const TR& r, const TR& theta);
 
-  // Arithmetic operators with value are delegated
-  Tensor operator+(const_reference value) const;
-  Tensor operator-(const_reference value) const;
-  template < typename FS >
-  friend Tensor< FS > operator+(
-      typename Tensor< FS >::const_reference value, const Tensor< FS > &x);
-  template < typename FS >
-  friend Tensor< FS > operator-(
-      typename Tensor< FS >::const_reference value, const Tensor< FS > &x);
+  // Arithmetic operators +, -, * and / build lazy expressions, declared in
+  // expression.hpp. Compound assignments are delegated.
   const Tensor& operator+=(const_reference value) const;
   const Tensor& operator-=(const_reference value) const;
   Tensor& operator+=(const_reference value);
   Tensor& operator-=(const_reference value);
-
-  // Arithmetic operators are delegated
-  Tensor operator+(const Tensor &y) const;
-  Tensor operator-(const Tensor &y) const;
   const Tensor& operator+=(const Tensor &y) const;
   const Tensor& operator-=(const Tensor &y) const;
   Tensor& operator+=(const Tensor &y);
   Tensor& operator-=(const Tensor &y);
+  template < typename O, typename L, typename R >
+  const Tensor& operator+=(const expression::Expression< O, L, R > &e) const;
+  template < typename O, typename L, typename R >
+  const Tensor& operator-=(const expression::Expression< O, L, R > &e) const;
+  template < typename O, typename L, typename R >
+  Tensor& operator+=(const expression::Expression< O, L, R > &e);
+  template < typename O, typename L, typename R >
+  Tensor& operator-=(const expression::Expression< O, L, R > &e);
 
   // Comparison operators with value are delegated
   Tensor operator==(const_reference value) const;
@@ -850,8 +890,8 @@ class Tensor {
   Tensor operator<=(const Tensor &y) const;
 
  protected:
-  size_storage size_;
-  stride_storage stride_;
+  small_size_storage size_;
+  small_stride_storage stride_;
   storage_pointer storage_;
   size_type offset_;
 };
@@ -891,7 +931,7 @@ class Tensor< S >::reference_iterator {
   typedef std::input_iterator_tag iterator_category;
 
   explicit reference_iterator(const Tensor &x);
-  reference_iterator(const Tensor &x, size_storage pos);
+  reference_iterator(const Tensor &x, small_size_storage pos);
   reference_iterator(const reference_iterator& it);
   reference_iterator(reference_iterator&& it);
   ~reference_iterator();
@@ -907,11 +947,13 @@ class Tensor< S >::reference_iterator {
   reference operator*() const;
   pointer operator->() const;
 
-  size_storage position() const;
+  small_size_storage position() const;
 
  protected:
   const Tensor *tensor_;
-  size_storage position_;
+  small_size_storage position_;
+  size_type index_;
+  pointer current_;
 };
 
 }  // namespace tensor
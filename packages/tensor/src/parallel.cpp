@@ -0,0 +1,199 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace thunder {
+namespace tensor {
+namespace parallel {
+
+namespace {
+
+// Whether the current thread is executing a pool task
+thread_local bool in_task = false;
+
+::std::size_t defaultThreads() {
+  const char *env = ::std::getenv("THUNDER_NUM_THREADS");
+  if (env != nullptr && ::std::atol(env) > 0) {
+    return static_cast< ::std::size_t >(::std::atol(env));
+  }
+  ::std::size_t threads = ::std::thread::hardware_concurrency();
+  return threads > 0 ? threads : 1;
+}
+
+::std::mutex config_mutex;
+::std::shared_ptr< ThreadPool > global_pool;
+::std::atomic< ::std::size_t > global_grain(32768);
+
+}  // namespace
+
+ThreadPool::ThreadPool(::std::size_t threads)
+    : task_(nullptr), chunks_(0), next_(0), done_(0), generation_(0),
+      stop_(false) {
+  for (::std::size_t i = 1; i < threads; ++i) {
+    workers_.push_back(::std::thread(&ThreadPool::work, this));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    ::std::lock_guard< ::std::mutex > lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (::std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+::std::size_t ThreadPool::threads() const {
+  return workers_.size() + 1;
+}
+
+void ThreadPool::run(::std::size_t chunks,
+                     const ::std::function< void(::std::size_t) > &task) {
+  ::std::unique_lock< ::std::mutex > run_lock(run_mutex_, ::std::defer_lock);
+  if (workers_.empty() || chunks <= 1 || in_task || !run_lock.try_lock()) {
+    for (::std::size_t i = 0; i < chunks; ++i) {
+      task(i);
+    }
+    return;
+  }
+  {
+    ::std::lock_guard< ::std::mutex > lock(mutex_);
+    task_ = &task;
+    chunks_ = chunks;
+    next_ = 0;
+    done_ = 0;
+    error_ = nullptr;
+    ++generation_;
+  }
+  start_.notify_all();
+  execute();
+  ::std::exception_ptr error;
+  {
+    ::std::unique_lock< ::std::mutex > lock(mutex_);
+    finish_.wait(lock, [this]() { return done_ == chunks_; });
+    task_ = nullptr;
+    error = error_;
+    error_ = nullptr;
+  }
+  if (error != nullptr) {
+    ::std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::work() {
+  ::std::size_t generation = 0;
+  while (true) {
+    {
+      ::std::unique_lock< ::std::mutex > lock(mutex_);
+      start_.wait(lock, [this, generation]() {
+          return stop_ || generation_ != generation;
+        });
+      if (stop_) {
+        return;
+      }
+      generation = generation_;
+    }
+    execute();
+  }
+}
+
+void ThreadPool::execute() {
+  in_task = true;
+  while (true) {
+    ::std::size_t chunk;
+    const ::std::function< void(::std::size_t) > *task;
+    {
+      ::std::lock_guard< ::std::mutex > lock(mutex_);
+      if (task_ == nullptr || next_ >= chunks_) {
+        break;
+      }
+      chunk = next_++;
+      task = task_;
+    }
+    ::std::exception_ptr error;
+    try {
+      (*task)(chunk);
+    } catch (...) {
+      error = ::std::current_exception();
+    }
+    bool finished;
+    {
+      ::std::lock_guard< ::std::mutex > lock(mutex_);
+      if (error != nullptr && error_ == nullptr) {
+        error_ = error;
+      }
+      finished = (++done_ == chunks_);
+    }
+    if (finished) {
+      finish_.notify_all();
+    }
+  }
+  in_task = false;
+}
+
+::std::shared_ptr< ThreadPool > pool() {
+  ::std::lock_guard< ::std::mutex > lock(config_mutex);
+  if (global_pool == nullptr) {
+    global_pool = ::std::make_shared< ThreadPool >(defaultThreads());
+  }
+  return global_pool;
+}
+
+void setThreads(::std::size_t threads) {
+  if (threads == 0) {
+    threads = defaultThreads();
+  }
+  // The previous pool is released after unlocking, or by its last runner
+  ::std::shared_ptr< ThreadPool > previous;
+  ::std::lock_guard< ::std::mutex > lock(config_mutex);
+  if (global_pool == nullptr || global_pool->threads() != threads) {
+    previous = global_pool;
+    global_pool = ::std::make_shared< ThreadPool >(threads);
+  }
+}
+
+::std::size_t getThreads() {
+  return pool()->threads();
+}
+
+void setGrain(::std::size_t grain) {
+  global_grain = grain > 0 ? grain : 1;
+}
+
+::std::size_t getGrain() {
+  return global_grain;
+}
+
+}  // namespace parallel
+}  // namespace tensor
+}  // namespace thunder
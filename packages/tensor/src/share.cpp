@@ -0,0 +1,44 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/share.hpp"
+
+#include <atomic>
+
+namespace thunder {
+namespace tensor {
+namespace share {
+
+namespace {
+
+::std::atomic< bool > copy_on_write(false);
+
+}  // namespace
+
+void setCopyOnWrite(bool enabled) {
+  copy_on_write = enabled;
+}
+
+bool getCopyOnWrite() {
+  return copy_on_write;
+}
+
+}  // namespace share
+}  // namespace tensor
+}  // namespace thunder
@@ -0,0 +1,221 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/simd.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+#include "thunder/tensor/simd_kernel.hpp"
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+
+namespace scalar {
+
+bool supported() {
+  return true;
+}
+
+THUNDER_TENSOR_SIMD_DEFINE_INSTRUCTION(
+    ScalarVector< double >, ScalarVector< float >);
+
+}  // namespace scalar
+
+namespace {
+
+bool cpuSupports(Instruction instruction) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  switch (instruction) {
+    case SSE2:
+      return __builtin_cpu_supports("sse2");
+    case AVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case AVX512:
+      return __builtin_cpu_supports("avx512f");
+    default:
+      return true;
+  }
+#else
+  return instruction == SCALAR;
+#endif
+}
+
+Instruction detectInstruction() {
+  if (avx512::supported() && cpuSupports(AVX512)) {
+    return AVX512;
+  }
+  if (avx2::supported() && cpuSupports(AVX2)) {
+    return AVX2;
+  }
+  if (sse2::supported() && cpuSupports(SSE2)) {
+    return SSE2;
+  }
+  return SCALAR;
+}
+
+::std::atomic< int > current_instruction(detectInstruction());
+::std::atomic< bool > fast_complex(false);
+::std::atomic< bool > fast_math(false);
+
+}  // namespace
+
+Instruction detect() {
+  static const Instruction instruction = detectInstruction();
+  return instruction;
+}
+
+void setInstruction(Instruction instruction) {
+  current_instruction = instruction < detect() ? instruction : detect();
+}
+
+Instruction getInstruction() {
+  return static_cast< Instruction >(current_instruction.load());
+}
+
+void setFastComplex(bool fast) {
+  fast_complex = fast;
+}
+
+bool getFastComplex() {
+  return fast_complex;
+}
+
+void setFastMath(bool fast) {
+  fast_math = fast;
+}
+
+bool getFastMath() {
+  return fast_math;
+}
+
+#define THUNDER_TENSOR_SIMD_DISPATCH(call)      \
+  switch (getInstruction()) {                   \
+    case AVX512: avx512::call; break;           \
+    case AVX2: avx2::call; break;               \
+    case SSE2: sse2::call; break;               \
+    default: scalar::call; break;               \
+  }
+
+void binary(Operation op, double *x, const double *y, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(binary(op, x, y, n));
+}
+
+void binary(Operation op, double *x, double y, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(binary(op, x, y, n));
+}
+
+void binary(Operation op, float *x, const float *y, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(binary(op, x, y, n));
+}
+
+void binary(Operation op, float *x, float y, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(binary(op, x, y, n));
+}
+
+void fma(double *x, const double *y, double y_value, const double *z,
+         double z_value, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(fma(x, y, y_value, z, z_value, n));
+}
+
+void fma(float *x, const float *y, float y_value, const float *z,
+         float z_value, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(fma(x, y, y_value, z, z_value, n));
+}
+
+void transpose(double *x, ::std::ptrdiff_t x_stride, const double *y,
+               ::std::ptrdiff_t y_stride, ::std::size_t m, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(transpose(x, x_stride, y, y_stride, m, n));
+}
+
+void transpose(float *x, ::std::ptrdiff_t x_stride, const float *y,
+               ::std::ptrdiff_t y_stride, ::std::size_t m, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(transpose(x, x_stride, y, y_stride, m, n));
+}
+
+void gemm(::std::size_t kc, const double *a, const double *b, double *c,
+          ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+          ::std::size_t n, double alpha) {
+  THUNDER_TENSOR_SIMD_DISPATCH(
+      gemm(kc, a, b, c, c_row, c_column, m, n, alpha));
+}
+
+void gemm(::std::size_t kc, const float *a, const float *b, float *c,
+          ::std::ptrdiff_t c_row, ::std::ptrdiff_t c_column, ::std::size_t m,
+          ::std::size_t n, float alpha) {
+  THUNDER_TENSOR_SIMD_DISPATCH(
+      gemm(kc, a, b, c, c_row, c_column, m, n, alpha));
+}
+
+void complexBinary(Operation op, double *x, const double *y, double y_real,
+                   double y_imag, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(
+      complexBinary(op, x, y, y_real, y_imag, n, getFastComplex()));
+}
+
+void complexBinary(Operation op, float *x, const float *y, float y_real,
+                   float y_imag, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(
+      complexBinary(op, x, y, y_real, y_imag, n, getFastComplex()));
+}
+
+void complexFma(double *x, const double *y, double y_real, double y_imag,
+                const double *z, double z_real, double z_imag,
+                ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexFma(
+      x, y, y_real, y_imag, z, z_real, z_imag, n, getFastComplex()));
+}
+
+void complexFma(float *x, const float *y, float y_real, float y_imag,
+                const float *z, float z_real, float z_imag, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexFma(
+      x, y, y_real, y_imag, z, z_real, z_imag, n, getFastComplex()));
+}
+
+void complexConj(double *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexConj(x, n));
+}
+
+void complexConj(float *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexConj(x, n));
+}
+
+void complexCnrm(double *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexCnrm(x, n));
+}
+
+void complexCnrm(float *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(complexCnrm(x, n));
+}
+
+void unary(Function f, double *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(unary(f, x, n, getFastMath()));
+}
+
+void unary(Function f, float *x, ::std::size_t n) {
+  THUNDER_TENSOR_SIMD_DISPATCH(unary(f, x, n, getFastMath()));
+}
+
+#undef THUNDER_TENSOR_SIMD_DISPATCH
+
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
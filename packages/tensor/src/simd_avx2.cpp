@@ -0,0 +1,262 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/simd.hpp"
+
+#include <cstddef>
+
+#include "thunder/tensor/simd_kernel.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+namespace avx2 {
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+struct DoubleVector {
+  typedef double value_type;
+  typedef __m256d vector;
+  static const ::std::size_t width = 4;
+
+  static vector load(const double *p) { return _mm256_loadu_pd(p); }
+  static void store(double *p, vector a) { _mm256_storeu_pd(p, a); }
+  static vector set(double a) { return _mm256_set1_pd(a); }
+  static void transpose(vector *tile) {
+    vector t0 = _mm256_unpacklo_pd(tile[0], tile[1]);
+    vector t1 = _mm256_unpackhi_pd(tile[0], tile[1]);
+    vector t2 = _mm256_unpacklo_pd(tile[2], tile[3]);
+    vector t3 = _mm256_unpackhi_pd(tile[2], tile[3]);
+    tile[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+    tile[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+    tile[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+    tile[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+  }
+  static vector add(vector a, vector b) { return _mm256_add_pd(a, b); }
+  static vector sub(vector a, vector b) { return _mm256_sub_pd(a, b); }
+  static vector mul(vector a, vector b) { return _mm256_mul_pd(a, b); }
+  static vector div(vector a, vector b) { return _mm256_div_pd(a, b); }
+  static vector fma(vector a, vector b, vector c) {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  // vmaxpd returns its second operand if either is NaN
+  static vector fmax(vector a, vector b) {
+    return _mm256_blendv_pd(_mm256_max_pd(b, a), b,
+                            _mm256_cmp_pd(a, a, _CMP_UNORD_Q));
+  }
+  static vector fmin(vector a, vector b) {
+    return _mm256_blendv_pd(_mm256_min_pd(b, a), b,
+                            _mm256_cmp_pd(a, a, _CMP_UNORD_Q));
+  }
+  static vector one(vector mask) {
+    return _mm256_and_pd(mask, _mm256_set1_pd(1));
+  }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_GE_OQ));
+  }
+  static vector isless(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+  }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_NEQ_OQ));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm256_cmp_pd(a, b, _CMP_UNORD_Q));
+  }
+  static vector abs(vector a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+  }
+  static bool any(vector a) {
+    return _mm256_movemask_pd(
+        _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_NEQ_UQ)) != 0;
+  }
+  static vector sqrt(vector a) { return _mm256_sqrt_pd(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  // Exponent fields are set and read through the integer units
+  static vector pow2(vector k) {
+    __m256i t = _mm256_castpd_si256(
+        _mm256_add_pd(k, _mm256_set1_pd(4503599627371519.0)));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(t, 52));
+  }
+  static vector exponent(vector a) {
+    __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(a), 52);
+    __m256d t = _mm256_castsi256_pd(
+        _mm256_or_si256(e, _mm256_set1_epi64x(0x4330000000000000LL)));
+    return _mm256_sub_pd(t, _mm256_set1_pd(4503599627371519.0));
+  }
+  static vector significand(vector a) {
+    __m256i m = _mm256_and_si256(_mm256_castpd_si256(a),
+                                 _mm256_set1_epi64x(0x000fffffffffffffLL));
+    return _mm256_castsi256_pd(
+        _mm256_or_si256(m, _mm256_castpd_si256(_mm256_set1_pd(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return _mm256_blendv_pd(
+        b, a, _mm256_cmp_pd(c, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+  }
+  // Complex numbers are split within each 128-bit lane
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm256_unpacklo_pd(a0, a1);
+    *im = _mm256_unpackhi_pd(a0, a1);
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm256_unpacklo_pd(re, im);
+    *a1 = _mm256_unpackhi_pd(re, im);
+  }
+};
+
+struct FloatVector {
+  typedef float value_type;
+  typedef __m256 vector;
+  static const ::std::size_t width = 8;
+
+  static vector load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, vector a) { _mm256_storeu_ps(p, a); }
+  static vector set(float a) { return _mm256_set1_ps(a); }
+  // Pairs of rows are interleaved, then quadruples, then 128-bit lanes
+  static void transpose(vector *tile) {
+    vector t[8], u[8];
+    for (int k = 0; k < 8; k += 2) {
+      t[k] = _mm256_unpacklo_ps(tile[k], tile[k + 1]);
+      t[k + 1] = _mm256_unpackhi_ps(tile[k], tile[k + 1]);
+    }
+    for (int k = 0; k < 8; k += 4) {
+      u[k] = _mm256_shuffle_ps(t[k], t[k + 2], _MM_SHUFFLE(1, 0, 1, 0));
+      u[k + 1] = _mm256_shuffle_ps(t[k], t[k + 2], _MM_SHUFFLE(3, 2, 3, 2));
+      u[k + 2] = _mm256_shuffle_ps(t[k + 1], t[k + 3],
+                                   _MM_SHUFFLE(1, 0, 1, 0));
+      u[k + 3] = _mm256_shuffle_ps(t[k + 1], t[k + 3],
+                                   _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (int k = 0; k < 4; ++k) {
+      tile[k] = _mm256_permute2f128_ps(u[k], u[k + 4], 0x20);
+      tile[k + 4] = _mm256_permute2f128_ps(u[k], u[k + 4], 0x31);
+    }
+  }
+  static vector add(vector a, vector b) { return _mm256_add_ps(a, b); }
+  static vector sub(vector a, vector b) { return _mm256_sub_ps(a, b); }
+  static vector mul(vector a, vector b) { return _mm256_mul_ps(a, b); }
+  static vector div(vector a, vector b) { return _mm256_div_ps(a, b); }
+  static vector fma(vector a, vector b, vector c) {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  static vector fmax(vector a, vector b) {
+    return _mm256_blendv_ps(_mm256_max_ps(b, a), b,
+                            _mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+  }
+  static vector fmin(vector a, vector b) {
+    return _mm256_blendv_ps(_mm256_min_ps(b, a), b,
+                            _mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+  }
+  static vector one(vector mask) {
+    return _mm256_and_ps(mask, _mm256_set1_ps(1));
+  }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_GE_OQ));
+  }
+  static vector isless(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_NEQ_OQ));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm256_cmp_ps(a, b, _CMP_UNORD_Q));
+  }
+  static vector abs(vector a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+  }
+  static bool any(vector a) {
+    return _mm256_movemask_ps(
+        _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_NEQ_UQ)) != 0;
+  }
+  static vector sqrt(vector a) { return _mm256_sqrt_ps(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  static vector pow2(vector k) {
+    __m256i t = _mm256_castps_si256(
+        _mm256_add_ps(k, _mm256_set1_ps(8388735.0f)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(t, 23));
+  }
+  static vector exponent(vector a) {
+    __m256i e = _mm256_srli_epi32(_mm256_castps_si256(a), 23);
+    __m256 t = _mm256_castsi256_ps(
+        _mm256_or_si256(e, _mm256_set1_epi32(0x4b000000)));
+    return _mm256_sub_ps(t, _mm256_set1_ps(8388735.0f));
+  }
+  static vector significand(vector a) {
+    __m256i m = _mm256_and_si256(_mm256_castps_si256(a),
+                                 _mm256_set1_epi32(0x007fffff));
+    return _mm256_castsi256_ps(
+        _mm256_or_si256(m, _mm256_castps_si256(_mm256_set1_ps(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return _mm256_blendv_ps(
+        b, a, _mm256_cmp_ps(c, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+  }
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm256_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm256_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm256_unpacklo_ps(re, im);
+    *a1 = _mm256_unpackhi_ps(re, im);
+  }
+};
+
+bool supported() {
+  return true;
+}
+
+#else
+
+typedef ScalarVector< double > DoubleVector;
+typedef ScalarVector< float > FloatVector;
+
+bool supported() {
+  return false;
+}
+
+#endif  // __AVX2__ && __FMA__
+
+THUNDER_TENSOR_SIMD_DEFINE_INSTRUCTION(DoubleVector, FloatVector);
+
+}  // namespace avx2
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
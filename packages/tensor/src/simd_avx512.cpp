@@ -0,0 +1,272 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/simd.hpp"
+
+#include <cstddef>
+
+#include "thunder/tensor/simd_kernel.hpp"
+
+#ifdef __AVX512F__
+#include <immintrin.h>
+#endif
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+namespace avx512 {
+
+#ifdef __AVX512F__
+
+struct DoubleVector {
+  typedef double value_type;
+  typedef __m512d vector;
+  static const ::std::size_t width = 8;
+
+  static vector load(const double *p) { return _mm512_loadu_pd(p); }
+  static void store(double *p, vector a) { _mm512_storeu_pd(p, a); }
+  static vector set(double a) { return _mm512_set1_pd(a); }
+  // Pairs of rows are interleaved, then 128-bit lanes are gathered twice
+  static void transpose(vector *tile) {
+    vector t[8], u[8];
+    for (int k = 0; k < 8; k += 2) {
+      t[k] = _mm512_unpacklo_pd(tile[k], tile[k + 1]);
+      t[k + 1] = _mm512_unpackhi_pd(tile[k], tile[k + 1]);
+    }
+    for (int k = 0; k < 8; k += 4) {
+      u[k] = _mm512_shuffle_f64x2(t[k], t[k + 2], 0x88);
+      u[k + 1] = _mm512_shuffle_f64x2(t[k + 1], t[k + 3], 0x88);
+      u[k + 2] = _mm512_shuffle_f64x2(t[k], t[k + 2], 0xdd);
+      u[k + 3] = _mm512_shuffle_f64x2(t[k + 1], t[k + 3], 0xdd);
+    }
+    for (int k = 0; k < 4; ++k) {
+      tile[k] = _mm512_shuffle_f64x2(u[k], u[k + 4], 0x88);
+      tile[k + 4] = _mm512_shuffle_f64x2(u[k], u[k + 4], 0xdd);
+    }
+  }
+  static vector add(vector a, vector b) { return _mm512_add_pd(a, b); }
+  static vector sub(vector a, vector b) { return _mm512_sub_pd(a, b); }
+  static vector mul(vector a, vector b) { return _mm512_mul_pd(a, b); }
+  static vector div(vector a, vector b) { return _mm512_div_pd(a, b); }
+  static vector fma(vector a, vector b, vector c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+  // vmaxpd returns its second operand if either is NaN
+  static vector fmax(vector a, vector b) {
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q),
+                                _mm512_max_pd(b, a), b);
+  }
+  static vector fmin(vector a, vector b) {
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q),
+                                _mm512_min_pd(b, a), b);
+  }
+  static vector one(__mmask8 mask) {
+    return _mm512_maskz_mov_pd(mask, _mm512_set1_pd(1));
+  }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_GT_OQ));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_GE_OQ));
+  }
+  static vector isless(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ));
+  }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_LE_OQ));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_NEQ_OQ));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm512_cmp_pd_mask(a, b, _CMP_UNORD_Q));
+  }
+  static vector abs(vector a) { return _mm512_abs_pd(a); }
+  static bool any(vector a) {
+    return _mm512_cmp_pd_mask(a, _mm512_setzero_pd(), _CMP_NEQ_UQ) != 0;
+  }
+  static vector sqrt(vector a) { return _mm512_sqrt_pd(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+  // Exponent fields are set and read through the integer units
+  static vector pow2(vector k) {
+    __m512i t = _mm512_castpd_si512(
+        _mm512_add_pd(k, _mm512_set1_pd(4503599627371519.0)));
+    return _mm512_castsi512_pd(_mm512_slli_epi64(t, 52));
+  }
+  static vector exponent(vector a) {
+    __m512i e = _mm512_srli_epi64(_mm512_castpd_si512(a), 52);
+    __m512d t = _mm512_castsi512_pd(
+        _mm512_or_si512(e, _mm512_set1_epi64(0x4330000000000000LL)));
+    return _mm512_sub_pd(t, _mm512_set1_pd(4503599627371519.0));
+  }
+  static vector significand(vector a) {
+    __m512i m = _mm512_and_si512(_mm512_castpd_si512(a),
+                                 _mm512_set1_epi64(0x000fffffffffffffLL));
+    return _mm512_castsi512_pd(
+        _mm512_or_si512(m, _mm512_castpd_si512(_mm512_set1_pd(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return _mm512_mask_blend_pd(
+        _mm512_cmp_pd_mask(c, _mm512_setzero_pd(), _CMP_NEQ_OQ), b, a);
+  }
+  // Complex numbers are split within each 128-bit lane
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm512_unpacklo_pd(a0, a1);
+    *im = _mm512_unpackhi_pd(a0, a1);
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm512_unpacklo_pd(re, im);
+    *a1 = _mm512_unpackhi_pd(re, im);
+  }
+};
+
+struct FloatVector {
+  typedef float value_type;
+  typedef __m512 vector;
+  static const ::std::size_t width = 16;
+
+  static vector load(const float *p) { return _mm512_loadu_ps(p); }
+  static void store(float *p, vector a) { _mm512_storeu_ps(p, a); }
+  static vector set(float a) { return _mm512_set1_ps(a); }
+  // Each 128-bit lane is transposed as 4x4 blocks, then lanes are gathered
+  static void transpose(vector *tile) {
+    vector t[16], u[16];
+    for (int k = 0; k < 16; k += 2) {
+      t[k] = _mm512_unpacklo_ps(tile[k], tile[k + 1]);
+      t[k + 1] = _mm512_unpackhi_ps(tile[k], tile[k + 1]);
+    }
+    for (int k = 0; k < 16; k += 4) {
+      __m512d t0 = _mm512_castps_pd(t[k]);
+      __m512d t1 = _mm512_castps_pd(t[k + 1]);
+      __m512d t2 = _mm512_castps_pd(t[k + 2]);
+      __m512d t3 = _mm512_castps_pd(t[k + 3]);
+      u[k] = _mm512_castpd_ps(_mm512_unpacklo_pd(t0, t2));
+      u[k + 1] = _mm512_castpd_ps(_mm512_unpackhi_pd(t0, t2));
+      u[k + 2] = _mm512_castpd_ps(_mm512_unpacklo_pd(t1, t3));
+      u[k + 3] = _mm512_castpd_ps(_mm512_unpackhi_pd(t1, t3));
+    }
+    for (int k = 0; k < 4; ++k) {
+      vector a = _mm512_shuffle_f32x4(u[k], u[k + 4], 0x88);
+      vector b = _mm512_shuffle_f32x4(u[k], u[k + 4], 0xdd);
+      vector c = _mm512_shuffle_f32x4(u[k + 8], u[k + 12], 0x88);
+      vector d = _mm512_shuffle_f32x4(u[k + 8], u[k + 12], 0xdd);
+      tile[k] = _mm512_shuffle_f32x4(a, c, 0x88);
+      tile[k + 4] = _mm512_shuffle_f32x4(b, d, 0x88);
+      tile[k + 8] = _mm512_shuffle_f32x4(a, c, 0xdd);
+      tile[k + 12] = _mm512_shuffle_f32x4(b, d, 0xdd);
+    }
+  }
+  static vector add(vector a, vector b) { return _mm512_add_ps(a, b); }
+  static vector sub(vector a, vector b) { return _mm512_sub_ps(a, b); }
+  static vector mul(vector a, vector b) { return _mm512_mul_ps(a, b); }
+  static vector div(vector a, vector b) { return _mm512_div_ps(a, b); }
+  static vector fma(vector a, vector b, vector c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+  static vector fmax(vector a, vector b) {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q),
+                                _mm512_max_ps(b, a), b);
+  }
+  static vector fmin(vector a, vector b) {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q),
+                                _mm512_min_ps(b, a), b);
+  }
+  static vector one(__mmask16 mask) {
+    return _mm512_maskz_mov_ps(mask, _mm512_set1_ps(1));
+  }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_GE_OQ));
+  }
+  static vector isless(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ));
+  }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_LE_OQ));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_NEQ_OQ));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm512_cmp_ps_mask(a, b, _CMP_UNORD_Q));
+  }
+  static vector abs(vector a) { return _mm512_abs_ps(a); }
+  static bool any(vector a) {
+    return _mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_NEQ_UQ) != 0;
+  }
+  static vector sqrt(vector a) { return _mm512_sqrt_ps(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+  static vector pow2(vector k) {
+    __m512i t = _mm512_castps_si512(
+        _mm512_add_ps(k, _mm512_set1_ps(8388735.0f)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(t, 23));
+  }
+  static vector exponent(vector a) {
+    __m512i e = _mm512_srli_epi32(_mm512_castps_si512(a), 23);
+    __m512 t = _mm512_castsi512_ps(
+        _mm512_or_si512(e, _mm512_set1_epi32(0x4b000000)));
+    return _mm512_sub_ps(t, _mm512_set1_ps(8388735.0f));
+  }
+  static vector significand(vector a) {
+    __m512i m = _mm512_and_si512(_mm512_castps_si512(a),
+                                 _mm512_set1_epi32(0x007fffff));
+    return _mm512_castsi512_ps(
+        _mm512_or_si512(m, _mm512_castps_si512(_mm512_set1_ps(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return _mm512_mask_blend_ps(
+        _mm512_cmp_ps_mask(c, _mm512_setzero_ps(), _CMP_NEQ_OQ), b, a);
+  }
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm512_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm512_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm512_unpacklo_ps(re, im);
+    *a1 = _mm512_unpackhi_ps(re, im);
+  }
+};
+
+bool supported() {
+  return true;
+}
+
+#else
+
+typedef ScalarVector< double > DoubleVector;
+typedef ScalarVector< float > FloatVector;
+
+bool supported() {
+  return false;
+}
+
+#endif  // __AVX512F__
+
+THUNDER_TENSOR_SIMD_DEFINE_INSTRUCTION(DoubleVector, FloatVector);
+
+}  // namespace avx512
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
@@ -0,0 +1,236 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor/simd.hpp"
+
+#include <cstddef>
+
+#include "thunder/tensor/simd_kernel.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace thunder {
+namespace tensor {
+namespace simd {
+namespace sse2 {
+
+#ifdef __SSE2__
+
+struct DoubleVector {
+  typedef double value_type;
+  typedef __m128d vector;
+  static const ::std::size_t width = 2;
+
+  static vector load(const double *p) { return _mm_loadu_pd(p); }
+  static void store(double *p, vector a) { _mm_storeu_pd(p, a); }
+  static vector set(double a) { return _mm_set1_pd(a); }
+  static void transpose(vector *tile) {
+    vector t0 = _mm_unpacklo_pd(tile[0], tile[1]);
+    tile[1] = _mm_unpackhi_pd(tile[0], tile[1]);
+    tile[0] = t0;
+  }
+  static vector add(vector a, vector b) { return _mm_add_pd(a, b); }
+  static vector sub(vector a, vector b) { return _mm_sub_pd(a, b); }
+  static vector mul(vector a, vector b) { return _mm_mul_pd(a, b); }
+  static vector div(vector a, vector b) { return _mm_div_pd(a, b); }
+  // SSE2 has no fused multiply-add, so lanes are rounded as std::fma does
+  static vector fma(vector a, vector b, vector c) {
+    double x[2], y[2], z[2];
+    _mm_storeu_pd(x, a);
+    _mm_storeu_pd(y, b);
+    _mm_storeu_pd(z, c);
+    return _mm_set_pd(Scalar< DoubleVector >::fma(x[1], y[1], z[1]),
+                      Scalar< DoubleVector >::fma(x[0], y[0], z[0]));
+  }
+  static vector select(vector mask, vector a, vector b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+  }
+  // maxpd returns its second operand if either is NaN
+  static vector fmax(vector a, vector b) {
+    return select(_mm_cmpunord_pd(a, a), b, _mm_max_pd(b, a));
+  }
+  static vector fmin(vector a, vector b) {
+    return select(_mm_cmpunord_pd(a, a), b, _mm_min_pd(b, a));
+  }
+  static vector one(vector mask) { return _mm_and_pd(mask, _mm_set1_pd(1)); }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm_cmpgt_pd(a, b));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm_cmpge_pd(a, b));
+  }
+  static vector isless(vector a, vector b) { return one(_mm_cmplt_pd(a, b)); }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm_cmple_pd(a, b));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm_or_pd(_mm_cmplt_pd(a, b), _mm_cmpgt_pd(a, b)));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm_cmpunord_pd(a, b));
+  }
+  static vector abs(vector a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+  static bool any(vector a) {
+    return _mm_movemask_pd(_mm_cmpneq_pd(a, _mm_setzero_pd())) != 0;
+  }
+  static vector sqrt(vector a) { return _mm_sqrt_pd(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+  }
+  // Exponent fields are set and read through the integer units
+  static vector pow2(vector k) {
+    __m128i t =
+        _mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(4503599627371519.0)));
+    return _mm_castsi128_pd(_mm_slli_epi64(t, 52));
+  }
+  static vector exponent(vector a) {
+    __m128i e = _mm_srli_epi64(_mm_castpd_si128(a), 52);
+    __m128d t = _mm_castsi128_pd(
+        _mm_or_si128(e, _mm_set1_epi64x(0x4330000000000000LL)));
+    return _mm_sub_pd(t, _mm_set1_pd(4503599627371519.0));
+  }
+  static vector significand(vector a) {
+    __m128i m = _mm_and_si128(_mm_castpd_si128(a),
+                              _mm_set1_epi64x(0x000fffffffffffffLL));
+    return _mm_castsi128_pd(
+        _mm_or_si128(m, _mm_castpd_si128(_mm_set1_pd(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return select(_mm_cmpneq_pd(c, _mm_setzero_pd()), a, b);
+  }
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm_unpacklo_pd(a0, a1);
+    *im = _mm_unpackhi_pd(a0, a1);
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm_unpacklo_pd(re, im);
+    *a1 = _mm_unpackhi_pd(re, im);
+  }
+};
+
+struct FloatVector {
+  typedef float value_type;
+  typedef __m128 vector;
+  static const ::std::size_t width = 4;
+
+  static vector load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, vector a) { _mm_storeu_ps(p, a); }
+  static vector set(float a) { return _mm_set1_ps(a); }
+  static void transpose(vector *tile) {
+    _MM_TRANSPOSE4_PS(tile[0], tile[1], tile[2], tile[3]);
+  }
+  static vector add(vector a, vector b) { return _mm_add_ps(a, b); }
+  static vector sub(vector a, vector b) { return _mm_sub_ps(a, b); }
+  static vector mul(vector a, vector b) { return _mm_mul_ps(a, b); }
+  static vector div(vector a, vector b) { return _mm_div_ps(a, b); }
+  static vector fma(vector a, vector b, vector c) {
+    float x[4], y[4], z[4];
+    _mm_storeu_ps(x, a);
+    _mm_storeu_ps(y, b);
+    _mm_storeu_ps(z, c);
+    return _mm_set_ps(Scalar< FloatVector >::fma(x[3], y[3], z[3]),
+                      Scalar< FloatVector >::fma(x[2], y[2], z[2]),
+                      Scalar< FloatVector >::fma(x[1], y[1], z[1]),
+                      Scalar< FloatVector >::fma(x[0], y[0], z[0]));
+  }
+  static vector select(vector mask, vector a, vector b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+  static vector fmax(vector a, vector b) {
+    return select(_mm_cmpunord_ps(a, a), b, _mm_max_ps(b, a));
+  }
+  static vector fmin(vector a, vector b) {
+    return select(_mm_cmpunord_ps(a, a), b, _mm_min_ps(b, a));
+  }
+  static vector one(vector mask) { return _mm_and_ps(mask, _mm_set1_ps(1)); }
+  static vector isgreater(vector a, vector b) {
+    return one(_mm_cmpgt_ps(a, b));
+  }
+  static vector isgreaterequal(vector a, vector b) {
+    return one(_mm_cmpge_ps(a, b));
+  }
+  static vector isless(vector a, vector b) { return one(_mm_cmplt_ps(a, b)); }
+  static vector islessequal(vector a, vector b) {
+    return one(_mm_cmple_ps(a, b));
+  }
+  static vector islessgreater(vector a, vector b) {
+    return one(_mm_or_ps(_mm_cmplt_ps(a, b), _mm_cmpgt_ps(a, b)));
+  }
+  static vector isunordered(vector a, vector b) {
+    return one(_mm_cmpunord_ps(a, b));
+  }
+  static vector abs(vector a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+  static bool any(vector a) {
+    return _mm_movemask_ps(_mm_cmpneq_ps(a, _mm_setzero_ps())) != 0;
+  }
+  static vector sqrt(vector a) { return _mm_sqrt_ps(a); }
+  static vector madd(vector a, vector b, vector c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+  static vector pow2(vector k) {
+    __m128i t = _mm_castps_si128(_mm_add_ps(k, _mm_set1_ps(8388735.0f)));
+    return _mm_castsi128_ps(_mm_slli_epi32(t, 23));
+  }
+  static vector exponent(vector a) {
+    __m128i e = _mm_srli_epi32(_mm_castps_si128(a), 23);
+    __m128 t = _mm_castsi128_ps(
+        _mm_or_si128(e, _mm_set1_epi32(0x4b000000)));
+    return _mm_sub_ps(t, _mm_set1_ps(8388735.0f));
+  }
+  static vector significand(vector a) {
+    __m128i m = _mm_and_si128(_mm_castps_si128(a), _mm_set1_epi32(0x007fffff));
+    return _mm_castsi128_ps(
+        _mm_or_si128(m, _mm_castps_si128(_mm_set1_ps(1))));
+  }
+  static vector choose(vector c, vector a, vector b) {
+    return select(_mm_cmpneq_ps(c, _mm_setzero_ps()), a, b);
+  }
+  static void split(vector a0, vector a1, vector *re, vector *im) {
+    *re = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+  static void merge(vector re, vector im, vector *a0, vector *a1) {
+    *a0 = _mm_unpacklo_ps(re, im);
+    *a1 = _mm_unpackhi_ps(re, im);
+  }
+};
+
+bool supported() {
+  return true;
+}
+
+#else
+
+typedef ScalarVector< double > DoubleVector;
+typedef ScalarVector< float > FloatVector;
+
+bool supported() {
+  return false;
+}
+
+#endif  // __SSE2__
+
+THUNDER_TENSOR_SIMD_DEFINE_INSTRUCTION(DoubleVector, FloatVector);
+
+}  // namespace sse2
+}  // namespace simd
+}  // namespace tensor
+}  // namespace thunder
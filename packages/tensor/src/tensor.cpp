@@ -31,6 +31,9 @@
 #include "thunder/tensor/index_iterator.hpp"
 #include "thunder/tensor/math.hpp"
 #include "thunder/tensor/complex.hpp"
+#include "thunder/tensor/mapped.hpp"
+#include "thunder/tensor/parallel.hpp"
+#include "thunder/tensor/simd.hpp"
 
 #include "thunder/serializer/binary_protocol-inl.hpp"
 #include "thunder/serializer/serializer-inl.hpp"
@@ -39,6 +42,9 @@
 #include "thunder/tensor/index_iterator-inl.hpp"
 #include "thunder/tensor/math-inl.hpp"
 #include "thunder/tensor/complex-inl.hpp"
+#include "thunder/tensor/mapped-inl.hpp"
+#include "thunder/tensor/parallel-inl.hpp"
+#include "thunder/tensor/simd-inl.hpp"
 #include "thunder/tensor/tensor-inl.hpp"
 
 namespace thunder {
@@ -46,6 +52,7 @@ namespace tensor {
 
 // Index iterator instantiation
 template class IndexIterator< SizeStorage >;
+template class IndexIterator< SmallStorage< ::std::size_t > >;
 
 // Tensor instantiation
 template class Tensor< DoubleStorage >;
@@ -53,12 +60,25 @@ template class Tensor< FloatStorage >;
 template class Tensor< DoubleComplexStorage >;
 template class Tensor< FloatComplexStorage >;
 template class Tensor< SizeStorage >;
+template class Tensor< AlignedDoubleStorage >;
+template class Tensor< AlignedFloatStorage >;
+template class Tensor< AlignedDoubleComplexStorage >;
+template class Tensor< AlignedFloatComplexStorage >;
+template class Tensor< PoolDoubleStorage >;
+template class Tensor< PoolFloatStorage >;
+template class Tensor< PoolDoubleComplexStorage >;
+template class Tensor< PoolFloatComplexStorage >;
+template class Tensor< MappedDoubleStorage >;
+template class Tensor< MappedFloatStorage >;
+
+template Tensor< MappedDoubleStorage > loadMapped(
+    const ::std::string &file, ::std::size_t position,
+    MappedDoubleStorage::Mode mode);
+template Tensor< MappedFloatStorage > loadMapped(
+    const ::std::string &file, ::std::size_t position,
+    MappedFloatStorage::Mode mode);
 
 #define THUNDER_TENSOR_INSTANTIATE_UNARY(S)                             \
-  template Tensor< S > operator+(                                       \
-      typename Tensor< S >::const_reference value, const Tensor< S > &x); \
-  template Tensor< S > operator-(                                       \
-      typename Tensor< S >::const_reference value, const Tensor< S > &x); \
   template Tensor< S > operator==(                                      \
       typename Tensor< S >::const_reference value, const Tensor< S > &x); \
   template Tensor< S > operator!=(                                      \
@@ -77,7 +97,17 @@ template class Tensor< SizeStorage >;
   INSTANTIATE(FloatStorage);                            \
   INSTANTIATE(DoubleComplexStorage);                    \
   INSTANTIATE(FloatComplexStorage);                     \
-  INSTANTIATE(SizeStorage);
+  INSTANTIATE(SizeStorage);                             \
+  INSTANTIATE(AlignedDoubleStorage);                    \
+  INSTANTIATE(AlignedFloatStorage);                     \
+  INSTANTIATE(AlignedDoubleComplexStorage);             \
+  INSTANTIATE(AlignedFloatComplexStorage);              \
+  INSTANTIATE(PoolDoubleStorage);                       \
+  INSTANTIATE(PoolFloatStorage);                        \
+  INSTANTIATE(PoolDoubleComplexStorage);                \
+  INSTANTIATE(PoolFloatComplexStorage);                 \
+  INSTANTIATE(MappedDoubleStorage);                     \
+  INSTANTIATE(MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
 
@@ -89,14 +119,15 @@ THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
   template Tensor< S1 > Tensor< S1 >::viewAs(                           \
       const Tensor< S2 > &y, typename Tensor< S1 >::size_type os) const;\
   template Tensor< S1 > Tensor< S1 >::viewAs(                           \
-      const Tensor< S2 > &y, typename Tensor< S1 >::stride_storage st,  \
+      const Tensor< S2 > &y,                                            \
+      typename Tensor< S1 >::small_stride_storage st,                   \
       typename Tensor< S1 >::size_type os) const;                       \
   template Tensor< S1 > Tensor< S1 >::viewAs(                           \
       const Tensor< S1 > &x, const Tensor< S2 > &y,                     \
       typename Tensor< S1 >::size_type os);                             \
   template Tensor< S1 > Tensor< S1 >::viewAs(                           \
       const Tensor< S1 > &x, const Tensor< S2 > &y,                     \
-      typename Tensor< S1 >::stride_storage st,                         \
+      typename Tensor< S1 >::small_stride_storage st,                   \
       typename Tensor< S1 >::size_type os);                             \
   template const Tensor< S1 >& Tensor< S1 >::polar(                     \
       typename Tensor< S2 >::const_reference r,                         \
@@ -157,7 +188,17 @@ THUNDER_TENSOR_EXPAND_UNARY(THUNDER_TENSOR_INSTANTIATE_UNARY);
   INSTANTIATE(SizeStorage, DoubleStorage);                              \
   INSTANTIATE(SizeStorage, FloatStorage);                               \
   INSTANTIATE(SizeStorage, DoubleComplexStorage);                       \
-  INSTANTIATE(SizeStorage, FloatComplexStorage);
+  INSTANTIATE(SizeStorage, FloatComplexStorage);                        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleStorage);       \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatStorage);         \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleComplexStorage);             \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleStorage);             \
+  INSTANTIATE(PoolFloatStorage, PoolFloatComplexStorage);               \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatStorage);               \
+  INSTANTIATE(MappedDoubleStorage, MappedFloatStorage);                 \
+  INSTANTIATE(MappedFloatStorage, MappedDoubleStorage);
 
 THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
     THUNDER_TENSOR_INSTANTIATE_BINARY_INCOMPATIBLE);
@@ -165,6 +206,38 @@ THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
 #undef THUNDER_TENSOR_INSTANTIATE_BINARY_INCOMPATIBLE
 #undef THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE
 
+// Conversions between different storages of the same value type
+#define THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION(S1, S2)            \
+  template Tensor< S1 >::Tensor(const Tensor< S2 > &y);
+
+#define THUNDER_TENSOR_EXPAND_BINARY_CONVERSION(INSTANTIATE)            \
+  INSTANTIATE(AlignedDoubleStorage, DoubleStorage);                     \
+  INSTANTIATE(DoubleStorage, AlignedDoubleStorage);                     \
+  INSTANTIATE(AlignedFloatStorage, FloatStorage);                       \
+  INSTANTIATE(FloatStorage, AlignedFloatStorage);                       \
+  INSTANTIATE(AlignedDoubleComplexStorage, DoubleComplexStorage);       \
+  INSTANTIATE(DoubleComplexStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedFloatComplexStorage, FloatComplexStorage);         \
+  INSTANTIATE(FloatComplexStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(PoolDoubleStorage, DoubleStorage);                        \
+  INSTANTIATE(DoubleStorage, PoolDoubleStorage);                        \
+  INSTANTIATE(PoolFloatStorage, FloatStorage);                          \
+  INSTANTIATE(FloatStorage, PoolFloatStorage);                          \
+  INSTANTIATE(PoolDoubleComplexStorage, DoubleComplexStorage);          \
+  INSTANTIATE(DoubleComplexStorage, PoolDoubleComplexStorage);          \
+  INSTANTIATE(PoolFloatComplexStorage, FloatComplexStorage);            \
+  INSTANTIATE(FloatComplexStorage, PoolFloatComplexStorage);            \
+  INSTANTIATE(MappedDoubleStorage, DoubleStorage);                      \
+  INSTANTIATE(DoubleStorage, MappedDoubleStorage);                      \
+  INSTANTIATE(MappedFloatStorage, FloatStorage);                        \
+  INSTANTIATE(FloatStorage, MappedFloatStorage);
+
+THUNDER_TENSOR_EXPAND_BINARY_CONVERSION(
+    THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION);
+
+#undef THUNDER_TENSOR_INSTANTIATE_BINARY_CONVERSION
+#undef THUNDER_TENSOR_EXPAND_BINARY_CONVERSION
+
 #define THUNDER_TENSOR_INSTANTIATE_BINARY_COMPATIBLE(S1, S2)            \
   template bool Tensor< S1 >::isSameSizeAs(const Tensor< S2 > &y) const; \
   template bool Tensor< S1 >::isSameSizeAs(                             \
@@ -227,7 +300,47 @@ THUNDER_TENSOR_EXPAND_BINARY_INCOMPATIBLE(
   INSTANTIATE(SizeStorage, DoubleStorage);                              \
   INSTANTIATE(SizeStorage, FloatStorage);                               \
   INSTANTIATE(SizeStorage, DoubleComplexStorage);                       \
-  INSTANTIATE(SizeStorage, FloatComplexStorage);
+  INSTANTIATE(SizeStorage, FloatComplexStorage);                        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleStorage);              \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatStorage);                \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleComplexStorage);\
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatComplexStorage);  \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleStorage);                    \
+  INSTANTIATE(PoolFloatStorage, PoolFloatStorage);                      \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleComplexStorage);      \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatComplexStorage);        \
+  INSTANTIATE(AlignedDoubleStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedDoubleComplexStorage, AlignedDoubleStorage);       \
+  INSTANTIATE(AlignedFloatStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(AlignedFloatComplexStorage, AlignedFloatStorage);         \
+  INSTANTIATE(AlignedDoubleStorage, DoubleStorage);                     \
+  INSTANTIATE(DoubleStorage, AlignedDoubleStorage);                     \
+  INSTANTIATE(AlignedFloatStorage, FloatStorage);                       \
+  INSTANTIATE(FloatStorage, AlignedFloatStorage);                       \
+  INSTANTIATE(AlignedDoubleComplexStorage, DoubleComplexStorage);       \
+  INSTANTIATE(DoubleComplexStorage, AlignedDoubleComplexStorage);       \
+  INSTANTIATE(AlignedFloatComplexStorage, FloatComplexStorage);         \
+  INSTANTIATE(FloatComplexStorage, AlignedFloatComplexStorage);         \
+  INSTANTIATE(PoolDoubleStorage, PoolDoubleComplexStorage);             \
+  INSTANTIATE(PoolDoubleComplexStorage, PoolDoubleStorage);             \
+  INSTANTIATE(PoolFloatStorage, PoolFloatComplexStorage);               \
+  INSTANTIATE(PoolFloatComplexStorage, PoolFloatStorage);               \
+  INSTANTIATE(PoolDoubleStorage, DoubleStorage);                        \
+  INSTANTIATE(DoubleStorage, PoolDoubleStorage);                        \
+  INSTANTIATE(PoolFloatStorage, FloatStorage);                          \
+  INSTANTIATE(FloatStorage, PoolFloatStorage);                          \
+  INSTANTIATE(PoolDoubleComplexStorage, DoubleComplexStorage);          \
+  INSTANTIATE(DoubleComplexStorage, PoolDoubleComplexStorage);          \
+  INSTANTIATE(PoolFloatComplexStorage, FloatComplexStorage);            \
+  INSTANTIATE(FloatComplexStorage, PoolFloatComplexStorage);            \
+  INSTANTIATE(MappedDoubleStorage, MappedDoubleStorage);                \
+  INSTANTIATE(MappedFloatStorage, MappedFloatStorage);                  \
+  INSTANTIATE(MappedDoubleStorage, MappedFloatStorage);                 \
+  INSTANTIATE(MappedFloatStorage, MappedDoubleStorage);                 \
+  INSTANTIATE(MappedDoubleStorage, DoubleStorage);                      \
+  INSTANTIATE(DoubleStorage, MappedDoubleStorage);                      \
+  INSTANTIATE(MappedFloatStorage, FloatStorage);                        \
+  INSTANTIATE(FloatStorage, MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_BINARY_COMPATIBLE(
     THUNDER_TENSOR_INSTANTIATE_BINARY_COMPATIBLE);
@@ -288,7 +401,17 @@ namespace serializer {
   INSTANTIATE(FloatStorage);                            \
   INSTANTIATE(DoubleComplexStorage);                    \
   INSTANTIATE(FloatComplexStorage);                     \
-  INSTANTIATE(SizeStorage);
+  INSTANTIATE(SizeStorage);                             \
+  INSTANTIATE(AlignedDoubleStorage);                    \
+  INSTANTIATE(AlignedFloatStorage);                     \
+  INSTANTIATE(AlignedDoubleComplexStorage);             \
+  INSTANTIATE(AlignedFloatComplexStorage);              \
+  INSTANTIATE(PoolDoubleStorage);                       \
+  INSTANTIATE(PoolFloatStorage);                        \
+  INSTANTIATE(PoolDoubleComplexStorage);                \
+  INSTANTIATE(PoolFloatComplexStorage);                 \
+  INSTANTIATE(MappedDoubleStorage);                     \
+  INSTANTIATE(MappedFloatStorage);
 
 THUNDER_TENSOR_EXPAND_SERIALIZE(THUNDER_TENSOR_INSTANTIATE_SERIALIZE);
 
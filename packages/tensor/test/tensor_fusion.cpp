@@ -0,0 +1,110 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor.hpp"
+
+#include <cmath>
+#include <complex>
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+// Contiguous, strided and transposed tensors of the same length
+template < typename T >
+T layout(int k) {
+  if (k == 0) {
+    return T(10, 20, 7);
+  } else if (k == 1) {
+    return T({10, 20, 7}, {161, 8, 1});
+  }
+  return T(7, 20, 10).transpose(0, 2);
+}
+
+template < typename T >
+void pipelineTest() {
+  tensor::parallel::setThreads(4);
+  tensor::parallel::setGrain(16);
+
+  for (int k = 0; k < 3; ++k) {
+    T x = layout< T >(k);
+    int val = -700;
+    for (typename T::reference_iterator begin = x.reference_begin(),
+             end = x.reference_end(); begin != end; ++begin) {
+      *begin = static_cast< typename T::value_type >(val++) / 300;
+    }
+
+    // The fused result equals the chain of tensor methods
+    T r1 = layout< T >(k).copy(x);
+    r1.mul(0.5).add(3).tanh().sqrt();
+    T r2 = tensor::fuse(layout< T >(k).copy(x)).mul(0.5).add(3).tanh()
+        .sqrt().run();
+    T r3 = layout< T >(k).copy(x);
+    r3.fmax(0).sub(1).exp().fmin(2).log1p().div(4);
+    T r4 = tensor::fuse(layout< T >(k).copy(x)).fmax(0).sub(1).exp().fmin(2)
+        .log1p().div(4).run();
+    T r5 = tensor::fuse(layout< T >(k).copy(x)).apply(
+        [](typename T::value_type v) { return v > 0 ? v : v / 10; })
+        .mul(2).run();
+    for (typename T::reference_iterator begin = x.reference_begin(),
+             end = x.reference_end(); begin != end; ++begin) {
+      typename T::size_storage pos = begin.position();
+      EXPECT_FLOAT_EQ(r1(pos), r2(pos));
+      EXPECT_FLOAT_EQ(r3(pos), r4(pos));
+      EXPECT_FLOAT_EQ(((*begin) > 0 ? (*begin) : (*begin) / 10) * 2, r5(pos));
+    }
+
+    // The pipeline runs in place on the tensor it was started on
+    T r6 = layout< T >(k).copy(x);
+    EXPECT_EQ(r6.data(), tensor::fuse(r6).add(1).run().data());
+    EXPECT_FLOAT_EQ(x(3, 4, 5) + 1, r6(3, 4, 5));
+  }
+
+  tensor::parallel::setThreads(0);
+  tensor::parallel::setGrain(32768);
+}
+
+TEST(FusionTest, doublePipelineTest) {
+  pipelineTest< DoubleTensor >();
+}
+
+TEST(FusionTest, floatPipelineTest) {
+  pipelineTest< FloatTensor >();
+}
+
+TEST(FusionTest, complexPipelineTest) {
+  DoubleComplexTensor t(5, 7);
+  int val = 0;
+  for (DoubleComplexTensor::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    *begin = ::std::complex< double >(val / 10.0, -val / 20.0);
+  }
+  DoubleComplexTensor r = tensor::fuse(t.clone()).mul(2).exp().run();
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      ::std::complex< double > expected = ::std::exp(t(i, j) * 2.0);
+      EXPECT_DOUBLE_EQ(expected.real(), r(i, j).real());
+      EXPECT_DOUBLE_EQ(expected.imag(), r(i, j).imag());
+    }
+  }
+}
+
+}  // namespace
+}  // namespace thunder
@@ -401,6 +401,24 @@ void transformTest() {
     }
   }
 
+  T t1_permuted = T::permute(t1, 2, 0, 1);
+  EXPECT_EQ(3, t1_permuted.dimension());
+  EXPECT_EQ(7, t1_permuted.size(0));
+  EXPECT_EQ(10, t1_permuted.size(1));
+  EXPECT_EQ(20, t1_permuted.size(2));
+  EXPECT_EQ(t1.storage(), t1_permuted.storage());
+  EXPECT_FALSE(t1_permuted.isContiguous());
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 20; ++k) {
+        EXPECT_EQ(t1(j, k, i), t1_permuted(i, j, k));
+      }
+    }
+  }
+  EXPECT_THROW(t1.permute(0, 1), out_of_range);
+  EXPECT_THROW(t1.permute(0, 3, 1), out_of_range);
+  EXPECT_THROW(t1.permute(1, 0, 1), invalid_argument);
+
   T t1_unfolded = T::unfold(t1, 1, 3, 2);
   EXPECT_EQ(4, t1_unfolded.dimension());
   EXPECT_EQ(10, t1_unfolded.size(0));
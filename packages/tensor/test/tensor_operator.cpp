@@ -141,6 +141,98 @@ TEST(TensorTest, tensorNumericalTest) {
   tensorNumericalTest< FloatComplexTensor >();
 }
 
+template< typename T >
+void expressionTest() {
+  // Contiguous, strided and transposed operands of the same length
+  T t1(10, 20, 7);
+  T t2({10, 20, 7}, {161, 8, 1});
+  T t3 = T(7, 20, 10).transpose(0, 2);
+  int val = -700;
+  for (typename T::reference_iterator t1_begin = t1.reference_begin(),
+           t1_end = t1.reference_end(), t2_begin = t2.reference_begin(),
+           t3_begin = t3.reference_begin(); t1_begin != t1_end;
+       ++t1_begin, ++t2_begin, ++t3_begin) {
+    *t1_begin = static_cast< typename T::value_type >(val) / 300;
+    *t2_begin = static_cast< typename T::value_type >(val + 50) / 200;
+    *t3_begin = static_cast< typename T::value_type >(val++ + 90) / 100;
+  }
+
+  T r1 = t1 + t2 * t3 - t1 / 2;
+  T r2 = 3 - (t2 - t3) * t1;
+  T r3 = T(10, 7, 20).transpose(1, 2);
+  r3.copy(t3 / (t1 * t1 + 1) + 5);
+  T r4 = t1.clone();
+  r4 += t2 * t3;
+  r4 -= 2 * t1;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    typename T::size_storage pos = begin.position();
+    EXPECT_FLOAT_EQ(t1(pos) + t2(pos) * t3(pos) - t1(pos) / 2, r1(pos));
+    EXPECT_FLOAT_EQ(3 - (t2(pos) - t3(pos)) * t1(pos), r2(pos));
+    EXPECT_FLOAT_EQ(t3(pos) / (t1(pos) * t1(pos) + 1) + 5, r3(pos));
+    EXPECT_FLOAT_EQ(t1(pos) + t2(pos) * t3(pos) - 2 * t1(pos), r4(pos));
+  }
+  EXPECT_TRUE(r1.isContiguous());
+  EXPECT_TRUE(r1.isSameSizeAs(t1));
+
+  // Operands stay valid after their temporaries are destroyed
+  auto e = t1.clone() * t1.clone();
+  T r5 = e;
+  for (typename T::size_type i = 0; i < r5.length(); ++i) {
+    EXPECT_FLOAT_EQ(t1.data()[i] * t1.data()[i], r5.data()[i]);
+  }
+
+  // Assigning an expression to one of its operands rebinds the tensor
+  T r6 = t1;
+  r6 = r6 + r6;
+  EXPECT_NE(r6.data(), t1.data());
+  EXPECT_FLOAT_EQ(2 * t1.data()[5], r6.data()[5]);
+
+  EXPECT_THROW(T r7 = T(3, 4) + T(4, 4), out_of_range);
+
+  // Expressions reading their target in another view go through a
+  // temporary, while the target's own view is evaluated in place
+  T r8(4, 4);
+  for (typename T::size_type i = 0; i < r8.length(); ++i) {
+    r8.data()[i] = static_cast< typename T::value_type >(i);
+  }
+  T r9 = r8.clone(), r10 = r8.clone(), r11 = r8.clone();
+  r9.copy(r9.transpose() + 1);
+  r10.copy(r10.transpose() * 2 + 1);
+  typename T::pointer r11_data = r11.data();
+  r11 += r11 * 2;
+  EXPECT_EQ(r11_data, r11.data());
+  for (typename T::size_type i = 0; i < 4; ++i) {
+    for (typename T::size_type j = 0; j < 4; ++j) {
+      EXPECT_FLOAT_EQ(r8(j, i) + 1, r9(i, j));
+      EXPECT_FLOAT_EQ(r8(j, i) * 2 + 1, r10(i, j));
+      EXPECT_FLOAT_EQ(r8(i, j) * 3, r11(i, j));
+    }
+  }
+  T r12 = r8.clone().view(16);
+  r12.narrow(0, 1, 15).copy(r12.narrow(0, 0, 15) * 2);
+  EXPECT_FLOAT_EQ(0, r12(0));
+  for (typename T::size_type i = 1; i < 16; ++i) {
+    EXPECT_FLOAT_EQ(r8.data()[i - 1] * 2, r12(i));
+  }
+
+  // eval() computes the result at once, while expressions kept with auto
+  // read their operands when converted
+  T r13 = r8.clone();
+  auto r14 = r13 + 1;
+  T r15 = (r13 + 1).eval();
+  r13.fill(10);
+  EXPECT_FLOAT_EQ(11, T(r14)(2, 3));
+  EXPECT_FLOAT_EQ(r8(2, 3) + 1, r15(2, 3));
+  EXPECT_FLOAT_EQ(r8.sum() + 16, (r8 + 1).eval().sum());
+  EXPECT_TRUE((r8.transpose() * 2).eval().isContiguous());
+}
+
+TEST(TensorTest, expressionTest) {
+  expressionTest< DoubleTensor >();
+  expressionTest< FloatTensor >();
+}
+
 template< typename T >
 void valueComparisonTest() {
   T t1(10, 20, 7);
@@ -0,0 +1,311 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+TEST(ParallelTest, threadPoolTest) {
+  tensor::parallel::ThreadPool pool(4);
+  EXPECT_EQ(4, pool.threads());
+  ::std::vector< int > visited(100, 0);
+  pool.run(100, [&visited](::std::size_t chunk) { ++visited[chunk]; });
+  for (int count : visited) {
+    EXPECT_EQ(1, count);
+  }
+
+  ::std::atomic< int > total(0);
+  EXPECT_THROW(pool.run(10, [&total](::std::size_t chunk) {
+        ++total;
+        if (chunk == 3) {
+          throw ::std::runtime_error("Chunk failed.");
+        }
+      }), ::std::runtime_error);
+  EXPECT_EQ(10, total);
+
+  // Nested runs are executed serially by the calling worker
+  total = 0;
+  pool.run(8, [&pool, &total](::std::size_t) {
+      pool.run(8, [&total](::std::size_t) { ++total; });
+    });
+  EXPECT_EQ(64, total);
+}
+
+TEST(ParallelTest, configureTest) {
+  tensor::parallel::setThreads(3);
+  EXPECT_EQ(3, tensor::parallel::getThreads());
+  tensor::parallel::setGrain(100);
+  EXPECT_EQ(100, tensor::parallel::getGrain());
+  tensor::parallel::setGrain(0);
+  EXPECT_EQ(1, tensor::parallel::getGrain());
+  tensor::parallel::setThreads(0);
+  EXPECT_LE(1, tensor::parallel::getThreads());
+}
+
+TEST(ParallelTest, resizeTest) {
+  tensor::parallel::setThreads(4);
+  tensor::parallel::setGrain(1);
+
+  // Resizing from a task keeps the running pool until the run returns
+  ::std::atomic< int > total(0);
+  tensor::parallel::forRange(64, [&total](::std::size_t begin,
+                                          ::std::size_t end) {
+      if (begin == 0) {
+        tensor::parallel::setThreads(2);
+      }
+      total += static_cast< int >(end - begin);
+    });
+  EXPECT_EQ(64, total);
+  EXPECT_EQ(2, tensor::parallel::getThreads());
+
+  // Resizing from another thread does not disturb running kernels
+  ::std::atomic< bool > stop(false);
+  ::std::thread resizer([&stop]() {
+      for (::std::size_t i = 0; !stop; ++i) {
+        tensor::parallel::setThreads(2 + i % 3);
+      }
+    });
+  for (int i = 0; i < 200; ++i) {
+    total = 0;
+    tensor::parallel::forRange(64, [&total](::std::size_t begin,
+                                            ::std::size_t end) {
+        total += static_cast< int >(end - begin);
+      });
+    EXPECT_EQ(64, total);
+  }
+  stop = true;
+  resizer.join();
+
+  tensor::parallel::setThreads(0);
+  tensor::parallel::setGrain(32768);
+}
+
+template < typename T >
+void kernelTest() {
+  tensor::parallel::setThreads(4);
+  tensor::parallel::setGrain(16);
+
+  // Contiguous, strided and transposed tensors of the same length
+  T t1(10, 20, 7);
+  T t2({10, 20, 7}, {161, 8, 1});
+  T t3 = T(7, 20, 10).transpose(0, 2);
+  int val = -700;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++) / 300;
+  }
+  val = -500;
+  for (typename T::reference_iterator begin = t2.reference_begin(),
+           end = t2.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++) / 200;
+  }
+  val = -300;
+  for (typename T::reference_iterator begin = t3.reference_begin(),
+           end = t3.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++) / 100;
+  }
+
+  T r1 = T::tanh(t1);
+  T r2 = T::exp(t2);
+  T r3 = T::add(t3, t1);
+  T r4 = T::fma(t2, t3, t1);
+  T r5 = T(1400).copy(t3);
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    typename T::size_storage pos = begin.position();
+    EXPECT_FLOAT_EQ(::std::tanh(t1(pos)), r1(pos));
+    EXPECT_FLOAT_EQ(::std::exp(t2(pos)), r2(pos));
+    EXPECT_FLOAT_EQ(t3(pos) + t1(pos), r3(pos));
+    EXPECT_FLOAT_EQ(::std::fma(t2(pos), t3(pos), t1(pos)), r4(pos));
+  }
+  typename T::reference_iterator t3_begin = t3.reference_begin();
+  for (typename T::size_type i = 0; i < r5.length(); ++i, ++t3_begin) {
+    EXPECT_FLOAT_EQ(*t3_begin, r5[i]());
+  }
+
+  // Tensors of different shapes are traversed in lockstep
+  T t4 = T(1400).fill(2);
+  T r6 = T::mul(t3, t4);
+  t3_begin = t3.reference_begin();
+  for (typename T::reference_iterator begin = r6.reference_begin(),
+           end = r6.reference_end(); begin != end; ++begin, ++t3_begin) {
+    EXPECT_FLOAT_EQ((*t3_begin) * 2, *begin);
+  }
+
+  tensor::parallel::setThreads(0);
+  tensor::parallel::setGrain(32768);
+}
+
+TEST(ParallelTest, stridedCursorTest) {
+  // Contiguous dimensions collapse into a single run
+  DoubleTensor t1(10, 20, 7);
+  tensor::StridedCursor< DoubleTensor > c1(t1, 3);
+  EXPECT_EQ(1, c1.step());
+  EXPECT_EQ(1397, c1.run());
+  EXPECT_EQ(t1.data() + 3, c1.data());
+
+  // Narrowed and transposed views visit the same elements as iterators
+  DoubleTensor t2 = DoubleTensor(6, 9, 8, 5).narrow(2, 1, 6).transpose(1, 3);
+  ::std::size_t index = 0;
+  for (DoubleTensor::reference_iterator begin = t2.reference_begin(),
+           end = t2.reference_end(); begin != end; ++begin, ++index) {
+    tensor::StridedCursor< DoubleTensor > c2(t2, index);
+    EXPECT_EQ(&(*begin), c2.data());
+  }
+  EXPECT_EQ(t2.length(), index);
+
+  tensor::StridedCursor< DoubleTensor > c3(t2, 0);
+  EXPECT_EQ(t2.stride(3), c3.step());
+  for (index = 0; index < t2.length(); index += c3.run()) {
+    EXPECT_EQ(t2.size(3), c3.run());
+    c3.advance(c3.run());
+  }
+  EXPECT_EQ(t2.length(), index);
+
+  // Sequential reductions follow the iterator order of strided views
+  int val = 0;
+  for (DoubleTensor::reference_iterator begin = t2.reference_begin(),
+           end = t2.reference_end(); begin != end; ++begin) {
+    *begin = (val++ * 37) % 101;
+  }
+  DoubleTensor t3 = t2.clone();
+  SizeTensor t2_pos, t3_pos;
+  EXPECT_EQ(t3.max(&t3_pos), t2.max(&t2_pos));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(t3_pos(i), t2_pos(i));
+  }
+  EXPECT_EQ(t3.sum(), t2.sum());
+  DoubleTensor r2 = t2.min(2, &t2_pos);
+  DoubleTensor r3 = t3.min(2, &t3_pos);
+  for (DoubleTensor::reference_iterator r2_begin = r2.reference_begin(),
+           r2_end = r2.reference_end(), r3_begin = r3.reference_begin();
+       r2_begin != r2_end; ++r2_begin, ++r3_begin) {
+    EXPECT_EQ(*r3_begin, *r2_begin);
+  }
+  for (SizeTensor::reference_iterator p2_begin = t2_pos.reference_begin(),
+           p2_end = t2_pos.reference_end(), p3_begin = t3_pos.reference_begin();
+       p2_begin != p2_end; ++p2_begin, ++p3_begin) {
+    EXPECT_EQ(*p3_begin, *p2_begin);
+  }
+}
+
+template < typename T >
+void reductionTest() {
+  tensor::parallel::setThreads(4);
+  tensor::parallel::setGrain(16);
+
+  // Rows are reduced block by block, and lines of transposed or narrowed
+  // views are reduced one at a time
+  T t1(30, 70, 9);
+  int val = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >((val++ * 37) % 101) / 10;
+  }
+  T t2 = t1.transpose(0, 2);
+  T t3 = t1.narrow(1, 3, 50);
+  T views[] = {t1, t2, t3};
+  for (const T &x : views) {
+    for (typename T::dim_type d = 0; d < x.dimension(); ++d) {
+      SizeTensor max_pos, min_pos;
+      T r1 = x.sum(d);
+      T r2 = x.max(d, &max_pos);
+      T r3 = x.min(d, &min_pos);
+      T r4 = x.var(d);
+      for (typename T::reference_iterator begin = r1.reference_begin(),
+               end = r1.reference_end(); begin != end; ++begin) {
+        typename T::size_storage pos = begin.position();
+        typename T::value_type sum_value = 0;
+        typename T::value_type max_value = x(pos);
+        typename T::value_type min_value = x(pos);
+        typename T::size_type max_index = 0, min_index = 0;
+        for (typename T::size_type i = 0; i < x.size(d); ++i) {
+          pos[d] = i;
+          sum_value += x(pos);
+          if (x(pos) > max_value) {
+            max_value = x(pos);
+            max_index = i;
+          }
+          if (x(pos) < min_value) {
+            min_value = x(pos);
+            min_index = i;
+          }
+        }
+        pos[d] = 0;
+        typename T::value_type mean_value =
+            sum_value / static_cast< typename T::value_type >(x.size(d));
+        typename T::value_type var_value = 0;
+        for (typename T::size_type i = 0; i < x.size(d); ++i) {
+          pos[d] = i;
+          var_value += (x(pos) - mean_value) * (x(pos) - mean_value);
+        }
+        pos[d] = 0;
+        EXPECT_FLOAT_EQ(sum_value, r1(pos));
+        EXPECT_EQ(max_value, r2(pos));
+        EXPECT_EQ(max_index, max_pos(pos));
+        EXPECT_EQ(min_value, r3(pos));
+        EXPECT_EQ(min_index, min_pos(pos));
+        EXPECT_NEAR(var_value / static_cast< typename T::value_type >(
+            x.size(d)), r4(pos), 1e-3);
+      }
+    }
+  }
+
+  // Positions are copied to non-contiguous tensors
+  SizeTensor p1 = SizeTensor(9, 1, 30).transpose(0, 2);
+  T r5 = t1.max(1, &p1);
+  T r6 = t1.max(1);
+  for (typename T::size_type i = 0; i < 30; ++i) {
+    for (typename T::size_type j = 0; j < 9; ++j) {
+      EXPECT_EQ(r6(i, 0, j), r5(i, 0, j));
+      EXPECT_EQ(t1(i, p1(i, 0, j), j), r5(i, 0, j));
+    }
+  }
+
+  tensor::parallel::setThreads(0);
+  tensor::parallel::setGrain(32768);
+}
+
+TEST(ParallelTest, doubleKernelTest) {
+  kernelTest< DoubleTensor >();
+}
+
+TEST(ParallelTest, floatKernelTest) {
+  kernelTest< FloatTensor >();
+}
+
+TEST(ParallelTest, doubleReductionTest) {
+  reductionTest< DoubleTensor >();
+}
+
+TEST(ParallelTest, floatReductionTest) {
+  reductionTest< FloatTensor >();
+}
+
+}  // namespace
+}  // namespace thunder
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <typeinfo>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "thunder/storage.hpp"
@@ -90,6 +91,82 @@ TEST(TensorTest, reductionTest) {
   reductionTest< FloatTensor >();
 }
 
+template < typename T >
+void summationTest() {
+  // Values are summed in double precision for reference
+  T t1 = T(1000, 3001).narrow(1, 0, 3000);
+  double sum_value = 0;
+  int t1_val = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(
+        1 + static_cast< double >(t1_val++ % 1000) / 7);
+    sum_value += static_cast< double >(*begin);
+  }
+  T t2 = t1.transpose();
+  double length = static_cast< double >(t1.length());
+  EXPECT_NEAR(sum_value, T::sum(t1, tensor::reduction::PAIRWISE),
+              sum_value * 1e-6);
+  EXPECT_NEAR(sum_value, T::sum(t2, tensor::reduction::PAIRWISE),
+              sum_value * 1e-6);
+  EXPECT_NEAR(sum_value, T::sum(t1, tensor::reduction::KAHAN),
+              sum_value * 1e-7);
+  EXPECT_NEAR(sum_value, T::sum(t2, tensor::reduction::KAHAN),
+              sum_value * 1e-7);
+  EXPECT_EQ(T::sum(t1), T::sum(t1, tensor::reduction::SEQUENTIAL));
+  EXPECT_NEAR(sum_value / length, T::mean(t1, tensor::reduction::KAHAN),
+              sum_value / length * 1e-7);
+
+  // Results do not depend on the number of threads
+  tensor::parallel::setThreads(3);
+  typename T::value_type pairwise_value =
+      T::sum(t1, tensor::reduction::PAIRWISE);
+  typename T::value_type kahan_value = T::sum(t1, tensor::reduction::KAHAN);
+  tensor::parallel::setThreads(1);
+  EXPECT_EQ(pairwise_value, T::sum(t1, tensor::reduction::PAIRWISE));
+  EXPECT_EQ(kahan_value, T::sum(t1, tensor::reduction::KAHAN));
+  tensor::parallel::setThreads(0);
+}
+
+TEST(TensorTest, summationTest) {
+  summationTest< DoubleTensor >();
+  summationTest< FloatTensor >();
+}
+
+template < typename T >
+void meanVarTest() {
+  // Large offsets do not cancel the deviations
+  T t1({10, 20, 7}, {290, 14, 2});
+  int t1_val = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(1e4 + t1_val++ % 3);
+  }
+  ::std::pair< typename T::value_type, typename T::value_type > p1 =
+      T::meanVar(t1);
+  EXPECT_FLOAT_EQ(1e4 + 1, p1.first);
+  EXPECT_NEAR(2.0 / 3.0, p1.second, 1e-3);
+  EXPECT_EQ(p1.second, T::var(t1));
+
+  for (typename T::dim_type d = 0; d < 3; ++d) {
+    ::std::pair< T, T > p2 = T::meanVar(t1, d);
+    T mean_result = T::mean(t1, d);
+    T var_result = T::var(t1, d);
+    for (typename T::reference_iterator begin = var_result.reference_begin(),
+             end = var_result.reference_end(); begin != end; ++begin) {
+      typename T::size_storage pos = begin.position();
+      EXPECT_FLOAT_EQ(mean_result(pos), p2.first(pos));
+      EXPECT_EQ(*begin, p2.second(pos));
+      EXPECT_NEAR(2.0 / 3.0, *begin, 0.1);
+    }
+  }
+}
+
+TEST(TensorTest, meanVarTest) {
+  meanVarTest< DoubleTensor >();
+  meanVarTest< FloatTensor >();
+}
+
 template < typename T >
 void maxTest() {
   T t1(10, 20, 7);
@@ -19,7 +19,11 @@
 
 #include "thunder/tensor.hpp"
 
+#include <cmath>
+#include <cstdio>
+#include <ios>
 #include <memory>
+#include <string>
 #include <typeinfo>
 
 #include "gtest/gtest.h"
@@ -79,5 +83,80 @@ TEST(TensorTest, serializeTest) {
   serializeTest< FloatComplexTensor >();
 }
 
+template< typename T, typename M >
+void mappedTest() {
+  T t1({10, 20, 7}, {161, 8, 1});
+  T t2(30, 4);
+  int t1_val = -800;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(t1_val++) /
+        static_cast< typename T::value_type >(300);
+  }
+  t2.fill(3);
+
+  // Save two tensors in one file and record the position of the second
+  ::std::string file = "tensor_mapped_test.bin";
+  ::std::streamoff position;
+  {
+    FileBinarySerializer s(file, ::std::ios_base::out |
+                           ::std::ios_base::binary | ::std::ios_base::trunc);
+    s.save(t1);
+    position = s.protocol().stream().tellp();
+    s.save(t2);
+  }
+
+  M m1 = tensor::loadMapped< M >(file);
+  EXPECT_TRUE(m1.storage()->mapped());
+  EXPECT_EQ(t1.dimension(), m1.dimension());
+  EXPECT_EQ(t1.offset(), m1.offset());
+  for (int i = 0; i < t1.dimension(); ++i) {
+    EXPECT_EQ(t1.size(i), m1.size(i));
+    EXPECT_EQ(t1.stride(i), m1.stride(i));
+  }
+  M r1 = M::add(m1, m1);
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    typename T::size_storage pos = begin.position();
+    EXPECT_EQ(*begin, m1(pos));
+    EXPECT_FLOAT_EQ(*begin + *begin, r1(pos));
+  }
+
+  // Copy-on-write tensors can be modified without changing the file
+  M m2 = tensor::loadMapped< M >(
+      file, position, M::storage_type::COPY_ON_WRITE);
+  EXPECT_EQ(30, m2.size(0));
+  EXPECT_EQ(4, m2.size(1));
+  EXPECT_EQ(3, m2(29, 3));
+  m2.fill(5);
+  EXPECT_EQ(5, m2(29, 3));
+  M m3 = tensor::loadMapped< M >(file, position);
+  EXPECT_EQ(3, m3(29, 3));
+  T t3 = static_cast< T >(m3);
+  EXPECT_EQ(3, t3(0, 0));
+
+  // Mutating read-only tensors copies them to the heap first
+  M m4 = tensor::loadMapped< M >(file, position);
+  M m5 = m4.narrow(0, 10, 5);
+  m4 += 1;
+  EXPECT_FALSE(m4.storage()->mapped());
+  EXPECT_EQ(4, m4(29, 3));
+  EXPECT_EQ(4, m5(0, 0));
+  m4.fill(6);
+  m4.exp();
+  EXPECT_FLOAT_EQ(::std::exp(6), m4(0, 0));
+  M m6 = tensor::loadMapped< M >(file, position);
+  m6.copy(T(t2 * 2));
+  EXPECT_EQ(6, m6(29, 3));
+  EXPECT_EQ(3, tensor::loadMapped< M >(file, position)(29, 3));
+
+  ::std::remove(file.c_str());
+}
+
+TEST(TensorTest, mappedTest) {
+  mappedTest< DoubleTensor, MappedDoubleTensor >();
+  mappedTest< FloatTensor, MappedFloatTensor >();
+}
+
 }  // namespace
 }  // namespace thunder
@@ -0,0 +1,182 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor.hpp"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+template < typename T >
+T sequence() {
+  T t(6, 5);
+  int val = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T::value_type >(val++);
+  }
+  return t;
+}
+
+template < typename T >
+void expectSequence(const T &t) {
+  int val = 0;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin) {
+    EXPECT_EQ(static_cast< typename T::value_type >(val++), *begin);
+  }
+}
+
+template < typename T >
+void cloneTest() {
+  // Clones are copied eagerly by default
+  T t1 = sequence< T >();
+  T t2 = t1.clone();
+  EXPECT_NE(t1.data(), t2.data());
+  EXPECT_FALSE(t1.isShared());
+
+  tensor::share::setCopyOnWrite(true);
+  EXPECT_TRUE(tensor::share::getCopyOnWrite());
+
+  // Clones share data until one side is mutated
+  T t3 = t1.clone();
+  EXPECT_EQ(t1.data(), t3.data());
+  EXPECT_NE(t1.storage(), t3.storage());
+  EXPECT_TRUE(t1.isShared());
+  EXPECT_TRUE(t3.isShared());
+  EXPECT_FALSE(t3.isUnique());
+  t3.add(1);
+  EXPECT_NE(t1.data(), t3.data());
+  EXPECT_FALSE(t1.isShared());
+  EXPECT_EQ(static_cast< typename T::value_type >(1), t3(0, 0));
+  expectSequence(t1);
+
+  // The mutated source keeps sharing storage with its views
+  T t4 = t1.narrow(0, 2, 3);
+  T t5 = t1.clone();
+  t1.fill(7);
+  EXPECT_EQ(t1.storage(), t4.storage());
+  EXPECT_EQ(static_cast< typename T::value_type >(7), t4(1, 2));
+  expectSequence(t5);
+
+  // Views that do not span their storage are copied eagerly
+  T t6 = t4.clone();
+  EXPECT_NE(t4.data(), t6.data());
+  EXPECT_FALSE(t4.isShared());
+
+  // Static functions and operators leave their arguments intact
+  T t7 = t5.clone();
+  T t8 = T::sqrt(t7);
+  T t9 = t7 + t7;
+  T t10 = t7 > static_cast< typename T::value_type >(3);
+  EXPECT_EQ(static_cast< typename T::value_type >(2), t8(0, 4));
+  EXPECT_EQ(static_cast< typename T::value_type >(8), t9(0, 4));
+  EXPECT_EQ(static_cast< typename T::value_type >(1), t10(0, 4));
+  expectSequence(t5);
+  expectSequence(t7);
+
+  // Writes through references follow an explicit detach
+  T t11 = t5.clone();
+  t11.detach()(0, 0) = static_cast< typename T::value_type >(-1);
+  expectSequence(t5);
+  T t12 = t5.clone();
+  t12.unique();
+  EXPECT_TRUE(t12.isUnique());
+  EXPECT_NE(t5.data(), t12.data());
+
+  // Pipelines, expressions and applications detach before writing
+  T t13 = t5.clone();
+  tensor::fuse(t13).mul(2).run();
+  T t14 = t5.clone();
+  t14.copy(t5 * t5);
+  T t15 = t5.clone();
+  t15.apply([](typename T::value_type v) { return v + 1; });
+  EXPECT_EQ(static_cast< typename T::value_type >(8), t13(0, 4));
+  EXPECT_EQ(static_cast< typename T::value_type >(16), t14(0, 4));
+  EXPECT_EQ(static_cast< typename T::value_type >(5), t15(0, 4));
+  expectSequence(t5);
+
+  // Static applications leave their arguments intact
+  typedef typename T::value_type D;
+  T t16 = t5.clone();
+  T t17 = T::apply(t16, [](D v) { return v + 1; });
+  T t18 = T::zip_apply(t16, t5, [](D v, D w) { return v + w; });
+  T t19 = T::zip_apply(t16, t5, t5, [](D u, D v, D w) { return u + v + w; });
+  T t20 = T::zip_apply(tensor::parallel::concurrent, t16, t5, t5,
+                       [](D u, D v, D w) { return u * v * w; });
+  EXPECT_EQ(static_cast< D >(5), t17(0, 4));
+  EXPECT_EQ(static_cast< D >(8), t18(0, 4));
+  EXPECT_EQ(static_cast< D >(12), t19(0, 4));
+  EXPECT_EQ(static_cast< D >(64), t20(0, 4));
+  expectSequence(t5);
+  expectSequence(t16);
+
+  // Positions of extrema are written to detached outputs
+  typedef tensor::Tensor< typename T::size_storage > P;
+  P p1 = P(2).fill(9);
+  P p2 = p1.clone();
+  P p3 = p1.clone();
+  t5.max(&p2);
+  t5.min(&p3);
+  EXPECT_EQ(static_cast< typename P::value_type >(4), p2(1));
+  EXPECT_EQ(static_cast< typename P::value_type >(0), p3(1));
+  P p4 = P(6, 1).fill(9);
+  P p5 = p4.clone();
+  P p6 = p4.clone();
+  t5.max(1, &p5);
+  t5.min(1, &p6);
+  EXPECT_EQ(static_cast< typename P::value_type >(4), p5(2, 0));
+  EXPECT_EQ(static_cast< typename P::value_type >(0), p6(2, 0));
+  for (typename P::size_type i = 0; i < 6; ++i) {
+    EXPECT_EQ(static_cast< typename P::value_type >(9), p4(i, 0));
+  }
+  EXPECT_EQ(static_cast< typename P::value_type >(9), p1(0));
+  EXPECT_EQ(static_cast< typename P::value_type >(9), p1(1));
+
+  tensor::share::setCopyOnWrite(false);
+}
+
+TEST(ShareTest, doubleCloneTest) {
+  cloneTest< DoubleTensor >();
+}
+
+TEST(ShareTest, floatCloneTest) {
+  cloneTest< FloatTensor >();
+}
+
+TEST(ShareTest, sizeCloneTest) {
+  cloneTest< SizeTensor >();
+}
+
+TEST(ShareTest, mappedCloneTest) {
+  // Storages that cannot share data are always copied
+  tensor::share::setCopyOnWrite(true);
+  MappedDoubleTensor t1(4, 3);
+  t1.fill(2);
+  MappedDoubleTensor t2 = t1.clone();
+  EXPECT_NE(t1.data(), t2.data());
+  EXPECT_FALSE(t2.isShared());
+  tensor::share::setCopyOnWrite(false);
+}
+
+}  // namespace
+}  // namespace thunder
@@ -0,0 +1,454 @@
+/*
+ * \copyright Copyright 2014 Xiang Zhang All Rights Reserved.
+ * \license @{
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @}
+ */
+
+#include "thunder/tensor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+namespace thunder {
+namespace {
+
+template < typename D >
+void expectSame(D expected, D actual) {
+  if (::std::isnan(expected)) {
+    EXPECT_TRUE(::std::isnan(actual));
+  } else {
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+// Fills with values that include ties, signed zeros and NaNs
+template < typename T >
+void fillTensor(const T &t, int start) {
+  typedef typename T::value_type D;
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    if (val % 13 == 0) {
+      *begin = ::std::numeric_limits< D >::quiet_NaN();
+    } else if (val % 11 == 0) {
+      *begin = -static_cast< D >(0);
+    } else {
+      *begin = static_cast< D >(val % 7) / 3;
+    }
+  }
+}
+
+#define TEST_SIMD_BINARY(func)                                          \
+  template < typename T >                                               \
+  void func ## Test(const T &x, const T &y) {                           \
+    typedef typename T::value_type D;                                   \
+    T r1 = T::func(x, static_cast< D >(1));                             \
+    T r2 = T::func(x, y);                                               \
+    for (typename T::size_type i = 0; i < x.length(); ++i) {            \
+      expectSame(static_cast< D >(::std::func(x[i](), D(1))), r1[i]()); \
+      expectSame(static_cast< D >(::std::func(x[i](), y[i]())), r2[i]()); \
+    }                                                                   \
+  }
+
+TEST_SIMD_BINARY(fmax);
+TEST_SIMD_BINARY(fmin);
+TEST_SIMD_BINARY(isgreater);
+TEST_SIMD_BINARY(isgreaterequal);
+TEST_SIMD_BINARY(isless);
+TEST_SIMD_BINARY(islessequal);
+TEST_SIMD_BINARY(islessgreater);
+TEST_SIMD_BINARY(isunordered);
+
+#undef TEST_SIMD_BINARY
+
+#define TEST_SIMD_OPERATOR(func, op)                                    \
+  template < typename T >                                               \
+  void func ## Test(const T &x, const T &y) {                           \
+    typedef typename T::value_type D;                                   \
+    T r1 = T::func(x, static_cast< D >(3));                             \
+    T r2 = T::func(x, y);                                               \
+    for (typename T::size_type i = 0; i < x.length(); ++i) {            \
+      expectSame(static_cast< D >(x[i]() op D(3)), r1[i]());            \
+      expectSame(static_cast< D >(x[i]() op y[i]()), r2[i]());          \
+    }                                                                   \
+  }
+
+TEST_SIMD_OPERATOR(add, +);
+TEST_SIMD_OPERATOR(sub, -);
+TEST_SIMD_OPERATOR(mul, *);
+TEST_SIMD_OPERATOR(div, /);
+
+#undef TEST_SIMD_OPERATOR
+
+template < typename T >
+void fmaTest(const T &x, const T &y, const T &z) {
+  typedef typename T::value_type D;
+  T r1 = T(x.length()).copy(x).fma(D(3), D(2));
+  T r2 = T(x.length()).copy(x).fma(y, D(2));
+  T r3 = T(x.length()).copy(x).fma(D(3), z);
+  T r4 = T(x.length()).copy(x).fma(y, z);
+  for (typename T::size_type i = 0; i < x.length(); ++i) {
+    expectSame(static_cast< D >(::std::fma(x[i](), D(3), D(2))), r1[i]());
+    expectSame(static_cast< D >(::std::fma(x[i](), y[i](), D(2))), r2[i]());
+    expectSame(static_cast< D >(::std::fma(x[i](), D(3), z[i]())), r3[i]());
+    expectSame(static_cast< D >(::std::fma(x[i](), y[i](), z[i]())), r4[i]());
+  }
+}
+
+// Copies y into a tensor of layout x and compares them element by element
+template < typename T1, typename T2 >
+void transposeCopyTest(const T1 &x, const T2 &y) {
+  int val = 0;
+  for (typename T2::reference_iterator begin = y.reference_begin(),
+           end = y.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< typename T2::value_type >(val++);
+  }
+  x.copy(y);
+  for (typename T2::reference_iterator begin = y.reference_begin(),
+           end = y.reference_end(); begin != end; ++begin) {
+    EXPECT_EQ(static_cast< typename T1::value_type >(*begin),
+              x(begin.position()));
+  }
+}
+
+template < typename T >
+void transposeTest() {
+  // Edges of blocks and tiles are covered by the odd sizes
+  typename T::size_type sizes[][2] = {{5, 3}, {16, 16}, {37, 53}, {64, 64},
+                                      {130, 17}, {200, 131}};
+  for (const typename T::size_type *size : sizes) {
+    transposeCopyTest(T(size[0], size[1]),
+                      T(size[1], size[0]).transpose());
+    transposeCopyTest(T(3, size[0], size[1]),
+                      T(3, size[1], size[0]).transpose(1, 2));
+    transposeCopyTest(T(size[1], 4, size[0]),
+                      T(size[0], 4, size[1]).transpose(0, 2));
+  }
+  // Channel-first and channel-last layouts are converted by permutations
+  for (typename T::size_type c : {3, 20}) {
+    transposeCopyTest(T(2, 9, 11, c), T(2, c, 9, 11).permute(0, 2, 3, 1));
+    transposeCopyTest(T(2, c, 9, 11), T(2, 9, 11, c).permute(0, 3, 1, 2));
+  }
+  // Strides other than the contiguous ones may be arbitrary
+  transposeCopyTest(T(20, 50).narrow(1, 5, 30),
+                    T(30, 40).transpose().narrow(0, 2, 20));
+  T t = T(70, 90).transpose();
+  transposeCopyTest(T(90, 70), t);
+  t.contiguous();
+  EXPECT_TRUE(t.isContiguous());
+}
+
+template < typename T >
+void instructionTest() {
+  tensor::simd::Instruction best = tensor::simd::detect();
+  for (int i = tensor::simd::SCALAR; i <= best; ++i) {
+    tensor::simd::setInstruction(static_cast< tensor::simd::Instruction >(i));
+    EXPECT_EQ(i, tensor::simd::getInstruction());
+    // Odd lengths exercise the remainder loops
+    for (typename T::size_type n : {1, 7, 33, 1001}) {
+      T x(n), y(n), z(n);
+      fillTensor(x, -17);
+      fillTensor(y, 5);
+      fillTensor(z, 29);
+      fmaxTest(x, y);
+      fminTest(x, y);
+      isgreaterTest(x, y);
+      isgreaterequalTest(x, y);
+      islessTest(x, y);
+      islessequalTest(x, y);
+      islessgreaterTest(x, y);
+      isunorderedTest(x, y);
+      addTest(x, y);
+      subTest(x, y);
+      mulTest(x, y);
+      divTest(x, y);
+      fmaTest(x, y, z);
+    }
+    transposeTest< T >();
+  }
+  tensor::simd::setInstruction(tensor::simd::AVX512);
+  EXPECT_EQ(best, tensor::simd::getInstruction());
+}
+
+TEST(SimdTest, doubleInstructionTest) {
+  instructionTest< DoubleTensor >();
+}
+
+TEST(SimdTest, floatInstructionTest) {
+  instructionTest< FloatTensor >();
+}
+
+// Complex results agree with std::complex up to rounding of the few operations
+// each one takes, and infinities and NaNs agree in kind
+template < typename C >
+void expectNear(const C &expected, const C &actual) {
+  typedef typename C::value_type D;
+  D tolerance = 64 * ::std::numeric_limits< D >::epsilon() *
+      ::std::max(static_cast< D >(1), ::std::abs(expected));
+  if (::std::isinf(expected.real()) || ::std::isinf(expected.imag())) {
+    EXPECT_TRUE(::std::isinf(actual.real()) || ::std::isinf(actual.imag()));
+  } else if (::std::isnan(expected.real()) || ::std::isnan(expected.imag())) {
+    EXPECT_TRUE(::std::isnan(actual.real()) || ::std::isnan(actual.imag()));
+  } else {
+    EXPECT_NEAR(expected.real(), actual.real(), tolerance);
+    EXPECT_NEAR(expected.imag(), actual.imag(), tolerance);
+  }
+}
+
+template < typename T >
+void complexFillTensor(const T &t, int start) {
+  typedef typename T::value_type C;
+  typedef typename C::value_type D;
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    *begin = C(static_cast< D >(val % 7 - 3) / 3,
+               static_cast< D >(val % 5 + 1) / 4);
+  }
+}
+
+template < typename T >
+void complexTest(const T &x, const T &y, const T &z) {
+  typedef typename T::value_type C;
+  C c(-1.5, 0.25), d(0.5, 2);
+  T r1 = T::mul(x, y), r2 = T::div(x, y), r3 = T::mul(x, c), r4 = T::div(x, c);
+  T r5 = T::add(x, y), r6 = T::sub(x, c);
+  T r7 = T(x.length()).copy(x).fma(c, d);
+  T r8 = T(x.length()).copy(x).fma(y, d);
+  T r9 = T(x.length()).copy(x).fma(c, z);
+  T r10 = T(x.length()).copy(x).fma(y, z);
+  T r11 = T::conj(x), r12 = T::cnrm(x);
+  T r13 = T(x.length()).polar(y, c);
+  C c_exp = ::std::exp(c * C(0, 1));
+  for (typename T::size_type i = 0; i < x.length(); ++i) {
+    expectNear(x[i]() * y[i](), r1[i]());
+    expectNear(x[i]() / y[i](), r2[i]());
+    expectNear(x[i]() * c, r3[i]());
+    expectNear(x[i]() / c, r4[i]());
+    expectNear(x[i]() + y[i](), r5[i]());
+    expectNear(x[i]() - c, r6[i]());
+    expectNear(x[i]() * c + d, r7[i]());
+    expectNear(x[i]() * y[i]() + d, r8[i]());
+    expectNear(x[i]() * c + z[i](), r9[i]());
+    expectNear(x[i]() * y[i]() + z[i](), r10[i]());
+    EXPECT_EQ(::std::conj(x[i]()), r11[i]());
+    expectNear(C(::std::norm(x[i]())), r12[i]());
+    expectNear(y[i]() * c_exp, r13[i]());
+  }
+}
+
+template < typename T >
+void complexInstructionTest() {
+  typedef typename T::value_type C;
+  typedef typename C::value_type D;
+  D inf = ::std::numeric_limits< D >::infinity();
+  D nan = ::std::numeric_limits< D >::quiet_NaN();
+  D big = ::std::numeric_limits< D >::max() / 4;
+  D tiny = ::std::numeric_limits< D >::min() * 4;
+  tensor::simd::Instruction best = tensor::simd::detect();
+  for (int i = tensor::simd::SCALAR; i <= best; ++i) {
+    tensor::simd::setInstruction(static_cast< tensor::simd::Instruction >(i));
+    for (bool fast : {false, true}) {
+      tensor::simd::setFastComplex(fast);
+      EXPECT_EQ(fast, tensor::simd::getFastComplex());
+      for (typename T::size_type n : {1, 7, 33, 1001}) {
+        T x(n), y(n), z(n);
+        complexFillTensor(x, -17);
+        complexFillTensor(y, 5);
+        complexFillTensor(z, 29);
+        complexTest(x, y, z);
+      }
+    }
+    tensor::simd::setFastComplex(false);
+
+    // Infinities are recovered and quotients are scaled in every lane
+    for (typename T::size_type k : {0, 5, 16}) {
+      T x(17), y(17);
+      complexFillTensor(x, 3);
+      complexFillTensor(y, 8);
+      x(k) = C(inf, nan);
+      y(k) = C(1, 1);
+      T r1 = T::mul(x, y);
+      T r2 = T(17).copy(x).fma(y, C(1, 0));
+      EXPECT_TRUE(::std::isinf(r1[k]().real()) ||
+                  ::std::isinf(r1[k]().imag()));
+      EXPECT_TRUE(::std::isinf(r2[k]().real()) ||
+                  ::std::isinf(r2[k]().imag()));
+      x(k) = C(1, 2);
+      y(k) = C(0, 0);
+      T r3 = T::div(x, y);
+      EXPECT_TRUE(::std::isinf(r3[k]().real()));
+      EXPECT_TRUE(::std::isinf(r3[k]().imag()));
+      x(k) = C(big, -big);
+      y(k) = C(big, big);
+      T r4 = T::div(x, y);
+      expectNear(C(0, -1), r4[k]());
+      x(k) = C(tiny, tiny);
+      y(k) = C(tiny, -tiny);
+      T r5 = T::div(x, y);
+      expectNear(C(0, 1), r5[k]());
+      complexTest(x, y, x);
+    }
+  }
+  tensor::simd::setInstruction(tensor::simd::AVX512);
+}
+
+TEST(SimdTest, doubleComplexInstructionTest) {
+  complexInstructionTest< DoubleComplexTensor >();
+}
+
+TEST(SimdTest, floatComplexInstructionTest) {
+  complexInstructionTest< FloatComplexTensor >();
+}
+
+// Largest errors in units in the last place, as documented in simd.hpp
+template < typename D >
+double ulpBound(tensor::simd::Function f, bool fast) {
+  static const double double_bounds[] = {
+    0.85, 0.82, 0.5, 0.77, 0.77, 1.27, 2.96};
+  static const double float_bounds[] = {
+    0.88, 0.82, 0.5, 1.5, 1.53, 1.26, 2.49};
+  bool is_double = sizeof(D) == sizeof(double);
+  if (fast && f == tensor::simd::EXP) {
+    return is_double ? 2.47 : 1.17;
+  }
+  if (fast && f == tensor::simd::TANH) {
+    return is_double ? 1.61 : 1.33;
+  }
+  return is_double ? double_bounds[f] : float_bounds[f];
+}
+
+// Elementary functions are compared with references of higher precision
+// within the documented bounds. Zeros, infinities and NaNs agree exactly.
+template < typename D, typename R >
+void expectUlp(R expected, D actual, double ulps, D floor) {
+  D rounded = static_cast< D >(expected);
+  if (::std::isnan(rounded)) {
+    EXPECT_TRUE(::std::isnan(actual));
+  } else if (::std::isinf(rounded) || rounded == 0) {
+    EXPECT_EQ(rounded, actual);
+    EXPECT_EQ(::std::signbit(rounded), ::std::signbit(actual));
+  } else {
+    R scale = ::std::max(
+        ::std::max(::std::abs(expected), static_cast< R >(floor)),
+        static_cast< R >(::std::numeric_limits< D >::min()));
+    EXPECT_LE(::std::abs(actual - expected),
+              ulps * ::std::numeric_limits< D >::epsilon() * scale)
+        << "expected " << expected << ", actual " << actual;
+  }
+}
+
+template < typename T >
+void functionFillTensor(const T &t, int start) {
+  typedef typename T::value_type D;
+  int val = start;
+  for (typename T::reference_iterator begin = t.reference_begin(),
+           end = t.reference_end(); begin != end; ++begin, ++val) {
+    *begin = static_cast< D >((val * 37) % 2001 - 1000) / 64;
+  }
+}
+
+// Near zeros of sin and cos fast math is compared in absolute terms
+template < typename T >
+void functionTest(const T &x, bool fast) {
+  typedef typename T::value_type D;
+  typedef typename ::std::conditional< sizeof(D) < sizeof(double), double,
+                                       long double >::type R;
+  D floor = fast ? 1 : 0;
+  T y = T::abs(x);
+  T r1 = T::exp(x), r2 = T::log(y), r3 = T::sqrt(y), r4 = T::sin(x);
+  T r5 = T::cos(x), r6 = T::tanh(x), r7 = T::erf(x);
+  for (typename T::size_type i = 0; i < x.length(); ++i) {
+    R a = x[i](), b = y[i]();
+    expectUlp< D, R >(::std::exp(a), r1[i](),
+                      ulpBound< D >(tensor::simd::EXP, fast), 0);
+    expectUlp< D, R >(::std::log(b), r2[i](),
+                      ulpBound< D >(tensor::simd::LOG, fast), 0);
+    expectUlp< D, R >(::std::sqrt(b), r3[i](),
+                      ulpBound< D >(tensor::simd::SQRT, fast), 0);
+    expectUlp< D, R >(::std::sin(a), r4[i](),
+                      ulpBound< D >(tensor::simd::SIN, fast), floor);
+    expectUlp< D, R >(::std::cos(a), r5[i](),
+                      ulpBound< D >(tensor::simd::COS, fast), floor);
+    expectUlp< D, R >(::std::tanh(a), r6[i](),
+                      ulpBound< D >(tensor::simd::TANH, fast), 0);
+    expectUlp< D, R >(::std::erf(a), r7[i](),
+                      ulpBound< D >(tensor::simd::ERF, fast), 0);
+  }
+}
+
+template < typename T >
+void functionInstructionTest() {
+  typedef typename T::value_type D;
+  D inf = ::std::numeric_limits< D >::infinity();
+  D nan = ::std::numeric_limits< D >::quiet_NaN();
+  D max = ::std::numeric_limits< D >::max();
+  D min = ::std::numeric_limits< D >::min();
+  D specials[] = {nan, inf, -inf, 0, -static_cast< D >(0), min / 4, min, max,
+                  -max, -1, static_cast< D >(1e30), 800, -800, 88, -104,
+                  static_cast< D >(3.14159265358979323846), 6.5};
+  tensor::simd::Instruction best = tensor::simd::detect();
+  for (int i = tensor::simd::SCALAR; i <= best; ++i) {
+    tensor::simd::setInstruction(static_cast< tensor::simd::Instruction >(i));
+    for (bool fast : {false, true}) {
+      tensor::simd::setFastMath(fast);
+      EXPECT_EQ(fast, tensor::simd::getFastMath());
+      for (typename T::size_type n : {1, 7, 33, 1001}) {
+        T x(n);
+        functionFillTensor(x, -17);
+        functionTest(x, fast);
+      }
+    }
+    tensor::simd::setFastMath(false);
+
+    // Special values go to the C library in every lane
+    for (bool fast : {false, true}) {
+      tensor::simd::setFastMath(fast);
+      for (typename T::size_type k : {0, 5, 16}) {
+        for (D special : specials) {
+          T x(17);
+          functionFillTensor(x, 3);
+          x(k) = special;
+          functionTest(x, fast);
+        }
+      }
+    }
+    tensor::simd::setFastMath(false);
+  }
+  tensor::simd::setInstruction(tensor::simd::AVX512);
+}
+
+TEST(SimdTest, doubleFunctionInstructionTest) {
+  functionInstructionTest< DoubleTensor >();
+}
+
+TEST(SimdTest, floatFunctionInstructionTest) {
+  functionInstructionTest< FloatTensor >();
+}
+
+TEST(SimdTest, scalarTransposeTest) {
+  transposeTest< SizeTensor >();
+  transposeTest< DoubleComplexTensor >();
+  transposeCopyTest(DoubleTensor(50, 70), FloatTensor(70, 50).transpose());
+}
+
+}  // namespace
+}  // namespace thunder
@@ -20,10 +20,12 @@
 #include "thunder/tensor.hpp"
 
 #include <complex>
+#include <cstdint>
 #include <memory>
 #include <typeinfo>
 
 #include "gtest/gtest.h"
+#include "thunder/exception.hpp"
 #include "thunder/storage.hpp"
 
 namespace thunder {
@@ -168,6 +170,47 @@ TEST(TensorTest, applyTest) {
   applyTest< FloatComplexTensor >();
 }
 
+template< typename T >
+void zipApplyTest() {
+  typedef typename T::value_type D;
+  T t1(10, 20, 7);
+  int t1_val = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< D >(t1_val++);
+  }
+  // A non-contiguous operand takes the iterator path
+  T t2 = t1.transpose(0, 2).clone().transpose(0, 2);
+  T t3 = T::apply(t1, [](D x) { return x + static_cast< D >(1); });
+
+  ::std::size_t grain = tensor::parallel::getGrain();
+  tensor::parallel::setGrain(16);
+  T t4 = T::zip_apply(t1, t2, [](D x, D y) { return x * y; });
+  T t5 = T::zip_apply(tensor::parallel::concurrent, t1, t3, t2,
+                      [](D x, D y, const D &z) { return x * y - z; });
+  T t6 = T::apply(tensor::parallel::concurrent, t2, [](D &x) { x = x + x; });
+  tensor::parallel::setGrain(grain);
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        EXPECT_EQ(t1(i, j, k) * t1(i, j, k), t4(i, j, k));
+        EXPECT_EQ(t1(i, j, k) * t1(i, j, k), t5(i, j, k));
+        EXPECT_EQ(t1(i, j, k) + t1(i, j, k), t6(i, j, k));
+      }
+    }
+  }
+
+  EXPECT_THROW(T::zip_apply(t1, T(10), [](D x, D y) { return x + y; }),
+               out_of_range);
+}
+
+TEST(TensorTest, zipApplyTest) {
+  zipApplyTest< DoubleTensor >();
+  zipApplyTest< FloatTensor >();
+  zipApplyTest< DoubleComplexTensor >();
+  zipApplyTest< FloatComplexTensor >();
+}
+
 template< typename T >
 void noncontiguousApplyTest() {
   T t1({10, 20, 7}, {290, 14, 2});
@@ -249,5 +292,55 @@ TEST(TensorTest, noncontiguousApplyTest) {
   noncontiguousApplyTest< FloatComplexTensor >();
 }
 
+template< typename T, typename R, typename C >
+void allocatorTest() {
+  typedef typename T::value_type value_type;
+  T t1(10, 20, 7);
+  int t1_val = 0;
+  for (typename T::reference_iterator begin = t1.reference_begin(),
+           end = t1.reference_end(); begin != end; ++begin) {
+    *begin = static_cast< value_type >(t1_val++);
+  }
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(t1.data()) % 64);
+
+  // Temporaries of the same size reuse the freed storage of the pool
+  T t2 = T::add(t1, t1);
+  T t3 = T::mul(t2, static_cast< value_type >(0.5));
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(t3.data()) % 64);
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        EXPECT_FLOAT_EQ(t1(i, j, k), t3(i, j, k));
+      }
+    }
+  }
+
+  // Conversion from and to the default storage
+  R r1 = static_cast< R >(t1);
+  T t4 = static_cast< T >(r1);
+  R r2 = R(10, 20, 7).copy(t1);
+  C c1 = C(10, 20, 7).copy(t1);
+  T t5 = c1.template getReal< T >();
+  EXPECT_EQ(0, reinterpret_cast< ::std::uintptr_t >(t4.data()) % 64);
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        EXPECT_FLOAT_EQ(t1(i, j, k), r1(i, j, k));
+        EXPECT_FLOAT_EQ(t1(i, j, k), t4(i, j, k));
+        EXPECT_FLOAT_EQ(t1(i, j, k), r2(i, j, k));
+        EXPECT_FLOAT_EQ(t1(i, j, k), t5(i, j, k));
+      }
+    }
+  }
+}
+
+TEST(TensorTest, allocatorTest) {
+  allocatorTest< AlignedDoubleTensor, DoubleTensor,
+                 AlignedDoubleComplexTensor >();
+  allocatorTest< AlignedFloatTensor, FloatTensor, AlignedFloatComplexTensor >();
+  allocatorTest< PoolDoubleTensor, DoubleTensor, PoolDoubleComplexTensor >();
+  allocatorTest< PoolFloatTensor, FloatTensor, PoolFloatComplexTensor >();
+}
+
 }  // namespace
 }  // namespace thunder